@@ -0,0 +1,95 @@
+/**
+ * @file arena.h
+ * @brief 线性（指针递增）分配器，支持检查点回退和按周期O(1)整体复位，用于每个控制周期的临时内存
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "rcs_allocator.h"
+
+/* 系统调用 ---------------------------------------------------*/
+
+#define ArenaPortMalloc malloc
+#define ArenaPortFree   free
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_ARENA_OK 0
+#define RCS_ARENA_ERROR -1
+#define RCS_ARENA_INVALID_PARAM -2
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 线性分配器对象
+ */
+typedef void* RcsArena_t;
+
+/**
+ * @brief 检查点，记录某一时刻的分配位置
+ */
+typedef size_t RcsArenaMark_t;
+
+/**
+ * @brief 线性分配器实例
+ * @note 不加锁，只能在单一上下文（同一任务或同一中断）中使用
+ */
+typedef struct
+{
+    uint8_t *mem;
+    size_t   memSize;
+    size_t   offset;
+    size_t   peak;   // 历史最高用量，用于确定内存区大小
+}RcsArenaHandle_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+RcsArena_t RcsArenaCreateStatic(size_t arenaSize, RcsArenaHandle_t *staticHandle, uint8_t *arenaMemory);
+RcsArena_t RcsArenaCreate(size_t arenaSize);
+void RcsArenaDestroy(RcsArena_t arena);
+RcsArenaMark_t RcsArenaCheckpoint(RcsArena_t arena);
+int RcsArenaRewind(RcsArena_t arena, RcsArenaMark_t mark);
+void RcsArenaReset(RcsArena_t arena);
+size_t RcsArenaGetUsed(RcsArena_t arena);
+size_t RcsArenaGetPeak(RcsArena_t arena);
+int RcsArenaGetAllocator(RcsArena_t arena, RcsAllocator_t *allocator);
+
+/**
+ * @brief 从线性分配器申请内存，只做一次对齐和一次比较，内联到调用处
+ * @param arena 线性分配器句柄
+ * @param size 申请大小，单位为字节
+ * @param align 对齐要求，必须为2的幂
+ * @return 返回地址，空间不足时返回NULL
+ */
+static inline void *RcsArenaAlloc(RcsArena_t arena, size_t size, size_t align)
+{
+    RcsArenaHandle_t *handle = (RcsArenaHandle_t *)arena;
+    uintptr_t base = (uintptr_t)handle->mem;
+    uintptr_t start = (base + handle->offset + align - 1) & ~(uintptr_t)(align - 1);
+    size_t end = (size_t)(start - base) + size;
+
+    if (end > handle->memSize || end < size) {
+        return NULL;
+    }
+    handle->offset = end;
+    if (end > handle->peak) {
+        handle->peak = end;
+    }
+    return (void *)start;
+}
+
+#ifdef __cplusplus
+}
+#endif
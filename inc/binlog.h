@@ -0,0 +1,172 @@
+/**
+ * @file binlog.h
+ * @brief 延迟格式化的二进制日志：调用处只写入格式串编号与原始参数，格式化在主机端离线完成（见binlog_decode.h）
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "siso_fifo.h"
+
+/* 系统调用 ---------------------------------------------------*/
+
+// 记录的时间戳，可定义为DWT->CYCCNT或硬件定时器的计数值
+#ifndef LogPortTimestamp
+#define LogPortTimestamp() 0u
+#endif
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_LOG_OK 0
+#define RCS_LOG_ERROR -1
+#define RCS_LOG_INVALID_PARAM -2
+#define RCS_LOG_DROPPED -3   // FIFO空间不足或正被打断的写入占用，本条记录已丢弃并计数
+
+/* 宏定义 -----------------------------------------------------*/
+
+#define RCS_LOG_LEVEL_DEBUG 0
+#define RCS_LOG_LEVEL_INFO  1
+#define RCS_LOG_LEVEL_WARN  2
+#define RCS_LOG_LEVEL_ERROR 3
+
+// 低于该等级的调用在编译期去除
+#ifndef RCS_LOG_LEVEL
+#define RCS_LOG_LEVEL RCS_LOG_LEVEL_DEBUG
+#endif
+
+#define RCS_LOG_MAX_ARGS 8
+
+/*
+ * 格式串存放在rcslog段中，编号为其相对段起点的偏移。主机端使用默认链接脚本时该段随程序加载；
+ * MCU上可将其放入不占用Flash的INFO段，编号不变，解码器仍从ELF中读取：
+ *   .rcslog 0 (INFO) : { __start_rcslog = .; KEEP(*(rcslog)) }
+ */
+#define RCS_LOG_SECTION "rcslog"
+
+/*
+ * 记录格式（小端32位字）：| 头 | 时间戳 | 参数0 | ... |
+ * 头：bit0~23为格式串编号，bit24~27为参数个数，bit28~29为等级
+ */
+#define RCS_LOG_ID_MASK    0x00FFFFFFu
+#define RCS_LOG_ID_DROPPED RCS_LOG_ID_MASK   // 丢弃标记，唯一的参数为此前连续丢弃的记录数
+#define RCS_LOG_HEADER(level, id, count) \
+    (((uint32_t)(id) & RCS_LOG_ID_MASK) | ((uint32_t)(count) << 24) | ((uint32_t)(level) << 28))
+#define RCS_LOG_HEADER_ID(header)    ((header) & RCS_LOG_ID_MASK)
+#define RCS_LOG_HEADER_COUNT(header) (((header) >> 24) & 0x0F)
+#define RCS_LOG_HEADER_LEVEL(header) (((header) >> 28) & 0x03)
+
+extern const char __start_rcslog[];
+
+#define RCS_LOG_ID(fmt) ((uint32_t)((uintptr_t)(fmt) - (uintptr_t)__start_rcslog))
+
+// 参数按32位字保存：整数截断为32位，float/double保存为float的位模式，对应格式串中的%f/%e/%g
+#ifndef __cplusplus
+static inline uint32_t RcsLogArgInt(uint32_t value)
+{
+    return value;
+}
+
+static inline uint32_t RcsLogArgFloat(double value)
+{
+    float f = (float)value;
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+#define RCS_LOG_ARG(x) _Generic((x), float: RcsLogArgFloat, double: RcsLogArgFloat, default: RcsLogArgInt)(x)
+#else
+#define RCS_LOG_ARG(x) RcsLogArg(x)
+#endif
+
+// 第一个参数为格式串，其后为参数
+#define RCS_LOG_NARG(...) RCS_LOG_NARG_(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0, 0)
+#define RCS_LOG_NARG_(f, _1, _2, _3, _4, _5, _6, _7, _8, n, ...) n
+#define RCS_LOG_FIRST(...) RCS_LOG_FIRST_(__VA_ARGS__, 0)
+#define RCS_LOG_FIRST_(f, ...) f
+#define RCS_LOG_CAT(a, b) RCS_LOG_CAT_(a, b)
+#define RCS_LOG_CAT_(a, b) a##b
+
+#define RCS_LOG_MAP_0(f)
+#define RCS_LOG_MAP_1(f, a) , RCS_LOG_ARG(a)
+#define RCS_LOG_MAP_2(f, a, b) , RCS_LOG_ARG(a), RCS_LOG_ARG(b)
+#define RCS_LOG_MAP_3(f, a, b, c) , RCS_LOG_ARG(a), RCS_LOG_ARG(b), RCS_LOG_ARG(c)
+#define RCS_LOG_MAP_4(f, a, b, c, d) RCS_LOG_MAP_3(f, a, b, c), RCS_LOG_ARG(d)
+#define RCS_LOG_MAP_5(f, a, b, c, d, e) RCS_LOG_MAP_4(f, a, b, c, d), RCS_LOG_ARG(e)
+#define RCS_LOG_MAP_6(f, a, b, c, d, e, g) RCS_LOG_MAP_5(f, a, b, c, d, e), RCS_LOG_ARG(g)
+#define RCS_LOG_MAP_7(f, a, b, c, d, e, g, h) RCS_LOG_MAP_6(f, a, b, c, d, e, g), RCS_LOG_ARG(h)
+#define RCS_LOG_MAP_8(f, a, b, c, d, e, g, h, i) RCS_LOG_MAP_7(f, a, b, c, d, e, g, h), RCS_LOG_ARG(i)
+
+/**
+ * @brief 写入一条日志，格式串须为字符串字面量，参数至多RCS_LOG_MAX_ARGS个
+ * @note 用法：RCS_LOG(&log, RCS_LOG_LEVEL_INFO, "adc=%u temp=%.1f", raw, temp)；不支持%s
+ */
+#define RCS_LOG(log, level, ...) do { \
+    if ((level) >= RCS_LOG_LEVEL) { \
+        static const char rcsLogFmt[] __attribute__((section(RCS_LOG_SECTION), used)) = RCS_LOG_FIRST(__VA_ARGS__); \
+        const uint32_t rcsLogArgs[] = {0 RCS_LOG_CAT(RCS_LOG_MAP_, RCS_LOG_NARG(__VA_ARGS__))(__VA_ARGS__)}; \
+        RcsLogWrite((log), RCS_LOG_HEADER((level), RCS_LOG_ID(rcsLogFmt), RCS_LOG_NARG(__VA_ARGS__)), \
+                    rcsLogArgs + 1, RCS_LOG_NARG(__VA_ARGS__)); \
+    } \
+} while (0)
+
+#define RCS_LOGD(log, ...) RCS_LOG(log, RCS_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define RCS_LOGI(log, ...) RCS_LOG(log, RCS_LOG_LEVEL_INFO, __VA_ARGS__)
+#define RCS_LOGW(log, ...) RCS_LOG(log, RCS_LOG_LEVEL_WARN, __VA_ARGS__)
+#define RCS_LOGE(log, ...) RCS_LOG(log, RCS_LOG_LEVEL_ERROR, __VA_ARGS__)
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 日志通道，FIFO的发送方
+ * @note 写入在FIFO的发送申请中完成，中断打断另一条正在写入的记录时，中断中的记录会被丢弃而不会破坏数据，
+ *       因此任务与任意中断都可直接调用；丢弃的条数在下一条成功的记录前以丢弃标记写入
+ */
+typedef struct
+{
+    RcsFifo_t fifo;
+    uint32_t  dropCount;      // 累计丢弃的记录数
+    uint32_t  dropReported;   // 已写入丢弃标记的记录数
+}RcsLog_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+int RcsLogInit(RcsLog_t *log, RcsFifo_t fifo);
+int RcsLogWrite(RcsLog_t *log, uint32_t header, const uint32_t *args, size_t count);
+uint32_t RcsLogGetDropCount(const RcsLog_t *log);
+
+#ifdef __cplusplus
+}
+
+// 本头文件可能在其他头文件的extern "C"块中被包含
+extern "C++" {
+static inline uint32_t RcsLogArg(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline uint32_t RcsLogArg(double value)
+{
+    return RcsLogArg((float)value);
+}
+
+template <typename T>
+static inline uint32_t RcsLogArg(T value)
+{
+    return (uint32_t)value;
+}
+}
+#endif
@@ -0,0 +1,61 @@
+/**
+ * @file binlog_decode.h
+ * @brief 二进制日志的主机端解码：从ELF的rcslog段或导出的字典加载格式串，解析记录并离线格式化
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "binlog.h"
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_LOG_NEED_MORE -4    // 数据不足一条完整的记录
+#define RCS_LOG_UNKNOWN_ID -5   // 字典中没有该编号，通常是字典与固件不匹配
+#define RCS_LOG_NOT_FOUND -6    // 文件无法读取，或ELF中没有rcslog段
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 格式串字典，即rcslog段的内容
+ */
+typedef struct
+{
+    char   *strings;
+    size_t  size;
+}RcsLogDict_t;
+
+/**
+ * @brief 解析出的一条记录
+ */
+typedef struct
+{
+    uint32_t id;
+    uint32_t timestamp;
+    uint8_t  level;
+    uint8_t  count;
+    uint32_t args[RCS_LOG_MAX_ARGS];
+}RcsLogRecord_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+int RcsLogDictLoadElf(RcsLogDict_t *dict, const char *path);
+int RcsLogDictLoadRaw(RcsLogDict_t *dict, const char *path);
+void RcsLogDictFree(RcsLogDict_t *dict);
+const char *RcsLogDictLookup(const RcsLogDict_t *dict, uint32_t id);
+int RcsLogParse(const void *data, size_t size, RcsLogRecord_t *record);
+int RcsLogFormat(const RcsLogDict_t *dict, const RcsLogRecord_t *record, char *out, size_t outSize);
+
+#ifdef __cplusplus
+}
+#endif
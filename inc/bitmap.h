@@ -0,0 +1,85 @@
+/**
+ * @file bitmap.h
+ * @brief 带多级摘要的位图，查找第一个置位/清零位只需逐层各一次CTZ，可用于编号分配
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/* 系统调用 ---------------------------------------------------*/
+
+#define BitmapPortMalloc malloc
+#define BitmapPortFree   free
+#define BitmapPortCtz32(x) __builtin_ctz(x)   // Cortex-M3及以上编译为RBIT+CLZ
+#define BitmapPortPopcount32(x) __builtin_popcount(x)
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_BITMAP_OK 0
+#define RCS_BITMAP_ERROR -1
+#define RCS_BITMAP_INVALID_PARAM -2
+#define RCS_BITMAP_NOT_FOUND -3
+
+/* 宏定义 -----------------------------------------------------*/
+
+// 含位图本身在内的层数，每层一个字概括下一层的32个字
+#define RCS_BITMAP_LEVELS 4
+#define RCS_BITMAP_MAX_BITS (1u << (5 * RCS_BITMAP_LEVELS))
+
+#define RCS_BITMAP_WORDS(bits) (((bits) + 31) / 32)
+
+// 静态创建时所需的字数：位图本身 + 置位摘要与清零摘要各三层
+#define RCS_BITMAP_MEM_WORDS(bits) \
+    (RCS_BITMAP_WORDS(bits) + 2 * (RCS_BITMAP_WORDS(RCS_BITMAP_WORDS(bits)) + \
+     RCS_BITMAP_WORDS(RCS_BITMAP_WORDS(RCS_BITMAP_WORDS(bits))) + 1))
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 位图对象
+ */
+typedef void* RcsBitmap_t;
+
+/**
+ * @brief 位图实例
+ * @note summary[0]的每一位表示下一层对应字中存在置位，summary[1]表示存在清零位；
+ *       不加锁，只能在单一上下文中使用
+ */
+typedef struct
+{
+    uint32_t *bits;
+    uint32_t *summary[2][RCS_BITMAP_LEVELS - 1];
+    uint32_t  wordCount;
+    uint32_t  bitCount;
+    uint32_t  setCount;
+}RcsBitmapHandle_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+RcsBitmap_t RcsBitmapCreateStatic(size_t bitCount, RcsBitmapHandle_t *staticHandle, uint32_t *bitmapMemory);
+RcsBitmap_t RcsBitmapCreate(size_t bitCount);
+void RcsBitmapDestroy(RcsBitmap_t bitmap);
+int RcsBitmapSet(RcsBitmap_t bitmap, size_t index);
+int RcsBitmapClear(RcsBitmap_t bitmap, size_t index);
+int RcsBitmapIsSet(RcsBitmap_t bitmap, size_t index);
+int RcsBitmapSetRange(RcsBitmap_t bitmap, size_t start, size_t count);
+int RcsBitmapClearRange(RcsBitmap_t bitmap, size_t start, size_t count);
+int RcsBitmapFindFirstSet(RcsBitmap_t bitmap);
+int RcsBitmapFindFirstClear(RcsBitmap_t bitmap);
+int RcsBitmapAlloc(RcsBitmap_t bitmap);
+size_t RcsBitmapGetSetCount(RcsBitmap_t bitmap);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,98 @@
+/**
+ * @file block_pool.h
+ * @brief 固定块内存池，O(1)申请与释放，可作为FIFO的分配器
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+#include "rcs_allocator.h"
+
+/* 系统调用 ---------------------------------------------------*/
+
+#define PoolPortMalloc malloc
+#define PoolPortFree   free
+#if defined(__linux__)
+// 与FIFO的临界区一致：主机端由每个内存池自己的互斥锁实现
+#define PoolPortEnterCriticalFromAll(handle) pthread_mutex_lock(&(handle)->hostLock)
+#define PoolPortExitCriticalFromAll(handle) pthread_mutex_unlock(&(handle)->hostLock)
+#else
+#define PoolPortEnterCriticalFromAll(handle) do { (void)(handle); } while (0)
+#define PoolPortExitCriticalFromAll(handle) do { (void)(handle); } while (0)
+#endif
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_POOL_OK 0
+#define RCS_POOL_ERROR -1
+#define RCS_POOL_INVALID_PARAM -2
+
+/* 宏定义 -----------------------------------------------------*/
+
+#define RCS_POOL_ALIGN sizeof(void *)
+
+// 块大小按指针对齐，且至少能容纳一个空闲链表指针
+#define RCS_POOL_BLOCK_SIZE(size) \
+    ((((size) < sizeof(void *) ? sizeof(void *) : (size)) + RCS_POOL_ALIGN - 1) & ~(RCS_POOL_ALIGN - 1))
+
+// 已分配位图的字数，每个块一位，用于O(1)拒绝重复释放
+#define RCS_POOL_BITMAP_WORDS(blockCount) (((blockCount) + 31) / 32)
+
+// 静态创建时所需的内存池大小，块之后紧跟已分配位图
+#define RCS_POOL_MEM_SIZE(blockSize, blockCount) \
+    (RCS_POOL_BLOCK_SIZE(blockSize) * (blockCount) + RCS_POOL_BITMAP_WORDS(blockCount) * sizeof(uint32_t))
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 内存池对象
+ */
+typedef void* RcsPool_t;
+
+/**
+ * @brief 内存池实例
+ * @note 空闲块通过块内的指针串成侵入式链表；从未分配过的块由nextUnused顺序切出，
+ *       因此创建时无需遍历整个内存池，只需清零每块一位的已分配位图
+ */
+typedef struct
+{
+    uint8_t *mem;
+    size_t   blockSize;
+    size_t   blockCount;
+    size_t   freeCount;
+    size_t   nextUnused;
+    void    *freeList;
+    uint32_t *allocated;             // 已分配位图，位于块之后
+#if defined(__linux__)
+    pthread_mutex_t hostLock;
+#endif
+}RcsPoolHandle_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+RcsPool_t RcsPoolCreateStatic(size_t blockSize, size_t blockCount, RcsPoolHandle_t *staticHandle, uint8_t *poolMemory);
+RcsPool_t RcsPoolCreate(size_t blockSize, size_t blockCount);
+void RcsPoolDestroy(RcsPool_t pool);
+void *RcsPoolAlloc(RcsPool_t pool);
+int RcsPoolFree(RcsPool_t pool, void *block);
+size_t RcsPoolGetFree(RcsPool_t pool);
+int RcsPoolGetAllocator(RcsPool_t pool, RcsAllocator_t *allocator);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,80 @@
+/**
+ * @file byte_scan.h
+ * @brief 在内存块与FIFO两段视图上查找字节或字节集合（主机端SSE2/AVX2/NEON，MCU上按字SWAR），
+ *        以及以零拷贝视图交付整行的行读取器
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "siso_fifo.h"
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_LINE_OK 0
+#define RCS_LINE_ERROR -1
+#define RCS_LINE_INVALID_PARAM -2
+#define RCS_LINE_NONE -3       // 还没有完整的一行
+#define RCS_LINE_TOO_LONG -4   // 超过最大行长仍未遇到分隔符，该行已丢弃，其余部分到达后也会被丢弃
+
+/* 宏定义 -----------------------------------------------------*/
+
+// 为0时只使用SWAR实现
+#ifndef RCS_SCAN_USE_SIMD
+#define RCS_SCAN_USE_SIMD 1
+#endif
+
+// 字节集合不超过该数量时走向量/SWAR比较，否则逐字节查表
+#define RCS_BYTESET_FAST_MAX 4
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 字节集合，如"\r\n"或",*"
+ */
+typedef struct
+{
+    uint32_t bits[8];                       // 256位成员表
+    uint8_t  bytes[RCS_BYTESET_FAST_MAX];   // 成员较少时的列表，不足的位置重复第一个成员
+    uint8_t  count;
+}RcsByteSet_t;
+
+/**
+ * @brief 行读取器，作为FIFO唯一的接收方
+ */
+typedef struct
+{
+    RcsFifo_t fifo;
+    size_t    maxLine;     // 不含分隔符的最大行长
+    size_t    scanned;     // 上次已扫描过、不含分隔符的字节数，避免重复扫描
+    size_t    consumed;    // 当前行连同分隔符的长度，释放时使用
+    void     *memAcquired[2];
+    uint32_t  overruns;    // 上次读取时FIFO的覆盖计数，变化说明未读数据已被丢弃
+    uint8_t   delim;
+    uint8_t   discarding;  // 超长行已报告但分隔符尚未到达，丢弃到分隔符（含）为止
+}RcsLineReader_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+int RcsByteSetInit(RcsByteSet_t *set, const void *bytes, size_t count);
+size_t RcsMemFindByte(const void *data, size_t size, uint8_t byte);
+size_t RcsMemFindSet(const void *data, size_t size, const RcsByteSet_t *set);
+size_t RcsFifoViewFindByte(const RcsFifoView_t *view, size_t offset, uint8_t byte);
+size_t RcsFifoViewFindSet(const RcsFifoView_t *view, size_t offset, const RcsByteSet_t *set);
+int RcsLineReaderInit(RcsLineReader_t *reader, RcsFifo_t fifo, uint8_t delim, size_t maxLine);
+int RcsLineRead(RcsLineReader_t *reader, RcsFifoView_t *line);
+int RcsLineRelease(RcsLineReader_t *reader);
+
+#ifdef __cplusplus
+}
+#endif
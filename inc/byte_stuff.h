@@ -0,0 +1,70 @@
+/**
+ * @file byte_stuff.h
+ * @brief COBS与SLIP字节填充编解码：编码直接写入FIFO的发送申请区域，解码在接收视图上增量进行
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "siso_fifo.h"
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_STUFF_OK 0            // 输入已用完，帧尚未结束
+#define RCS_STUFF_FRAME 1         // 解出一帧
+#define RCS_STUFF_ERROR -1
+#define RCS_STUFF_INVALID_PARAM -2
+#define RCS_STUFF_NO_SPACE -3
+#define RCS_STUFF_BAD_FRAME -4    // 帧格式错误或超长，已丢弃，解码器已复位
+
+/* 宏定义 -----------------------------------------------------*/
+
+// 编码后的最大长度（含帧定界符），编码时按此大小申请，完成时只提交实际长度
+#define RCS_COBS_MAX_ENCODED(size) ((size) + (size) / 254 + 2)
+#define RCS_SLIP_MAX_ENCODED(size) (2 * (size) + 2)
+
+#define RCS_SLIP_END     0xC0
+#define RCS_SLIP_ESC     0xDB
+#define RCS_SLIP_ESC_END 0xDC
+#define RCS_SLIP_ESC_ESC 0xDD
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 增量解码器，COBS与SLIP共用
+ */
+typedef struct
+{
+    uint8_t *out;
+    size_t   outSize;
+    size_t   len;        // 当前帧已解出的长度，返回RCS_STUFF_FRAME时即帧长
+    uint8_t  code;       // COBS：当前块的编码字节
+    uint8_t  remain;     // COBS：当前块剩余的数据字节
+    uint8_t  escaped;    // SLIP：上一个字节为ESC
+    uint8_t  started;    // 已收到本帧的第一个字节
+    uint8_t  broken;     // 本帧已出错，丢弃直到下一个定界符
+}RcsStuffDecoder_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+int RcsCobsEncodeToFifo(RcsFifo_t fifo, const void *data, size_t size);
+int RcsSlipEncodeToFifo(RcsFifo_t fifo, const void *data, size_t size);
+int RcsStuffDecoderInit(RcsStuffDecoder_t *decoder, uint8_t *out, size_t outSize);
+int RcsCobsDecode(RcsStuffDecoder_t *decoder, const RcsFifoView_t *view, size_t *consumed);
+int RcsSlipDecode(RcsStuffDecoder_t *decoder, const RcsFifoView_t *view, size_t *consumed);
+int RcsCobsDecodeFromFifo(RcsStuffDecoder_t *decoder, RcsFifo_t fifo);
+int RcsSlipDecodeFromFifo(RcsStuffDecoder_t *decoder, RcsFifo_t fifo);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,145 @@
+/**
+ * @file can_queue.h
+ * @brief 定长槽的CAN/CAN-FD帧队列，单生产者单消费者无锁，中断内入队只需一次比较和一次发布，接收方批量取出
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/* 系统调用 ---------------------------------------------------*/
+
+#define CanPortMalloc malloc
+#define CanPortFree   free
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_CAN_OK 0
+#define RCS_CAN_ERROR -1
+#define RCS_CAN_INVALID_PARAM -2
+#define RCS_CAN_FULL -3
+
+/* 宏定义 -----------------------------------------------------*/
+
+// 帧标志
+#define RCS_CAN_FLAG_EXT 0x01   // 29位扩展帧
+#define RCS_CAN_FLAG_RTR 0x02   // 远程帧
+#define RCS_CAN_FLAG_FDF 0x04   // CAN-FD帧
+#define RCS_CAN_FLAG_BRS 0x08   // CAN-FD位速率切换
+#define RCS_CAN_FLAG_ESI 0x10   // CAN-FD错误状态指示
+
+// 槽大小，创建队列时二选一
+#define RCS_CAN_SLOT_CLASSIC sizeof(RcsCanFrame_t)
+#define RCS_CAN_SLOT_FD      sizeof(RcsCanFdFrame_t)
+
+// 槽内存大小，depth必须为2的幂
+#define RCS_CAN_QUEUE_MEM_SIZE(depth, slotSize) ((depth) * (slotSize))
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 经典CAN帧，16字节
+ */
+typedef struct
+{
+    uint32_t id;          // 11位或29位标识符
+    uint16_t timestamp;   // 控制器的16位硬件时间戳
+    uint8_t  len;         // 数据长度，单位为字节
+    uint8_t  flags;       // RCS_CAN_FLAG_*
+    uint8_t  data[8];
+}RcsCanFrame_t;
+
+/**
+ * @brief CAN-FD帧，72字节，前8字节与RcsCanFrame_t相同
+ */
+typedef struct
+{
+    uint32_t id;
+    uint16_t timestamp;
+    uint8_t  len;
+    uint8_t  flags;
+    uint8_t  data[64];
+}RcsCanFdFrame_t;
+
+/**
+ * @brief 批量取出时逐帧调用的回调
+ * @param frame 帧，指向队列槽内存，FD队列可转换为RcsCanFdFrame_t
+ * @param arg 用户参数
+ */
+typedef void (*RcsCanDrainCallback_t)(const RcsCanFrame_t *frame, void *arg);
+
+/**
+ * @brief CAN帧队列对象
+ */
+typedef void* RcsCanQueue_t;
+
+/**
+ * @brief CAN帧队列实例
+ * @note head只由接收方写，tail只由发送方（通常为CAN接收中断）写，二者均为自由递增计数，
+ *       槽永不跨越回绕，因此无需临界区
+ */
+typedef struct
+{
+    uint8_t  *slots;
+    uint32_t  slotSize;
+    uint32_t  mask;
+    uint32_t  head;
+    uint32_t  tail;
+    uint32_t  overrunCount;   // 队列满时丢弃的帧数
+}RcsCanQueueHandle_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+RcsCanQueue_t RcsCanQueueCreateStatic(size_t depth, size_t slotSize, RcsCanQueueHandle_t *staticHandle, uint8_t *slotMemory);
+RcsCanQueue_t RcsCanQueueCreate(size_t depth, size_t slotSize);
+void RcsCanQueueDestroy(RcsCanQueue_t queue);
+int RcsCanQueuePush(RcsCanQueue_t queue, const RcsCanFrame_t *frame);
+size_t RcsCanQueueRecvAcquire(RcsCanQueue_t queue, const RcsCanFrame_t **frames);
+void RcsCanQueueRecvComplete(RcsCanQueue_t queue, size_t count);
+size_t RcsCanQueueDrain(RcsCanQueue_t queue, RcsCanDrainCallback_t callback, void *arg);
+size_t RcsCanQueueGetCount(RcsCanQueue_t queue);
+uint32_t RcsCanQueueGetOverrun(RcsCanQueue_t queue);
+uint8_t RcsCanDlcToLen(uint8_t dlc);
+uint8_t RcsCanLenToDlc(uint8_t len);
+
+/**
+ * @brief 申请下一个空槽，中断可直接把控制器邮箱读入其中，再调用RcsCanQueuePushCommit发布
+ * @param queue 队列句柄
+ * @return 返回槽地址，队列满时返回NULL并累加溢出计数
+ * @note 只允许唯一的发送方调用，内联到调用处
+ */
+static inline RcsCanFrame_t *RcsCanQueuePushAcquire(RcsCanQueue_t queue)
+{
+    RcsCanQueueHandle_t *handle = (RcsCanQueueHandle_t *)queue;
+    uint32_t tail = handle->tail;
+
+    if (tail - __atomic_load_n(&handle->head, __ATOMIC_ACQUIRE) > handle->mask) {
+        handle->overrunCount++;
+        return NULL;
+    }
+    return (RcsCanFrame_t *)(handle->slots + (size_t)(tail & handle->mask) * handle->slotSize);
+}
+
+/**
+ * @brief 发布由RcsCanQueuePushAcquire申请的槽
+ * @param queue 队列句柄
+ */
+static inline void RcsCanQueuePushCommit(RcsCanQueue_t queue)
+{
+    RcsCanQueueHandle_t *handle = (RcsCanQueueHandle_t *)queue;
+    __atomic_store_n(&handle->tail, handle->tail + 1, __ATOMIC_RELEASE);
+}
+
+#ifdef __cplusplus
+}
+#endif
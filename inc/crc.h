@@ -0,0 +1,69 @@
+/**
+ * @file crc.h
+ * @brief CRC8/CRC16/CRC32计算，查表与slice-by-8实现，主机端可用PCLMUL/ARMv8 CRC指令，支持硬件CRC外设钩子，
+ *        可直接在FIFO两段视图上增量计算
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "siso_fifo.h"
+
+/* 系统调用 ---------------------------------------------------*/
+
+/*
+ * 若MCU带有可配置为反射输入/输出的CRC外设（如STM32F7/L4/G4/H7），可定义CrcPortHwCrc32，
+ * 参数为取反后的内部状态、数据与长度，返回更新后的内部状态，与软件实现的约定一致：
+ * #define CrcPortHwCrc32(state, data, size) Stm32CrcUpdate(state, data, size)
+ */
+
+/* 宏定义 -----------------------------------------------------*/
+
+// 为0时CRC32只用256项单表，节省7KB只读存储
+#ifndef RCS_CRC32_SLICE_BY_8
+#define RCS_CRC32_SLICE_BY_8 1
+#endif
+
+// 为0时CRC16只用256项单表，节省3.5KB只读存储；CRC8只用于短报文头，始终为单表
+#ifndef RCS_CRC16_SLICE_BY_8
+#define RCS_CRC16_SLICE_BY_8 1
+#endif
+
+// 主机端是否在运行时检测并使用PCLMULQDQ折叠
+#ifndef RCS_CRC32_USE_PCLMUL
+#define RCS_CRC32_USE_PCLMUL 1
+#endif
+
+/*
+ * 各算法的初值，作为第一次Update的crc参数，之后传入上一次的返回值即可续算：
+ * CRC8        多项式0x07，初值0x00，不反射，无结果异或（SMBus）
+ * CRC16       多项式0x1021，初值0xFFFF，不反射，无结果异或（CCITT-FALSE）
+ * CRC32       多项式0x04C11DB7，反射，初值与结果异或均为0xFFFFFFFF（IEEE 802.3），
+ *             返回值已是最终结果，与zlib的crc32()用法相同
+ */
+#define RCS_CRC8_INIT  0x00u
+#define RCS_CRC16_INIT 0xFFFFu
+#define RCS_CRC32_INIT 0x00000000u
+
+/* 导出函数 ---------------------------------------------------*/
+
+uint8_t RcsCrc8Update(uint8_t crc, const void *data, size_t size);
+uint16_t RcsCrc16Update(uint16_t crc, const void *data, size_t size);
+uint32_t RcsCrc32Update(uint32_t crc, const void *data, size_t size);
+uint8_t RcsCrc8View(uint8_t crc, const RcsFifoView_t *view);
+uint16_t RcsCrc16View(uint16_t crc, const RcsFifoView_t *view);
+uint32_t RcsCrc32View(uint32_t crc, const RcsFifoView_t *view);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,101 @@
+/**
+ * @file dary_heap.h
+ * @brief 带索引的d叉最小堆优先队列，按编号进行O(log n)的降键与删除，用于按截止时间调度发送
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/* 系统调用 ---------------------------------------------------*/
+
+#define HeapPortMalloc malloc
+#define HeapPortFree   free
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_HEAP_OK 0
+#define RCS_HEAP_ERROR -1
+#define RCS_HEAP_INVALID_PARAM -2
+#define RCS_HEAP_EMPTY -3
+#define RCS_HEAP_NOT_FOUND -4
+
+/* 宏定义 -----------------------------------------------------*/
+
+#define RCS_HEAP_NIL 0xFFFFFFFFu
+#define RCS_HEAP_MAX_ARITY 8
+
+// 堆数组按缓存行对齐，Cortex-M7等32字节缓存行的平台可改为32
+#ifndef RCS_HEAP_CACHE_LINE
+#define RCS_HEAP_CACHE_LINE 64
+#endif
+
+// 静态创建时所需的内存大小：对齐余量 + 堆数组（含根节点前的填充）+ 位置表
+#define RCS_HEAP_MEM_SIZE(capacity) \
+    (RCS_HEAP_CACHE_LINE + ((capacity) + RCS_HEAP_MAX_ARITY - 1) * sizeof(RcsHeapEntry_t) + \
+     (capacity) * sizeof(uint32_t))
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 优先级键，数值越小越先出队
+ */
+typedef uint32_t RcsHeapKey_t;
+
+/**
+ * @brief 堆节点，键与编号放在一起，比较子节点时不必再按编号查键
+ */
+typedef struct
+{
+    RcsHeapKey_t key;
+    uint32_t     id;
+}RcsHeapEntry_t;
+
+/**
+ * @brief 堆对象
+ */
+typedef void* RcsHeap_t;
+
+/**
+ * @brief 堆实例
+ * @note 元素以[0, capacity)内的编号标识，由调用者分配（例如会话下标或槽表索引）；
+ *       根节点前填充arity-1个节点，使节点i的子节点组从缓存行内arity个节点的边界开始，
+ *       4叉堆的每组子节点落在同一缓存行内，层数减半，通常优于2叉堆
+ */
+typedef struct
+{
+    RcsHeapEntry_t *heap;   // 堆数组，heap[0]为根
+    uint32_t       *pos;    // 编号 -> 堆数组位置，不在堆中为RCS_HEAP_NIL
+    uint8_t        *mem;    // 创建时传入或申请的内存
+    uint32_t        capacity;
+    uint32_t        count;
+    uint32_t        arity;
+}RcsHeapHandle_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+RcsHeap_t RcsHeapCreateStatic(size_t arity, size_t capacity, RcsHeapHandle_t *staticHandle, uint8_t *heapMemory);
+RcsHeap_t RcsHeapCreate(size_t arity, size_t capacity);
+void RcsHeapDestroy(RcsHeap_t heap);
+int RcsHeapPush(RcsHeap_t heap, uint32_t id, RcsHeapKey_t key);
+int RcsHeapPeek(RcsHeap_t heap, uint32_t *id, RcsHeapKey_t *key);
+int RcsHeapPop(RcsHeap_t heap, uint32_t *id, RcsHeapKey_t *key);
+int RcsHeapDecreaseKey(RcsHeap_t heap, uint32_t id, RcsHeapKey_t key);
+int RcsHeapUpdate(RcsHeap_t heap, uint32_t id, RcsHeapKey_t key);
+int RcsHeapRemove(RcsHeap_t heap, uint32_t id);
+int RcsHeapContains(RcsHeap_t heap, uint32_t id);
+size_t RcsHeapGetCount(RcsHeap_t heap);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,195 @@
+/**
+ * @file dary_heap.hpp
+ * @brief 带索引的d叉堆的C++模板版本：键类型、比较器、叉数与容量均在编译期确定，存储内嵌于对象
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace rcs {
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 带索引的d叉堆，Compare(a, b)为真表示a先出队，默认为最小堆
+ * @note 与dary_heap.h语义与布局一致：元素以[0, Capacity)内的编号标识，支持按编号降键/删除；
+ *       键与编号一起存放，根节点前填充Arity-1个节点，使每组子节点从缓存行内的组边界开始
+ */
+template <typename Key, size_t Capacity, size_t Arity = 4, typename Compare = std::less<Key>>
+class IndexedHeap
+{
+    static_assert(Arity >= 2, "arity must be at least 2");
+    static_assert(Capacity > 0 && Capacity < UINT32_MAX, "capacity out of range");
+
+public:
+    using Id = uint32_t;
+    static constexpr Id npos = UINT32_MAX;
+
+    static constexpr size_t cacheLine = 64;
+
+    IndexedHeap() { pos_.fill(npos); }
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    static constexpr size_t capacity() { return Capacity; }
+
+    bool contains(Id id) const { return id < Capacity && pos_[id] != npos; }
+    // 调用前需保证元素在堆中
+    const Key &key(Id id) const { return at(pos_[id]).key; }
+
+    // 队首元素的编号，调用前需保证非空
+    Id top() const { return at(0).id; }
+    const Key &topKey() const { return at(0).key; }
+
+    bool push(Id id, const Key &key)
+    {
+        if (id >= Capacity || pos_[id] != npos) {
+            return false;
+        }
+        at(count_) = Entry{key, id};
+        siftUp(count_++);
+        return true;
+    }
+
+    bool pop(Id &id, Key &key)
+    {
+        if (count_ == 0) {
+            return false;
+        }
+        id = at(0).id;
+        key = at(0).key;
+        removeAt(0);
+        return true;
+    }
+
+    // 新键不得比原键更晚出队
+    bool decreaseKey(Id id, const Key &key)
+    {
+        if (!contains(id) || less_(at(pos_[id]).key, key)) {
+            return false;
+        }
+        at(pos_[id]).key = key;
+        siftUp(pos_[id]);
+        return true;
+    }
+
+    bool update(Id id, const Key &key)
+    {
+        if (!contains(id)) {
+            return false;
+        }
+        Entry &entry = at(pos_[id]);
+        bool earlier = less_(key, entry.key);
+        entry.key = key;
+        if (earlier) {
+            siftUp(pos_[id]);
+        }
+        else {
+            siftDown(pos_[id]);
+        }
+        return true;
+    }
+
+    bool remove(Id id)
+    {
+        if (!contains(id)) {
+            return false;
+        }
+        removeAt(pos_[id]);
+        return true;
+    }
+
+    void clear()
+    {
+        for (size_t i = 0; i < count_; i++) {
+            pos_[at(i).id] = npos;
+        }
+        count_ = 0;
+    }
+
+private:
+    struct Entry
+    {
+        Key key;
+        Id  id;
+    };
+
+    // 逻辑下标index对应的节点，根节点之前有Arity-1个填充节点
+    Entry &at(size_t index) { return heap_[index + Arity - 1]; }
+    const Entry &at(size_t index) const { return heap_[index + Arity - 1]; }
+
+    void place(size_t index, const Entry &entry)
+    {
+        at(index) = entry;
+        pos_[entry.id] = static_cast<Id>(index);
+    }
+
+    void siftUp(size_t index)
+    {
+        Entry entry = at(index);
+        while (index > 0) {
+            size_t parent = (index - 1) / Arity;
+            if (!less_(entry.key, at(parent).key)) {
+                break;
+            }
+            place(index, at(parent));
+            index = parent;
+        }
+        place(index, entry);
+    }
+
+    void siftDown(size_t index)
+    {
+        Entry entry = at(index);
+        for (;;) {
+            size_t first = index * Arity + 1;
+            if (first >= count_) {
+                break;
+            }
+            size_t last = first + Arity < count_ ? first + Arity : count_;
+            size_t best = first;
+            for (size_t child = first + 1; child < last; child++) {
+                if (less_(at(child).key, at(best).key)) {
+                    best = child;
+                }
+            }
+            if (!less_(at(best).key, entry.key)) {
+                break;
+            }
+            place(index, at(best));
+            index = best;
+        }
+        place(index, entry);
+    }
+
+    void removeAt(size_t index)
+    {
+        pos_[at(index).id] = npos;
+        count_--;
+        if (index == count_) {
+            return;
+        }
+        place(index, at(count_));
+        if (index > 0 && less_(at(index).key, at((index - 1) / Arity).key)) {
+            siftUp(index);
+        }
+        else {
+            siftDown(index);
+        }
+    }
+
+    alignas(cacheLine) std::array<Entry, Capacity + Arity - 1> heap_{};
+    std::array<Id, Capacity> pos_{};
+    size_t count_ = 0;
+    [[no_unique_address]] Compare less_{};
+};
+
+} // namespace rcs
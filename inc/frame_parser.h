@@ -0,0 +1,74 @@
+/**
+ * @file frame_parser.h
+ * @brief 直接在FIFO两段视图上工作的流式帧解析器，帧格式为SOF+长度+负载+CRC16，出错后自动重新同步
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "siso_fifo.h"
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_FRAME_OK 0
+#define RCS_FRAME_ERROR -1
+#define RCS_FRAME_INVALID_PARAM -2
+#define RCS_FRAME_NO_SPACE -3
+
+/* 宏定义 -----------------------------------------------------*/
+
+/*
+ * 帧格式（多字节字段均为小端）：
+ * | SOF(1) | LEN(2) | PAYLOAD(LEN) | CRC16(2) |
+ * CRC16为CCITT-FALSE（多项式0x1021，初值0xFFFF），覆盖LEN与PAYLOAD
+ */
+#define RCS_FRAME_HEADER_SIZE 3
+#define RCS_FRAME_CRC_SIZE 2
+#define RCS_FRAME_OVERHEAD (RCS_FRAME_HEADER_SIZE + RCS_FRAME_CRC_SIZE)
+#define RCS_FRAME_DEFAULT_SOF 0xA5
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 收到完整帧时的回调
+ * @param payload 负载视图，直接指向FIFO内存，仅在回调期间有效
+ * @param arg 初始化时传入的参数
+ */
+typedef void (*RcsFrameCallback_t)(const RcsFifoView_t *payload, void *arg);
+
+/**
+ * @brief 解析器实例，作为FIFO唯一的接收方
+ */
+typedef struct
+{
+    RcsFifo_t          fifo;
+    RcsFrameCallback_t callback;
+    void              *arg;
+    size_t             maxPayload;
+    uint8_t            sof;
+    uint32_t           frameCount;
+    uint32_t           crcErrorCount;
+    uint32_t           lengthErrorCount;
+    uint32_t           discardCount;   // 重新同步时丢弃的字节数
+}RcsFrameParser_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+int RcsFrameParserInit(RcsFrameParser_t *parser, RcsFifo_t fifo, uint8_t sof, size_t maxPayload,
+                       RcsFrameCallback_t callback, void *arg);
+int RcsFrameParserPoll(RcsFrameParser_t *parser);
+int RcsFrameWrite(RcsFifo_t fifo, uint8_t sof, const void *payload, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
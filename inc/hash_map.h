@@ -0,0 +1,83 @@
+/**
+ * @file hash_map.h
+ * @brief 固定容量的Robin Hood开放寻址哈希表，以CAN标识符为键分发报文，查找的探测长度有上界
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/* 系统调用 ---------------------------------------------------*/
+
+#define HashPortMalloc malloc
+#define HashPortFree   free
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_HASH_OK 0
+#define RCS_HASH_ERROR -1
+#define RCS_HASH_INVALID_PARAM -2
+#define RCS_HASH_FULL -3
+#define RCS_HASH_NOT_FOUND -4
+
+/* 宏定义 -----------------------------------------------------*/
+
+// 最大探测长度，插入时超出则拒绝，因此查找最多访问这么多个槽
+#define RCS_HASH_MAX_PROBE 16
+
+// 静态创建时所需的槽数组大小
+#define RCS_HASH_MEM_SIZE(capacity) ((capacity) * sizeof(RcsHashEntry_t))
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 槽，dist为到理想位置的距离加1，为0表示空槽
+ */
+typedef struct
+{
+    uint32_t key;
+    uint32_t dist;
+    void    *value;
+}RcsHashEntry_t;
+
+/**
+ * @brief 哈希表对象
+ */
+typedef void* RcsHashMap_t;
+
+/**
+ * @brief 哈希表实例
+ * @note 查找只读，可在CAN接收中断中调用；插入与删除需在初始化阶段或关中断后进行
+ */
+typedef struct
+{
+    RcsHashEntry_t *entries;
+    uint32_t        mask;
+    uint32_t        shift;
+    uint32_t        count;
+}RcsHashMapHandle_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+RcsHashMap_t RcsHashMapCreateStatic(size_t capacity, RcsHashMapHandle_t *staticHandle, RcsHashEntry_t *entryMemory);
+RcsHashMap_t RcsHashMapCreate(size_t capacity);
+void RcsHashMapDestroy(RcsHashMap_t map);
+int RcsHashMapInsert(RcsHashMap_t map, uint32_t key, void *value);
+int RcsHashMapLookup(RcsHashMap_t map, uint32_t key, void **value);
+int RcsHashMapRemove(RcsHashMap_t map, uint32_t key);
+void RcsHashMapClear(RcsHashMap_t map);
+size_t RcsHashMapGetCount(RcsHashMap_t map);
+
+#ifdef __cplusplus
+}
+#endif
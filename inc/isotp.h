@@ -0,0 +1,147 @@
+/**
+ * @file isotp.h
+ * @brief ISO 15765-2（ISO-TP）分段与重组，接收的消息直接重组进FIFO的发送申请区域，
+ *        收发帧经CAN帧队列，流控超时与STmin节拍由时间轮驱动，会话全部静态分配
+ * @note 会话的所有调用（RcsIsoTpSend/RcsIsoTpOnFrame/RcsIsoTpReset）与驱动其定时器的RcsTimerWheelProcess
+ *       必须在同一个上下文中执行：发送帧队列是单生产者队列，会话状态也没有临界区保护；
+ *       接收中断只应把帧放入接收队列，由该上下文取出后调用RcsIsoTpOnFrame
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "siso_fifo.h"
+#include "can_queue.h"
+#include "timer_wheel.h"
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_ISOTP_OK 0
+#define RCS_ISOTP_ERROR -1
+#define RCS_ISOTP_INVALID_PARAM -2
+#define RCS_ISOTP_BUSY -3        // 上一条消息仍在发送
+#define RCS_ISOTP_NO_SPACE -4    // 发送帧队列已满
+#define RCS_ISOTP_NOT_MINE -5    // 帧的ID不属于本会话
+#define RCS_ISOTP_EMPTY -6       // FIFO中没有完整的消息
+
+/* 宏定义 -----------------------------------------------------*/
+
+// 时间轮一个节拍的微秒数，用于换算STmin
+#ifndef RCS_ISOTP_TICK_US
+#define RCS_ISOTP_TICK_US 1000
+#endif
+
+// N_WFTmax：发送方连续收到流控WAIT的最大次数，超过后以TX_ERROR放弃发送
+#ifndef RCS_ISOTP_WFT_MAX
+#define RCS_ISOTP_WFT_MAX 8
+#endif
+
+// 未使用的数据字节的填充值
+#define RCS_ISOTP_PADDING 0xCC
+
+// 重组后的消息在FIFO中的格式为 | LEN(4，小端) | PAYLOAD(LEN) |
+#define RCS_ISOTP_MSG_HEADER_SIZE 4
+
+/*
+ * 会话事件，通过回调通知：
+ * RX_DONE      一条消息已提交到接收FIFO
+ * TX_DONE      发送完成，发送缓冲区可以释放
+ * RX_TIMEOUT   等待连续帧超时（N_Cr），已重组的部分被丢弃
+ * RX_BAD_SEQ   连续帧序号错误，已重组的部分被丢弃
+ * RX_OVERFLOW  接收FIFO放不下整条消息，已回复流控OVFLW
+ * TX_TIMEOUT   等待流控帧超时（N_Bs）
+ * TX_OVERFLOW  对端回复流控OVFLW
+ * TX_ERROR     流控帧非法、连续WAIT超过RCS_ISOTP_WFT_MAX次或发送帧队列持续满
+ */
+#define RCS_ISOTP_EVENT_RX_DONE     0
+#define RCS_ISOTP_EVENT_TX_DONE     1
+#define RCS_ISOTP_EVENT_RX_TIMEOUT  2
+#define RCS_ISOTP_EVENT_RX_BAD_SEQ  3
+#define RCS_ISOTP_EVENT_RX_OVERFLOW 4
+#define RCS_ISOTP_EVENT_TX_TIMEOUT  5
+#define RCS_ISOTP_EVENT_TX_OVERFLOW 6
+#define RCS_ISOTP_EVENT_TX_ERROR    7
+
+/* 导出类型 ---------------------------------------------------*/
+
+typedef struct RcsIsoTpSession RcsIsoTpSession_t;
+
+/**
+ * @brief 会话事件回调，在RcsIsoTpOnFrame或时间轮处理的上下文中调用
+ * @param session 会话
+ * @param event RCS_ISOTP_EVENT_*
+ * @param arg 配置中的用户参数
+ */
+typedef void (*RcsIsoTpCallback_t)(RcsIsoTpSession_t *session, int event, void *arg);
+
+/**
+ * @brief 会话配置
+ */
+typedef struct
+{
+    uint32_t           txId;        // 本端发送使用的CAN ID
+    uint32_t           rxId;        // 本端接收的CAN ID
+    uint8_t            txFlags;     // 发送帧的RCS_CAN_FLAG_EXT等标志
+    uint8_t            blockSize;   // 本端作为接收方通告的BS，0表示不分块
+    uint8_t            stMin;       // 本端作为接收方通告的STmin，原始编码
+    uint16_t           timeout;     // N_Bs与N_Cr超时，单位为节拍
+    RcsFifo_t          rxFifo;      // 重组目标，本会话是其唯一的发送方
+    RcsCanQueue_t      txQueue;     // 发送帧队列，由CAN发送中断取出
+    RcsTimerWheel_t    wheel;
+    RcsIsoTpCallback_t callback;
+    void              *arg;
+}RcsIsoTpConfig_t;
+
+/**
+ * @brief 会话实例，由用户静态分配，收发方向各自独立，可同时进行
+ */
+struct RcsIsoTpSession
+{
+    RcsIsoTpConfig_t config;
+
+    // 接收方向：消息直接写入rxFifo的发送申请区域
+    void          *rxMem[2];
+    size_t         rxFirst;     // 申请区域第一段的长度
+    uint32_t       rxSize;      // 消息总长
+    uint32_t       rxOffset;    // 已重组的字节数
+    uint8_t        rxActive;
+    uint8_t        rxSn;
+    uint8_t        rxBlockCount;
+    RcsTimerNode_t rxTimer;
+
+    // 发送方向：数据由用户提供，TX_DONE之前保持有效
+    const uint8_t *txData;
+    uint32_t       txSize;
+    uint32_t       txOffset;
+    uint8_t        txState;
+    uint8_t        txSn;
+    uint8_t        txBlockRemain;
+    uint8_t        txWaitCount; // 连续收到的流控WAIT次数
+    uint16_t       txRetry;     // 发送帧队列满时已重试的节拍数
+    uint32_t       txGapTicks;  // 对端STmin换算的节拍数
+    RcsTimerNode_t txTimer;
+};
+
+/* 导出函数 ---------------------------------------------------*/
+
+int RcsIsoTpInit(RcsIsoTpSession_t *session, const RcsIsoTpConfig_t *config);
+void RcsIsoTpReset(RcsIsoTpSession_t *session);
+int RcsIsoTpSend(RcsIsoTpSession_t *session, const void *data, size_t size);
+int RcsIsoTpOnFrame(RcsIsoTpSession_t *session, const RcsCanFrame_t *frame);
+int RcsIsoTpIsSending(const RcsIsoTpSession_t *session);
+int RcsIsoTpMsgAcquire(RcsFifo_t fifo, RcsFifoView_t *payload, void *memAcquired[2]);
+int RcsIsoTpMsgRelease(RcsFifo_t fifo, void *memAcquired[2], size_t size);
+
+#ifdef __cplusplus
+}
+#endif
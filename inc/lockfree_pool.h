@@ -0,0 +1,99 @@
+/**
+ * @file lockfree_pool.h
+ * @brief 无锁固定块内存池，空闲链表为带版本号的Treiber栈，多个不同优先级的中断可同时申请而无需关中断
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/* 系统调用 ---------------------------------------------------*/
+
+#define LfPoolPortMalloc malloc
+#define LfPoolPortFree   free
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_LFPOOL_OK 0
+#define RCS_LFPOOL_ERROR -1
+#define RCS_LFPOOL_INVALID_PARAM -2
+
+/* 宏定义 -----------------------------------------------------*/
+
+// 栈顶 = 版本号 + 块下标，打包为一个机器字即可用单次CAS更新；
+// 64位主机上为32+32位，Cortex-M上为16+16位，由LDREX/STREX实现
+#if UINTPTR_MAX > 0xFFFFFFFFu
+typedef uint64_t RcsLfPoolHead_t;
+#define RCS_LFPOOL_INDEX_BITS 32
+#else
+typedef uint32_t RcsLfPoolHead_t;
+#define RCS_LFPOOL_INDEX_BITS 16
+#endif
+
+#define RCS_LFPOOL_NIL ((uint32_t)((((RcsLfPoolHead_t)1) << RCS_LFPOOL_INDEX_BITS) - 1))
+#define RCS_LFPOOL_MAX_BLOCKS RCS_LFPOOL_NIL
+
+#define RCS_LFPOOL_ALIGN sizeof(void *)
+#define RCS_LFPOOL_BLOCK_SIZE(size) \
+    ((((size) < sizeof(uint32_t) ? sizeof(uint32_t) : (size)) + RCS_LFPOOL_ALIGN - 1) & ~(RCS_LFPOOL_ALIGN - 1))
+#define RCS_LFPOOL_MEM_SIZE(blockSize, blockCount) (RCS_LFPOOL_BLOCK_SIZE(blockSize) * (blockCount))
+
+// 线程本地缓存的容量
+#define RCS_LFPOOL_CACHE_SIZE 16
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 无锁内存池对象
+ */
+typedef void* RcsLfPool_t;
+
+/**
+ * @brief 无锁内存池实例
+ * @note 空闲块的前4字节保存下一个空闲块的下标
+ */
+typedef struct
+{
+    uint8_t        *mem;
+    size_t          blockSize;
+    uint32_t        blockCount;
+    uint32_t        freeCount;
+    RcsLfPoolHead_t head;
+}RcsLfPoolHandle_t;
+
+/**
+ * @brief 线程本地缓存，每个线程各自持有一个，命中时不访问共享栈顶
+ */
+typedef struct
+{
+    RcsLfPool_t pool;
+    uint32_t    count;
+    void       *blocks[RCS_LFPOOL_CACHE_SIZE];
+}RcsLfPoolCache_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+RcsLfPool_t RcsLfPoolCreateStatic(size_t blockSize, size_t blockCount, RcsLfPoolHandle_t *staticHandle, uint8_t *poolMemory);
+RcsLfPool_t RcsLfPoolCreate(size_t blockSize, size_t blockCount);
+void RcsLfPoolDestroy(RcsLfPool_t pool);
+void *RcsLfPoolAlloc(RcsLfPool_t pool);
+int RcsLfPoolFree(RcsLfPool_t pool, void *block);
+size_t RcsLfPoolGetFree(RcsLfPool_t pool);
+int RcsLfPoolCacheInit(RcsLfPoolCache_t *cache, RcsLfPool_t pool);
+void *RcsLfPoolCacheAlloc(RcsLfPoolCache_t *cache);
+int RcsLfPoolCacheFree(RcsLfPoolCache_t *cache, void *block);
+void RcsLfPoolCacheFlush(RcsLfPoolCache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,88 @@
+/**
+ * @file msg_queue.h
+ * @brief 指针传递的消息队列，消息块来自内存池，按引用计数在多个接收方间共享，零拷贝移交
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "block_pool.h"
+
+/* 系统调用 ---------------------------------------------------*/
+
+#define MsgPortMalloc malloc
+#define MsgPortFree   free
+#define MsgPortEnterCriticalFromAll() do { } while (0)
+#define MsgPortExitCriticalFromAll() do { } while (0)
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_MSG_OK 0
+#define RCS_MSG_ERROR -1
+#define RCS_MSG_INVALID_PARAM -2
+#define RCS_MSG_FULL -3
+#define RCS_MSG_EMPTY -4
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 消息头，位于内存池块的开头，负载紧随其后
+ */
+typedef struct
+{
+    RcsPool_t pool;
+    uint32_t  refCount;
+    uint32_t  size;
+}RcsMsgHeader_t;
+
+// 负载按指针对齐后的消息头大小
+#define RCS_MSG_HEADER_SIZE RCS_POOL_BLOCK_SIZE(sizeof(RcsMsgHeader_t))
+
+// 容纳指定负载所需的内存池块大小
+#define RCS_MSG_BLOCK_SIZE(payloadSize) (RCS_MSG_HEADER_SIZE + (payloadSize))
+
+/**
+ * @brief 消息队列对象
+ */
+typedef void* RcsMsgQueue_t;
+
+/**
+ * @brief 消息队列实例，槽中只保存消息指针
+ */
+typedef struct
+{
+    void  **slots;
+    size_t  slotCount;
+    size_t  indexWrite;   // 下一个写入的槽，始终小于slotCount
+    size_t  indexRead;    // 下一个读出的槽，始终小于slotCount
+    size_t  count;        // 队列中的消息数，用于区分空与满
+}RcsMsgQueueHandle_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+void *RcsMsgAlloc(RcsPool_t pool, size_t size);
+void RcsMsgRetain(void *msg);
+void RcsMsgRelease(void *msg);
+size_t RcsMsgGetSize(const void *msg);
+RcsMsgQueue_t RcsMsgQueueCreateStatic(size_t depth, RcsMsgQueueHandle_t *staticHandle, void **slotMemory);
+RcsMsgQueue_t RcsMsgQueueCreate(size_t depth);
+void RcsMsgQueueDestroy(RcsMsgQueue_t queue);
+int RcsMsgQueueSend(RcsMsgQueue_t queue, void *msg);
+int RcsMsgQueueRecv(RcsMsgQueue_t queue, void **msg);
+int RcsMsgQueueBroadcast(RcsMsgQueue_t *queues, size_t queueCount, void *msg);
+size_t RcsMsgQueueGetCount(RcsMsgQueue_t queue);
+
+#ifdef __cplusplus
+}
+#endif
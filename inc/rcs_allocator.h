@@ -0,0 +1,32 @@
+/**
+ * @file rcs_allocator.h
+ * @brief 通用分配器接口，使各数据结构可以按实例替换FifoPortMalloc/FifoPortFree
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stddef.h>
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 分配器，由各分配器模块填写
+ */
+typedef struct
+{
+    void *(*alloc)(void *ctx, size_t size);
+    void  (*free)(void *ctx, void *ptr);  // 为NULL表示无需逐个释放
+    void  *ctx;
+}RcsAllocator_t;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,75 @@
+/**
+ * @file shm_fifo.h
+ * @brief 位置无关的共享内存FIFO，句柄与数据位于同一映射区，可在多个进程间零拷贝传输
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "siso_fifo.h"
+
+/* 宏定义 -----------------------------------------------------*/
+
+#define RCS_SHM_FIFO_MAGIC   0x52534846u // "RSHF"
+#define RCS_SHM_FIFO_VERSION 1u
+#define RCS_SHM_FIFO_CACHE_LINE 64
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 共享区头部，位于映射区起始处
+ * @note 区内只保存偏移和自由增长的索引，不保存任何指针；
+ *       读写索引各占一条缓存行，避免生产者与消费者伪共享
+ */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t capacity;    // 数据区大小，单位为字节，全部可用
+    uint64_t dataOffset;  // 数据区相对头部的偏移
+    uint8_t  reserved0[RCS_SHM_FIFO_CACHE_LINE - 24];
+    uint64_t writeIndex;  // 生产者发布的写位置，只增不减
+    uint8_t  reserved1[RCS_SHM_FIFO_CACHE_LINE - 8];
+    uint64_t readIndex;   // 消费者发布的读位置，只增不减
+    uint8_t  reserved2[RCS_SHM_FIFO_CACHE_LINE - 8];
+}RcsShmFifoHeader_t;
+
+/**
+ * @brief 进程内的共享FIFO视图，每个进程各自持有
+ */
+typedef struct
+{
+    RcsShmFifoHeader_t *header;
+    uint8_t  *data;
+    size_t    mapSize;      // 通过名字映射时的映射大小，0表示区域由调用者管理
+    uint64_t  sendPending;  // 已申请但尚未完成的发送量
+    uint64_t  recvPending;  // 已申请但尚未完成的接收量
+}RcsShmFifo_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+size_t RcsShmFifoRegionSize(size_t capacity);
+int RcsShmFifoInitRegion(RcsShmFifo_t *fifo, void *region, size_t regionSize);
+int RcsShmFifoAttachRegion(RcsShmFifo_t *fifo, void *region, size_t regionSize);
+int RcsShmFifoCreate(RcsShmFifo_t *fifo, const char *name, size_t capacity);
+int RcsShmFifoAttach(RcsShmFifo_t *fifo, const char *name);
+void RcsShmFifoDetach(RcsShmFifo_t *fifo);
+int RcsShmFifoUnlink(const char *name);
+int RcsShmFifoSendAcquire(RcsShmFifo_t *fifo, size_t size, void *memAcquired[2]);
+int RcsShmFifoSendComplete(RcsShmFifo_t *fifo);
+int RcsShmFifoRecvAcquire(RcsShmFifo_t *fifo, size_t size, void *memAcquired[2]);
+int RcsShmFifoRecvComplete(RcsShmFifo_t *fifo);
+
+#ifdef __cplusplus
+}
+#endif
@@ -13,14 +13,28 @@ extern "C" {
 
 /* 头文件 -----------------------------------------------------*/
 
+#include <stdint.h>
+#include <stddef.h>
 #include <stdlib.h>
 
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+#include "rcs_allocator.h"
+
 /* 系统调用 ---------------------------------------------------*/
 
 #define FifoPortMalloc malloc
 #define FifoPortFree   free
-#define FifoPortEnterCriticalFromAll() do { } while (0)
-#define FifoPortExitCriticalFromAll() do { } while (0)
+#if defined(__linux__)
+// 主机端发送方与接收方分属不同线程（见siso_fifo_wait.h），临界区由每个FIFO自己的互斥锁实现
+#define FifoPortEnterCriticalFromAll(handle) pthread_mutex_lock(&(handle)->hostLock)
+#define FifoPortExitCriticalFromAll(handle) pthread_mutex_unlock(&(handle)->hostLock)
+#else
+#define FifoPortEnterCriticalFromAll(handle) do { (void)(handle); } while (0)
+#define FifoPortExitCriticalFromAll(handle) do { (void)(handle); } while (0)
+#endif
 
 
 /* 错误码 -----------------------------------------------------*/
@@ -31,6 +45,13 @@ extern "C" {
 #define RCS_FIFO_NO_SPACE -3
 #define RCS_FIFO_NO_DATA -4 
 #define RCS_FIFO_NOT_ALLOWED -5
+#define RCS_FIFO_TIMEOUT -6
+#define RCS_FIFO_OVERRUN -7   // 外部写入者覆盖了未读数据，FIFO已丢弃全部未读数据并重新同步
+
+/* 事件 -------------------------------------------------------*/
+
+#define RCS_FIFO_EVENT_SEND_COMPLETE 0x01 // 发送完成，FIFO中有新数据
+#define RCS_FIFO_EVENT_RECV_COMPLETE 0x02 // 接收完成，FIFO中有新空间
 
 
 /* 导出类型 ---------------------------------------------------*/
@@ -40,6 +61,21 @@ extern "C" {
  */
 typedef void* RcsFifo_t;
 
+/**
+ * @brief 事件钩子，在发送/接收完成后、退出临界区之后调用
+ * @param fifo FIFO句柄
+ * @param event RCS_FIFO_EVENT_xxx
+ * @param arg 注册钩子时传入的参数
+ */
+typedef void (*RcsFifoEventHook_t)(RcsFifo_t fifo, int event, void *arg);
+
+/**
+ * @brief 外部写入者（如循环模式DMA）的当前写位置
+ * @param arg 设置位置源时传入的参数
+ * @return 返回下一个将被写入的字节在缓冲区中的下标，如STM32上为fifoSize - NDTR
+ */
+typedef size_t (*RcsFifoPosSource_t)(void *arg);
+
 /**
  * @brief 缓冲区实例
  */
@@ -51,12 +87,33 @@ typedef struct
     size_t   indexWriteTail;
     size_t   indexReadHead;
     size_t   indexReadTail;
+    RcsFifoEventHook_t eventHook;
+    void    *eventArg;
+    const RcsAllocator_t *allocator; // 非NULL表示由分配器创建，句柄与缓冲区为同一块内存
+    RcsFifoPosSource_t posSource;    // 非NULL表示写指针由外部位置源给出，不能再通过Send接口写入
+    void    *posArg;
+    uint32_t overrunCount;
+    uint8_t  overrun;                // 接收申请期间发生了覆盖，完成接收时丢弃
+#if defined(__linux__)
+    pthread_mutex_t hostLock;        // 主机端临界区，互不相关的FIFO不会互相争用
+    uint32_t hookCalls;              // 已取得副本、尚未返回的钩子调用数，注销钩子时等待其归零
+#endif
 }RcsFifoHandle_t;
 
+/**
+ * @brief 申请区域的只读视图，数据在环形缓冲区末尾回绕时分为两段，第二段可能为空
+ */
+typedef struct
+{
+    const uint8_t *seg[2];
+    size_t         len[2];
+}RcsFifoView_t;
+
 /* 导出函数 ---------------------------------------------------*/
 
 RcsFifo_t RcsFifoCreateStatic(size_t fifoSize,RcsFifoHandle_t *staticHandle,uint8_t *fifoMemory);
 RcsFifo_t RcsFifoCreate(size_t fifosize);
+RcsFifo_t RcsFifoCreateWithAllocator(size_t fifoSize, const RcsAllocator_t *allocator);
 void RcsFifoDestroy(RcsFifo_t fifo);
 int RcsFifoSendAcquire(RcsFifo_t fifo, size_t size, void *memAcquired[2]);
 int RcsFifoSendAcquireNoSplit(RcsFifo_t fifo, size_t size, void *memAcquired[2]);
@@ -64,6 +121,18 @@ int RcsFifoSendComplete(RcsFifo_t fifo, const void *memAcquired[2]);
 int RcsFifoRecvAcquire(RcsFifo_t fifo, size_t size, void *memAcquired[2]);
 int RcsFifoRecvAcquireNoSplit(RcsFifo_t fifo, size_t size, void *memAcquired[2]);
 int RcsFifoRecvComplete(RcsFifo_t fifo,const void *memAcquired[2]);
+int RcsFifoSendCompletePartial(RcsFifo_t fifo, const void *memAcquired[2], size_t size);
+int RcsFifoRecvCompletePartial(RcsFifo_t fifo, const void *memAcquired[2], size_t size);
+int RcsFifoSetEventHook(RcsFifo_t fifo, RcsFifoEventHook_t hook, void *arg);
+int RcsFifoClearEventHook(RcsFifo_t fifo, RcsFifoEventHook_t hook, void *arg);
+int RcsFifoSetPosSource(RcsFifo_t fifo, RcsFifoPosSource_t source, void *arg);
+int RcsFifoPosUpdate(RcsFifo_t fifo);
+uint32_t RcsFifoGetOverrunCount(RcsFifo_t fifo);
+size_t RcsFifoGetUsed(RcsFifo_t fifo);
+size_t RcsFifoGetFree(RcsFifo_t fifo);
+int RcsFifoViewInit(RcsFifoView_t *view, void *memAcquired[2], size_t firstSize, size_t size);
+int RcsFifoViewSlice(const RcsFifoView_t *view, size_t offset, size_t size, RcsFifoView_t *slice);
+size_t RcsFifoViewCopy(const RcsFifoView_t *view, size_t offset, void *dst, size_t size);
 
 #ifdef __cplusplus
 }
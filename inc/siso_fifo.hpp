@@ -0,0 +1,243 @@
+/**
+ * @file siso_fifo.hpp
+ * @brief FIFO的C++封装：申请返回只可移动的预留对象，析构时自动完成（或部分完成）
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "siso_fifo.h"
+
+namespace rcs {
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 两段内存拼接而成的逻辑连续视图，不拷贝数据
+ */
+template <typename Byte>
+class JoinedSpan
+{
+public:
+    JoinedSpan() = default;
+    JoinedSpan(std::span<Byte> first, std::span<Byte> second) : first_(first), second_(second) {}
+
+    size_t size() const { return first_.size() + second_.size(); }
+    bool empty() const { return size() == 0; }
+    std::span<Byte> first() const { return first_; }
+    std::span<Byte> second() const { return second_; }
+
+    Byte &operator[](size_t index) const
+    {
+        return index < first_.size() ? first_[index] : second_[index - first_.size()];
+    }
+
+    // 从offset起拷出最多len字节到dst，超出视图的部分被截断，返回实际拷贝的长度
+    size_t copyTo(void *dst, size_t len, size_t offset = 0) const
+    {
+        len = clamp(len, offset);
+        std::byte *out = static_cast<std::byte *>(dst);
+        size_t copied = len;
+        if (offset < first_.size()) {
+            size_t n = std::min(len, first_.size() - offset);
+            std::memcpy(out, first_.data() + offset, n);
+            out += n;
+            len -= n;
+            offset = 0;
+        }
+        else {
+            offset -= first_.size();
+        }
+        if (len != 0) {
+            std::memcpy(out, second_.data() + offset, len);
+        }
+        return copied;
+    }
+
+    // 从src拷入最多len字节到offset处，超出视图的部分被截断，返回实际拷贝的长度，仅可写视图可用
+    size_t copyFrom(const void *src, size_t len, size_t offset = 0) const
+        requires(!std::is_const_v<Byte>)
+    {
+        len = clamp(len, offset);
+        const std::byte *in = static_cast<const std::byte *>(src);
+        size_t copied = len;
+        if (offset < first_.size()) {
+            size_t n = std::min(len, first_.size() - offset);
+            std::memcpy(first_.data() + offset, in, n);
+            in += n;
+            len -= n;
+            offset = 0;
+        }
+        else {
+            offset -= first_.size();
+        }
+        if (len != 0) {
+            std::memcpy(second_.data() + offset, in, len);
+        }
+        return copied;
+    }
+
+private:
+    size_t clamp(size_t len, size_t offset) const
+    {
+        return offset >= size() ? 0 : std::min(len, size() - offset);
+    }
+
+    std::span<Byte> first_;
+    std::span<Byte> second_;
+};
+
+/**
+ * @brief 一次申请得到的预留区域，只可移动；析构时完成commitSize字节
+ * @tparam IsSend true为发送预留，false为接收预留
+ */
+template <bool IsSend>
+class FifoReservation
+{
+public:
+    using Byte = std::conditional_t<IsSend, std::byte, const std::byte>;
+
+    FifoReservation() = default;
+
+    // 申请FIFO，失败时返回携带错误码的空对象
+    static FifoReservation acquire(RcsFifo_t fifo, size_t size, bool noSplit = false)
+    {
+        FifoReservation reservation;
+        int first;
+        if constexpr (IsSend) {
+            first = noSplit ? RcsFifoSendAcquireNoSplit(fifo, size, reservation.mem_)
+                            : RcsFifoSendAcquire(fifo, size, reservation.mem_);
+        }
+        else {
+            first = noSplit ? RcsFifoRecvAcquireNoSplit(fifo, size, reservation.mem_)
+                            : RcsFifoRecvAcquire(fifo, size, reservation.mem_);
+        }
+        reservation.first_ = first;
+        if (first > 0) {
+            reservation.fifo_ = fifo;
+            reservation.size_ = size;
+            reservation.commitSize_ = size;
+        }
+        return reservation;
+    }
+
+    FifoReservation(FifoReservation &&other) noexcept
+        : fifo_(std::exchange(other.fifo_, nullptr)), size_(other.size_),
+          commitSize_(other.commitSize_), first_(other.first_)
+    {
+        mem_[0] = other.mem_[0];
+        mem_[1] = other.mem_[1];
+    }
+
+    FifoReservation &operator=(FifoReservation &&other) noexcept
+    {
+        if (this != &other) {
+            commit();
+            fifo_ = std::exchange(other.fifo_, nullptr);
+            size_ = other.size_;
+            commitSize_ = other.commitSize_;
+            first_ = other.first_;
+            mem_[0] = other.mem_[0];
+            mem_[1] = other.mem_[1];
+        }
+        return *this;
+    }
+
+    FifoReservation(const FifoReservation &) = delete;
+    FifoReservation &operator=(const FifoReservation &) = delete;
+
+    ~FifoReservation() { commit(); }
+
+    // 申请是否成功
+    explicit operator bool() const { return fifo_ != nullptr; }
+
+    // 申请失败时的错误码
+    int error() const { return fifo_ != nullptr ? RCS_FIFO_OK : first_; }
+
+    size_t size() const { return fifo_ != nullptr ? size_ : 0; }
+
+    std::span<Byte> first() const
+    {
+        return fifo_ != nullptr ? std::span<Byte>(static_cast<Byte *>(mem_[0]), (size_t)first_) : std::span<Byte>();
+    }
+
+    std::span<Byte> second() const
+    {
+        return mem_[1] != nullptr && fifo_ != nullptr
+            ? std::span<Byte>(static_cast<Byte *>(mem_[1]), size_ - (size_t)first_)
+            : std::span<Byte>();
+    }
+
+    JoinedSpan<Byte> joined() const { return JoinedSpan<Byte>(first(), second()); }
+
+    // 设置析构时完成的字节数，用于按实际用量部分完成
+    void setCommitSize(size_t size) { commitSize_ = size < size_ ? size : size_; }
+
+    // 立即完成，之后该对象变为空
+    int commit()
+    {
+        if (fifo_ == nullptr) {
+            return RCS_FIFO_OK;
+        }
+        RcsFifo_t fifo = std::exchange(fifo_, nullptr);
+        const void **mem = const_cast<const void **>(mem_);
+        if (commitSize_ == size_) {
+            return IsSend ? RcsFifoSendComplete(fifo, mem) : RcsFifoRecvComplete(fifo, mem);
+        }
+        return IsSend ? RcsFifoSendCompletePartial(fifo, mem, commitSize_)
+                      : RcsFifoRecvCompletePartial(fifo, mem, commitSize_);
+    }
+
+    int commit(size_t size)
+    {
+        setCommitSize(size);
+        return commit();
+    }
+
+    // 放弃本次申请，不写入/不消费任何数据
+    int cancel() { return commit(0); }
+
+private:
+    RcsFifo_t fifo_ = nullptr;
+    size_t    size_ = 0;
+    size_t    commitSize_ = 0;
+    int       first_ = RCS_FIFO_ERROR;
+    void     *mem_[2] = {nullptr, nullptr};
+};
+
+using SendReservation = FifoReservation<true>;
+using RecvReservation = FifoReservation<false>;
+
+/* 导出函数 ---------------------------------------------------*/
+
+inline SendReservation sendAcquire(RcsFifo_t fifo, size_t size)
+{
+    return SendReservation::acquire(fifo, size);
+}
+
+inline SendReservation sendAcquireNoSplit(RcsFifo_t fifo, size_t size)
+{
+    return SendReservation::acquire(fifo, size, true);
+}
+
+inline RecvReservation recvAcquire(RcsFifo_t fifo, size_t size)
+{
+    return RecvReservation::acquire(fifo, size);
+}
+
+inline RecvReservation recvAcquireNoSplit(RcsFifo_t fifo, size_t size)
+{
+    return RecvReservation::acquire(fifo, size, true);
+}
+
+} // namespace rcs
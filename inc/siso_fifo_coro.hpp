@@ -0,0 +1,235 @@
+/**
+ * @file siso_fifo_coro.hpp
+ * @brief 为FIFO提供C++20协程等待体，数据或空间不足时挂起，由对方的完成操作恢复
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+
+#include "siso_fifo.h"
+
+namespace rcs {
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 执行器钩子，负责在合适的线程上恢复被唤醒的协程
+ */
+class FifoExecutor
+{
+public:
+    virtual ~FifoExecutor() = default;
+    virtual void post(std::coroutine_handle<> handle) = 0;
+};
+
+/**
+ * @brief 最简单的单线程执行器：完成操作只负责入队，由事件循环调用run恢复
+ */
+class FifoRunQueue : public FifoExecutor
+{
+public:
+    void post(std::coroutine_handle<> handle) override
+    {
+        ready_.push_back(handle);
+    }
+
+    // 恢复所有已就绪的协程，返回恢复的个数
+    size_t run()
+    {
+        size_t count = 0;
+        while (!ready_.empty()) {
+            std::coroutine_handle<> handle = ready_.front();
+            ready_.pop_front();
+            handle.resume();
+            count++;
+        }
+        return count;
+    }
+
+    bool empty() const { return ready_.empty(); }
+
+private:
+    std::deque<std::coroutine_handle<>> ready_;
+};
+
+/**
+ * @brief 即发即弃的协程类型，协程结束后自动销毁
+ */
+struct FifoTask
+{
+    struct promise_type
+    {
+        FifoTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+/**
+ * @brief 一次申请的结果，语义与RcsFifoXxxAcquire的返回值一致
+ */
+struct FifoBlock
+{
+    int    first = RCS_FIFO_ERROR;   // 第一段长度，小于0时为错误码
+    size_t size = 0;                 // 申请的总长度
+    void  *mem[2] = {nullptr, nullptr};
+
+    bool ok() const { return first > 0; }
+};
+
+/**
+ * @brief 协程化的FIFO，每个方向同时只允许一个协程等待
+ * @note 会占用FIFO的事件钩子，FIFO已挂接了其他钩子时attached()为false，此时需要挂起的等待立即以RCS_FIFO_NOT_ALLOWED返回
+ */
+class CoFifo
+{
+public:
+    CoFifo(RcsFifo_t fifo, FifoExecutor &executor) : fifo_(fifo), executor_(executor)
+    {
+        attached_ = (RcsFifoSetEventHook(fifo_, &CoFifo::EventHook, this) == RCS_FIFO_OK);
+    }
+
+    ~CoFifo()
+    {
+        RcsFifoClearEventHook(fifo_, &CoFifo::EventHook, this);
+    }
+
+    CoFifo(const CoFifo &) = delete;
+    CoFifo &operator=(const CoFifo &) = delete;
+
+    class Awaiter;
+
+    // co_await fifo.recv(n)：等待至少n字节数据
+    Awaiter recv(size_t size) { return Awaiter(*this, size, false); }
+
+    // co_await fifo.send(n)：等待至少n字节空间
+    Awaiter send(size_t size) { return Awaiter(*this, size, true); }
+
+    int recvComplete(const FifoBlock &block)
+    {
+        return RcsFifoRecvComplete(fifo_, (const void **)block.mem);
+    }
+
+    int sendComplete(const FifoBlock &block)
+    {
+        return RcsFifoSendComplete(fifo_, (const void **)block.mem);
+    }
+
+    RcsFifo_t native() const { return fifo_; }
+
+    bool attached() const { return attached_; }
+
+    class Awaiter
+    {
+    public:
+        Awaiter(CoFifo &owner, size_t size, bool isSend) : owner_(owner), isSend_(isSend)
+        {
+            block_.size = size;
+        }
+
+        bool await_ready()
+        {
+            return !WouldBlock(Acquire());
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle)
+        {
+            // 没有挂接钩子时无人能恢复协程，不挂起而直接报告
+            if (!owner_.attached_) {
+                block_.first = RCS_FIFO_NOT_ALLOWED;
+                return false;
+            }
+            Waiter &waiter = isSend_ ? owner_.sendWaiter_ : owner_.recvWaiter_;
+            waiter.need.store(block_.size, std::memory_order_relaxed);
+            waiter.handle.store(handle.address(), std::memory_order_seq_cst);
+
+            // 挂起前再检查一次，防止对方恰好在登记之前完成
+            if (owner_.Available(isSend_) >= block_.size &&
+                waiter.handle.exchange(nullptr, std::memory_order_seq_cst) != nullptr) {
+                return false;
+            }
+            return true;
+        }
+
+        FifoBlock await_resume()
+        {
+            if (WouldBlock(block_.first)) {
+                Acquire();
+            }
+            return block_;
+        }
+
+    private:
+        int Acquire()
+        {
+            block_.first = isSend_
+                ? RcsFifoSendAcquire(owner_.fifo_, block_.size, block_.mem)
+                : RcsFifoRecvAcquire(owner_.fifo_, block_.size, block_.mem);
+            return block_.first;
+        }
+
+        bool WouldBlock(int ret) const
+        {
+            return ret == (isSend_ ? RCS_FIFO_NO_SPACE : RCS_FIFO_NO_DATA);
+        }
+
+        CoFifo   &owner_;
+        bool      isSend_;
+        FifoBlock block_;
+    };
+
+private:
+    struct Waiter
+    {
+        std::atomic<void *> handle{nullptr};
+        std::atomic<size_t> need{0};
+    };
+
+    size_t Available(bool isSend) const
+    {
+        return isSend ? RcsFifoGetFree(fifo_) : RcsFifoGetUsed(fifo_);
+    }
+
+    // 对方完成后，条件满足才摘下等待的协程交给执行器
+    void Wake(Waiter &waiter, bool isSend)
+    {
+        if (waiter.handle.load(std::memory_order_seq_cst) == nullptr ||
+            Available(isSend) < waiter.need.load(std::memory_order_relaxed)) {
+            return;
+        }
+        void *address = waiter.handle.exchange(nullptr, std::memory_order_seq_cst);
+        if (address != nullptr) {
+            executor_.post(std::coroutine_handle<>::from_address(address));
+        }
+    }
+
+    static void EventHook(RcsFifo_t, int event, void *arg)
+    {
+        CoFifo *self = static_cast<CoFifo *>(arg);
+        if (event == RCS_FIFO_EVENT_SEND_COMPLETE) {
+            self->Wake(self->recvWaiter_, false);
+        }
+        else {
+            self->Wake(self->sendWaiter_, true);
+        }
+    }
+
+    RcsFifo_t     fifo_;
+    FifoExecutor &executor_;
+    bool          attached_ = false;
+    Waiter        recvWaiter_;
+    Waiter        sendWaiter_;
+};
+
+} // namespace rcs
@@ -0,0 +1,69 @@
+/**
+ * @file siso_fifo_dma.h
+ * @brief 将FIFO的接收申请区域导出为链式DMA描述符，回绕的数据作为一次链式传输发出，传输完成中断中完成接收并启动下一次
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "siso_fifo.h"
+
+/* 导出类型 ---------------------------------------------------*/
+
+typedef struct RcsDmaDesc RcsDmaDesc_t;
+
+/**
+ * @brief 通用DMA描述符，由适配层转换为具体控制器的链表节点格式
+ */
+struct RcsDmaDesc
+{
+    const void   *addr;
+    size_t        len;
+    RcsDmaDesc_t *next;   // 为NULL表示链表结束
+};
+
+/**
+ * @brief 适配层：把描述符链转换为控制器的链表并启动传输，整条链结束后只产生一次传输完成中断
+ * @param chain 描述符链，只在调用期间有效，适配层需自行保存转换后的节点
+ * @param arg 初始化时传入的参数
+ * @return 返回RCS_FIFO_OK表示已启动
+ */
+typedef int (*RcsDmaStart_t)(const RcsDmaDesc_t *chain, void *arg);
+
+/**
+ * @brief DMA发送通道，作为FIFO唯一的接收方
+ * @note 正在传输的数据以FIFO的接收申请区域表示，申请未完成时再次启动会被FIFO拒绝，
+ *       因此任务中的启动与中断中的续传无需额外加锁
+ */
+typedef struct
+{
+    RcsFifo_t     fifo;
+    RcsDmaStart_t start;
+    void         *arg;
+    size_t        maxTransfer;   // 单次传输的最大字节数，0表示不限制
+    void         *memAcquired[2];
+    size_t        size;          // 正在传输的字节数
+    RcsDmaDesc_t  desc[2];
+    uint32_t      transferCount;
+}RcsFifoDmaTx_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+int RcsFifoDmaDescBuild(void *memAcquired[2], size_t firstSize, size_t size, RcsDmaDesc_t desc[2]);
+int RcsFifoDmaTxInit(RcsFifoDmaTx_t *tx, RcsFifo_t fifo, RcsDmaStart_t start, void *arg, size_t maxTransfer);
+int RcsFifoDmaTxKick(RcsFifoDmaTx_t *tx);
+int RcsFifoDmaTxComplete(RcsFifoDmaTx_t *tx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,48 @@
+/**
+ * @file siso_fifo_eventfd.h
+ * @brief 将FIFO的就绪状态映射到eventfd，以便与其他文件描述符一同用epoll等待（Linux主机端）
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "siso_fifo.h"
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief eventfd通知器
+ * @note recvFd可读表示FIFO由空变为非空，sendFd可读表示FIFO由满变为不满
+ * @note 通知器会占用FIFO的事件钩子
+ */
+typedef struct
+{
+    RcsFifo_t fifo;
+    int       recvFd;
+    int       sendFd;
+    uint32_t  recvArmed;  // 接收方已确认FIFO为空，下一次发送完成需要通知
+    uint32_t  sendArmed;  // 发送方已确认空间不足，下一次接收完成需要通知
+    size_t    recvNeed;   // 接收方等待的数据量
+    size_t    sendNeed;   // 发送方等待的空间大小
+}RcsFifoEventFd_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+int RcsFifoEventFdInit(RcsFifoEventFd_t *notifier, RcsFifo_t fifo);
+void RcsFifoEventFdDeinit(RcsFifoEventFd_t *notifier);
+int RcsFifoEventFdRearmRecv(RcsFifoEventFd_t *notifier, size_t size);
+int RcsFifoEventFdRearmSend(RcsFifoEventFd_t *notifier, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
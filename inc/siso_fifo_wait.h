@@ -0,0 +1,64 @@
+/**
+ * @file siso_fifo_wait.h
+ * @brief 为FIFO提供先自旋、后休眠的阻塞式申请（Linux主机端，基于futex）
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#if !defined(__linux__)
+#error "siso_fifo_wait.h依赖futex，只能用于Linux主机端构建"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "siso_fifo.h"
+
+/* 系统调用 ---------------------------------------------------*/
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FifoPortCpuRelax() __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define FifoPortCpuRelax() __asm__ volatile("yield" ::: "memory")
+#else
+#define FifoPortCpuRelax() do { } while (0)
+#endif
+
+/* 宏定义 -----------------------------------------------------*/
+
+#define RCS_FIFO_WAIT_FOREVER (-1)
+#define RCS_FIFO_WAIT_DEFAULT_SPIN 200
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 等待器，保存futex等待字和等待者标志
+ * @note 等待器会占用FIFO的事件钩子
+ */
+typedef struct
+{
+    RcsFifo_t fifo;
+    uint32_t  dataSeq;    // 发送完成时递增，接收方在其上休眠
+    uint32_t  spaceSeq;   // 接收完成时递增，发送方在其上休眠
+    uint32_t  waitFlags;  // 休眠中的一方，只有置位时完成方才发起唤醒
+    uint32_t  spinCount;  // 休眠前的自旋次数
+}RcsFifoWaiter_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+int RcsFifoWaiterInit(RcsFifoWaiter_t *waiter, RcsFifo_t fifo, uint32_t spinCount);
+void RcsFifoWaiterDeinit(RcsFifoWaiter_t *waiter);
+int RcsFifoSendAcquireWait(RcsFifoWaiter_t *waiter, size_t size, void *memAcquired[2], int32_t timeoutMs);
+int RcsFifoRecvAcquireWait(RcsFifoWaiter_t *waiter, size_t size, void *memAcquired[2], int32_t timeoutMs);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,103 @@
+/**
+ * @file slot_map.h
+ * @brief 带版本号句柄的槽表，对象紧密存放便于遍历，删除后旧句柄自动失效，避免悬空指针
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/* 系统调用 ---------------------------------------------------*/
+
+#define SlotMapPortMalloc malloc
+#define SlotMapPortFree   free
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_SLOTMAP_OK 0
+#define RCS_SLOTMAP_ERROR -1
+#define RCS_SLOTMAP_INVALID_PARAM -2
+#define RCS_SLOTMAP_STALE -3
+
+/* 宏定义 -----------------------------------------------------*/
+
+#define RCS_SLOTMAP_ALIGN sizeof(void *)
+#define RCS_SLOTMAP_MAX_CAPACITY 0xFFFEu
+#define RCS_SLOTMAP_NIL 0xFFFFu
+
+// 无效句柄，版本号从1开始，因此0永远不会是有效句柄
+#define RCS_SLOTMAP_INVALID_HANDLE 0u
+
+#define RCS_SLOTMAP_HANDLE_INDEX(handle)      ((uint16_t)((handle) & 0xFFFFu))
+#define RCS_SLOTMAP_HANDLE_GENERATION(handle) ((uint16_t)((handle) >> 16))
+
+// 对象大小按指针对齐
+#define RCS_SLOTMAP_ELEM_SIZE(size) (((size) + RCS_SLOTMAP_ALIGN - 1) & ~(RCS_SLOTMAP_ALIGN - 1))
+
+// 静态创建时所需的内存大小：紧密对象数组 + 槽数组 + 反向索引数组
+#define RCS_SLOTMAP_MEM_SIZE(elemSize, capacity) \
+    (RCS_SLOTMAP_ELEM_SIZE(elemSize) * (capacity) + sizeof(RcsSlotMapSlot_t) * (capacity) + sizeof(uint16_t) * (capacity))
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 32位句柄，高16位为版本号，低16位为槽下标，可直接放进FIFO消息
+ */
+typedef uint32_t RcsSlotHandle_t;
+
+/**
+ * @brief 槽，占用时记录对象在紧密数组中的位置，空闲时记录下一个空闲槽
+ */
+typedef struct
+{
+    uint16_t denseIndex;
+    uint16_t generation;
+}RcsSlotMapSlot_t;
+
+/**
+ * @brief 槽表对象
+ */
+typedef void* RcsSlotMap_t;
+
+/**
+ * @brief 槽表实例
+ * @note 不加锁，只能在单一上下文中使用；删除时把末尾对象搬到空洞处，
+ *       因此RcsSlotMapGet返回的指针在下一次删除后可能失效，长期引用请保存句柄
+ */
+typedef struct
+{
+    uint8_t          *dense;
+    RcsSlotMapSlot_t *slots;
+    uint16_t         *denseToSlot;
+    size_t            elemSize;
+    uint16_t          capacity;
+    uint16_t          count;
+    uint16_t          freeHead;
+}RcsSlotMapHandle_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+RcsSlotMap_t RcsSlotMapCreateStatic(size_t elemSize, size_t capacity, RcsSlotMapHandle_t *staticHandle, uint8_t *mapMemory);
+RcsSlotMap_t RcsSlotMapCreate(size_t elemSize, size_t capacity);
+void RcsSlotMapDestroy(RcsSlotMap_t map);
+void *RcsSlotMapInsert(RcsSlotMap_t map, RcsSlotHandle_t *handle);
+int RcsSlotMapRemove(RcsSlotMap_t map, RcsSlotHandle_t handle);
+void *RcsSlotMapGet(RcsSlotMap_t map, RcsSlotHandle_t handle);
+void RcsSlotMapClear(RcsSlotMap_t map);
+size_t RcsSlotMapGetCount(RcsSlotMap_t map);
+void *RcsSlotMapGetData(RcsSlotMap_t map);
+RcsSlotHandle_t RcsSlotMapHandleAt(RcsSlotMap_t map, size_t denseIndex);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file timer_wheel.h
+ * @brief 分层时间轮，为协议会话的重传与超时提供O(1)的启动/停止/到期处理
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/* 系统调用 ---------------------------------------------------*/
+
+#define TimerPortMalloc malloc
+#define TimerPortFree   free
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_TIMER_OK 0
+#define RCS_TIMER_ERROR -1
+#define RCS_TIMER_INVALID_PARAM -2
+
+/* 宏定义 -----------------------------------------------------*/
+
+#define RCS_TIMER_LEVEL_BITS 6
+#define RCS_TIMER_LEVEL_SLOTS (1u << RCS_TIMER_LEVEL_BITS)
+#define RCS_TIMER_LEVELS 4
+
+// 单次可直接定时的最大节拍数，超出的定时器在最高层循环，直到剩余时间落入范围内
+#define RCS_TIMER_MAX_DELAY ((1u << (RCS_TIMER_LEVEL_BITS * RCS_TIMER_LEVELS)) - 1)
+
+/* 导出类型 ---------------------------------------------------*/
+
+typedef struct RcsTimerNode RcsTimerNode_t;
+
+/**
+ * @brief 到期回调，可在回调中重新启动本定时器或停止其他定时器
+ */
+typedef void (*RcsTimerCallback_t)(RcsTimerNode_t *node, void *arg);
+
+/**
+ * @brief 侵入式定时器节点，由用户静态分配，通常嵌在会话结构体中
+ */
+struct RcsTimerNode
+{
+    RcsTimerNode_t    *next;
+    RcsTimerNode_t   **pprev;   // 指向前一节点的next（或槽头），为NULL表示未启动
+    uint32_t           expire;
+    RcsTimerCallback_t callback;
+    void              *arg;
+};
+
+/**
+ * @brief 时间轮对象
+ */
+typedef void* RcsTimerWheel_t;
+
+/**
+ * @brief 时间轮实例
+ * @note 节拍计数由中断或任务通过RcsTimerWheelTick累加，其余操作（启动、停止、处理）
+ *       必须在同一个任务上下文中进行
+ */
+typedef struct
+{
+    RcsTimerNode_t *slots[RCS_TIMER_LEVELS][RCS_TIMER_LEVEL_SLOTS];
+    RcsTimerNode_t *expired;   // 当前节拍正在分发的批次
+    uint32_t        now;
+    uint32_t        pendingTicks;
+}RcsTimerWheelHandle_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+RcsTimerWheel_t RcsTimerWheelCreateStatic(RcsTimerWheelHandle_t *staticHandle);
+RcsTimerWheel_t RcsTimerWheelCreate(void);
+void RcsTimerWheelDestroy(RcsTimerWheel_t wheel);
+int RcsTimerNodeInit(RcsTimerNode_t *node, RcsTimerCallback_t callback, void *arg);
+int RcsTimerStart(RcsTimerWheel_t wheel, RcsTimerNode_t *node, uint32_t delay);
+int RcsTimerStop(RcsTimerWheel_t wheel, RcsTimerNode_t *node);
+int RcsTimerIsActive(const RcsTimerNode_t *node);
+void RcsTimerWheelTick(RcsTimerWheel_t wheel);
+size_t RcsTimerWheelProcess(RcsTimerWheel_t wheel);
+uint32_t RcsTimerWheelGetNow(RcsTimerWheel_t wheel);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,87 @@
+/**
+ * @file tlsf_heap.h
+ * @brief 两级分离适配（TLSF）实时堆，O(1)申请与释放，可作为FIFO的分配器
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "rcs_allocator.h"
+
+/* 系统调用 ---------------------------------------------------*/
+
+#define TlsfPortMalloc malloc
+#define TlsfPortFree   free
+#define TlsfPortEnterCriticalFromAll() do { } while (0)
+#define TlsfPortExitCriticalFromAll() do { } while (0)
+#define TlsfPortClz32(x) __builtin_clz(x)   // Cortex-M3及以上为单条CLZ指令
+#define TlsfPortCtz32(x) __builtin_ctz(x)
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_TLSF_OK 0
+#define RCS_TLSF_ERROR -1
+#define RCS_TLSF_INVALID_PARAM -2
+
+/* 宏定义 -----------------------------------------------------*/
+
+#define RCS_TLSF_ALIGN          sizeof(void *)
+#define RCS_TLSF_SL_COUNT_LOG2  4                       // 每一级划分为16个二级区间
+#define RCS_TLSF_SL_COUNT       (1u << RCS_TLSF_SL_COUNT_LOG2)
+#define RCS_TLSF_FL_MAX         30                      // 单块最大1GB
+#define RCS_TLSF_FL_SHIFT       (RCS_TLSF_SL_COUNT_LOG2 + (sizeof(void *) == 8 ? 3 : 2))
+#define RCS_TLSF_FL_COUNT       (RCS_TLSF_FL_MAX - RCS_TLSF_FL_SHIFT + 1)
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief TLSF堆对象
+ */
+typedef void* RcsTlsf_t;
+
+/**
+ * @brief 块头，空闲块的负载区开头额外存放空闲链表指针
+ */
+typedef struct RcsTlsfBlock
+{
+    struct RcsTlsfBlock *prevPhys;  // 物理上的前一个块
+    size_t size;                    // 负载大小，最低位为空闲标志
+}RcsTlsfBlock_t;
+
+/**
+ * @brief TLSF堆实例
+ */
+typedef struct
+{
+    uint8_t  *arena;
+    size_t    arenaSize;
+    size_t    freeSize;       // 空闲块负载之和
+    uint32_t  flBitmap;
+    uint32_t  slBitmap[RCS_TLSF_FL_COUNT];
+    RcsTlsfBlock_t *freeHeads[RCS_TLSF_FL_COUNT][RCS_TLSF_SL_COUNT];
+}RcsTlsfHandle_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+RcsTlsf_t RcsTlsfCreateStatic(RcsTlsfHandle_t *staticHandle, void *arena, size_t arenaSize);
+RcsTlsf_t RcsTlsfCreate(size_t arenaSize);
+void RcsTlsfDestroy(RcsTlsf_t tlsf);
+void *RcsTlsfMalloc(RcsTlsf_t tlsf, size_t size);
+int RcsTlsfFree(RcsTlsf_t tlsf, void *ptr);
+size_t RcsTlsfGetFree(RcsTlsf_t tlsf);
+int RcsTlsfGetAllocator(RcsTlsf_t tlsf, RcsAllocator_t *allocator);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,223 @@
+/**
+ * @file view_cursor.h
+ * @brief 两段FIFO区域上的顺序游标，按小端/大端读写u8/u16/u32/f32字段，
+ *        字段连续时为一次非对齐访问，只有跨越回绕的字段才逐段拼接
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 头文件 -----------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "siso_fifo.h"
+
+/* 错误码 -----------------------------------------------------*/
+
+#define RCS_CURSOR_OK 0
+#define RCS_CURSOR_INVALID_PARAM -2
+#define RCS_CURSOR_OVERFLOW -3   // 读写超出区域末尾
+
+/* 宏定义 -----------------------------------------------------*/
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define RCS_CURSOR_LE16(x) __builtin_bswap16(x)
+#define RCS_CURSOR_LE32(x) __builtin_bswap32(x)
+#define RCS_CURSOR_BE16(x) (x)
+#define RCS_CURSOR_BE32(x) (x)
+#else
+#define RCS_CURSOR_LE16(x) (x)
+#define RCS_CURSOR_LE32(x) (x)
+#define RCS_CURSOR_BE16(x) __builtin_bswap16(x)
+#define RCS_CURSOR_BE32(x) __builtin_bswap32(x)
+#endif
+
+/* 导出类型 ---------------------------------------------------*/
+
+/**
+ * @brief 游标，只记录当前段的剩余部分和下一段，热路径上与线性缓冲区的指针相同
+ * @note 越界时置位error并保持位置不变，读取返回0、写入被忽略；错误一直保留，解码完一整帧后检查一次即可
+ */
+typedef struct
+{
+    uint8_t *ptr;       // 当前位置
+    size_t   avail;     // 当前段剩余字节数
+    uint8_t *next;      // 第二段起点
+    size_t   nextLen;   // 第二段长度，切换到第二段后为0
+    size_t   size;      // 区域总长度
+    int      error;
+}RcsCursor_t;
+
+/* 导出函数 ---------------------------------------------------*/
+
+int RcsCursorInit(RcsCursor_t *cursor, void *memAcquired[2], size_t firstSize, size_t size);
+int RcsCursorInitView(RcsCursor_t *cursor, const RcsFifoView_t *view);
+void RcsCursorReadSlow(RcsCursor_t *cursor, void *dst, size_t size);
+void RcsCursorWriteSlow(RcsCursor_t *cursor, const void *src, size_t size);
+int RcsCursorSkip(RcsCursor_t *cursor, size_t size);
+
+/**
+ * @brief 读取size字节，字段在当前段内时直接拷贝，size为常量时编译为一次加载
+ * @param cursor 游标
+ * @param dst 目标
+ * @param size 字节数
+ */
+static inline void RcsCursorRead(RcsCursor_t *cursor, void *dst, size_t size)
+{
+    if (cursor->avail >= size) {
+        memcpy(dst, cursor->ptr, size);
+        cursor->ptr += size;
+        cursor->avail -= size;
+    }
+    else {
+        RcsCursorReadSlow(cursor, dst, size);
+    }
+}
+
+/**
+ * @brief 写入size字节，字段在当前段内时直接拷贝，size为常量时编译为一次存储
+ * @param cursor 游标
+ * @param src 数据
+ * @param size 字节数
+ */
+static inline void RcsCursorWrite(RcsCursor_t *cursor, const void *src, size_t size)
+{
+    if (cursor->avail >= size) {
+        memcpy(cursor->ptr, src, size);
+        cursor->ptr += size;
+        cursor->avail -= size;
+    }
+    else {
+        RcsCursorWriteSlow(cursor, src, size);
+    }
+}
+
+/**
+ * @brief 获取相对区域起点的当前偏移
+ */
+static inline size_t RcsCursorGetPos(const RcsCursor_t *cursor)
+{
+    return cursor->size - cursor->avail - cursor->nextLen;
+}
+
+/**
+ * @brief 获取剩余可读写的字节数
+ */
+static inline size_t RcsCursorGetRemain(const RcsCursor_t *cursor)
+{
+    return cursor->avail + cursor->nextLen;
+}
+
+/**
+ * @brief 获取错误码，自初始化以来没有越界时返回RCS_CURSOR_OK
+ */
+static inline int RcsCursorGetError(const RcsCursor_t *cursor)
+{
+    return cursor->error;
+}
+
+static inline uint8_t RcsCursorGetU8(RcsCursor_t *cursor)
+{
+    uint8_t value = 0;
+    RcsCursorRead(cursor, &value, sizeof(value));
+    return value;
+}
+
+static inline uint16_t RcsCursorGetU16Le(RcsCursor_t *cursor)
+{
+    uint16_t value = 0;
+    RcsCursorRead(cursor, &value, sizeof(value));
+    return RCS_CURSOR_LE16(value);
+}
+
+static inline uint16_t RcsCursorGetU16Be(RcsCursor_t *cursor)
+{
+    uint16_t value = 0;
+    RcsCursorRead(cursor, &value, sizeof(value));
+    return RCS_CURSOR_BE16(value);
+}
+
+static inline uint32_t RcsCursorGetU32Le(RcsCursor_t *cursor)
+{
+    uint32_t value = 0;
+    RcsCursorRead(cursor, &value, sizeof(value));
+    return RCS_CURSOR_LE32(value);
+}
+
+static inline uint32_t RcsCursorGetU32Be(RcsCursor_t *cursor)
+{
+    uint32_t value = 0;
+    RcsCursorRead(cursor, &value, sizeof(value));
+    return RCS_CURSOR_BE32(value);
+}
+
+static inline float RcsCursorGetF32Le(RcsCursor_t *cursor)
+{
+    uint32_t bits = RcsCursorGetU32Le(cursor);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline float RcsCursorGetF32Be(RcsCursor_t *cursor)
+{
+    uint32_t bits = RcsCursorGetU32Be(cursor);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline void RcsCursorPutU8(RcsCursor_t *cursor, uint8_t value)
+{
+    RcsCursorWrite(cursor, &value, sizeof(value));
+}
+
+static inline void RcsCursorPutU16Le(RcsCursor_t *cursor, uint16_t value)
+{
+    value = RCS_CURSOR_LE16(value);
+    RcsCursorWrite(cursor, &value, sizeof(value));
+}
+
+static inline void RcsCursorPutU16Be(RcsCursor_t *cursor, uint16_t value)
+{
+    value = RCS_CURSOR_BE16(value);
+    RcsCursorWrite(cursor, &value, sizeof(value));
+}
+
+static inline void RcsCursorPutU32Le(RcsCursor_t *cursor, uint32_t value)
+{
+    value = RCS_CURSOR_LE32(value);
+    RcsCursorWrite(cursor, &value, sizeof(value));
+}
+
+static inline void RcsCursorPutU32Be(RcsCursor_t *cursor, uint32_t value)
+{
+    value = RCS_CURSOR_BE32(value);
+    RcsCursorWrite(cursor, &value, sizeof(value));
+}
+
+static inline void RcsCursorPutF32Le(RcsCursor_t *cursor, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    RcsCursorPutU32Le(cursor, bits);
+}
+
+static inline void RcsCursorPutF32Be(RcsCursor_t *cursor, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    RcsCursorPutU32Be(cursor, bits);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,165 @@
+/**
+ * @file arena.c
+ * @brief 线性（指针递增）分配器，支持检查点回退和按周期O(1)整体复位，用于每个控制周期的临时内存
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "arena.h"
+
+static void *ArenaAllocatorAlloc(void *ctx, size_t size)
+{
+    return RcsArenaAlloc(ctx, size, sizeof(void *));
+}
+
+/**
+ * @brief 使用静态申请的方式创建线性分配器
+ * @param arenaSize 内存区大小，单位为字节
+ * @param staticHandle 静态的分配器句柄
+ * @param arenaMemory 静态内存区
+ * @return 返回分配器句柄
+ */
+RcsArena_t RcsArenaCreateStatic(size_t arenaSize, RcsArenaHandle_t *staticHandle, uint8_t *arenaMemory)
+{
+    if (arenaSize == 0 || staticHandle == NULL || arenaMemory == NULL) {
+        return NULL;
+    }
+
+    staticHandle->mem = arenaMemory;
+    staticHandle->memSize = arenaSize;
+    staticHandle->offset = 0;
+    staticHandle->peak = 0;
+
+    return (RcsArena_t)staticHandle;
+}
+
+/**
+ * @brief 使用动态申请的方式创建线性分配器，内存区只在创建时申请一次
+ * @param arenaSize 内存区大小，单位为字节
+ * @return 返回分配器句柄
+ */
+RcsArena_t RcsArenaCreate(size_t arenaSize)
+{
+    if (arenaSize == 0) {
+        return NULL;
+    }
+
+    RcsArenaHandle_t *handle = (RcsArenaHandle_t *)ArenaPortMalloc(sizeof(RcsArenaHandle_t));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    uint8_t *mem = (uint8_t *)ArenaPortMalloc(arenaSize);
+    if (mem == NULL) {
+        ArenaPortFree(handle);
+        return NULL;
+    }
+
+    return RcsArenaCreateStatic(arenaSize, handle, mem);
+}
+
+/**
+ * @brief 销毁线性分配器
+ * @param arena 分配器句柄
+ * @warning 请勿传入静态分配器句柄
+ */
+void RcsArenaDestroy(RcsArena_t arena)
+{
+    if (arena == NULL) {
+        return;
+    }
+    RcsArenaHandle_t *handle = (RcsArenaHandle_t *)arena;
+    ArenaPortFree(handle->mem);
+    ArenaPortFree(handle);
+}
+
+/**
+ * @brief 记录当前分配位置
+ * @param arena 分配器句柄
+ * @return 返回检查点
+ */
+RcsArenaMark_t RcsArenaCheckpoint(RcsArena_t arena)
+{
+    if (arena == NULL) {
+        return 0;
+    }
+    return ((RcsArenaHandle_t *)arena)->offset;
+}
+
+/**
+ * @brief 回退到检查点，检查点之后申请的内存全部作废
+ * @param arena 分配器句柄
+ * @param mark 由RcsArenaCheckpoint返回的检查点
+ * @return 返回错误码，检查点位于当前位置之后时返回RCS_ARENA_INVALID_PARAM
+ */
+int RcsArenaRewind(RcsArena_t arena, RcsArenaMark_t mark)
+{
+    if (arena == NULL) {
+        return RCS_ARENA_INVALID_PARAM;
+    }
+    RcsArenaHandle_t *handle = (RcsArenaHandle_t *)arena;
+    if (mark > handle->offset) {
+        return RCS_ARENA_INVALID_PARAM;
+    }
+    handle->offset = mark;
+    return RCS_ARENA_OK;
+}
+
+/**
+ * @brief 整体复位，在每个周期结束时调用
+ * @param arena 分配器句柄
+ */
+void RcsArenaReset(RcsArena_t arena)
+{
+    if (arena == NULL) {
+        return;
+    }
+    ((RcsArenaHandle_t *)arena)->offset = 0;
+}
+
+/**
+ * @brief 获取当前用量
+ * @param arena 分配器句柄
+ * @return 返回已用字节数（含对齐填充）
+ */
+size_t RcsArenaGetUsed(RcsArena_t arena)
+{
+    if (arena == NULL) {
+        return 0;
+    }
+    return ((RcsArenaHandle_t *)arena)->offset;
+}
+
+/**
+ * @brief 获取历史最高用量
+ * @param arena 分配器句柄
+ * @return 返回历史最高用量
+ */
+size_t RcsArenaGetPeak(RcsArena_t arena)
+{
+    if (arena == NULL) {
+        return 0;
+    }
+    return ((RcsArenaHandle_t *)arena)->peak;
+}
+
+/**
+ * @brief 获取以该线性分配器为后端的分配器，释放为空操作，内存随复位统一回收
+ * @param arena 分配器句柄
+ * @param allocator 返回的分配器
+ * @return 返回错误码
+ */
+int RcsArenaGetAllocator(RcsArena_t arena, RcsAllocator_t *allocator)
+{
+    if (arena == NULL || allocator == NULL) {
+        return RCS_ARENA_INVALID_PARAM;
+    }
+    allocator->alloc = ArenaAllocatorAlloc;
+    allocator->free = NULL;
+    allocator->ctx = arena;
+    return RCS_ARENA_OK;
+}
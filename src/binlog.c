@@ -0,0 +1,99 @@
+/**
+ * @file binlog.c
+ * @brief 延迟格式化的二进制日志：调用处只写入格式串编号与原始参数，格式化在主机端离线完成（见binlog_decode.h）
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "binlog.h"
+#include "view_cursor.h"
+
+/**
+ * @brief 初始化日志通道
+ * @param log 日志通道
+ * @param fifo 日志FIFO，由接收方取出原始记录发往主机
+ * @return 返回错误码
+ */
+int RcsLogInit(RcsLog_t *log, RcsFifo_t fifo)
+{
+    if (log == NULL || fifo == NULL) {
+        return RCS_LOG_INVALID_PARAM;
+    }
+    memset(log, 0, sizeof(RcsLog_t));
+    log->fifo = fifo;
+    return RCS_LOG_OK;
+}
+
+/**
+ * @brief 写入一条记录，通常由RCS_LOG宏调用
+ * @param log 日志通道
+ * @param header 由RCS_LOG_HEADER构造的记录头
+ * @param args 参数
+ * @param count 参数个数
+ * @return 返回错误码，空间不足时丢弃本条记录并返回RCS_LOG_DROPPED
+ */
+int RcsLogWrite(RcsLog_t *log, uint32_t header, const uint32_t *args, size_t count)
+{
+    if (log == NULL || count > RCS_LOG_MAX_ARGS || (count != 0 && args == NULL)) {
+        return RCS_LOG_INVALID_PARAM;
+    }
+
+    // 申请前读到的丢弃数只用于决定是否预留丢弃标记，写入的值须在持有申请后重新读取：
+    // 读取与申请之间可能有中断成功写入并报告了这些丢弃
+    int withMarker = (__atomic_load_n(&log->dropCount, __ATOMIC_RELAXED) != log->dropReported);
+    void *memAcquired[2] = {NULL, NULL};
+    uint32_t dropped;
+    size_t size;
+    int first;
+    for (;;) {
+        size = (2 + count + (withMarker ? 3 : 0)) * sizeof(uint32_t);
+        first = RcsFifoSendAcquire(log->fifo, size, memAcquired);
+        if (first < 0) {
+            __atomic_fetch_add(&log->dropCount, 1, __ATOMIC_RELAXED);
+            return RCS_LOG_DROPPED;
+        }
+        // 持有发送申请期间其他调用都会失败，dropReported只在此处修改
+        dropped = __atomic_load_n(&log->dropCount, __ATOMIC_RELAXED) - log->dropReported;
+        if (dropped == 0 || withMarker) {
+            break;
+        }
+        // 申请前后之间新增了丢弃，放弃后按带标记的大小重新申请
+        RcsFifoSendCompletePartial(log->fifo, (const void **)memAcquired, 0);
+        withMarker = 1;
+    }
+
+    RcsCursor_t cursor;
+    uint32_t timestamp = (uint32_t)LogPortTimestamp();
+    RcsCursorInit(&cursor, memAcquired, (size_t)first, size);
+    if (dropped != 0) {
+        RcsCursorPutU32Le(&cursor, RCS_LOG_HEADER(RCS_LOG_LEVEL_WARN, RCS_LOG_ID_DROPPED, 1));
+        RcsCursorPutU32Le(&cursor, timestamp);
+        RcsCursorPutU32Le(&cursor, dropped);
+        log->dropReported += dropped;
+    }
+    RcsCursorPutU32Le(&cursor, header);
+    RcsCursorPutU32Le(&cursor, timestamp);
+    for (size_t i = 0; i < count; i++) {
+        RcsCursorPutU32Le(&cursor, args[i]);
+    }
+
+    // 预留了标记但已被其他调用报告时，只提交实际写入的部分
+    RcsFifoSendCompletePartial(log->fifo, (const void **)memAcquired, RcsCursorGetPos(&cursor));
+    return RCS_LOG_OK;
+}
+
+/**
+ * @brief 获取累计丢弃的记录数
+ */
+uint32_t RcsLogGetDropCount(const RcsLog_t *log)
+{
+    if (log == NULL) {
+        return 0;
+    }
+    return __atomic_load_n(&log->dropCount, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,357 @@
+/**
+ * @file binlog_decode.c
+ * @brief 二进制日志的主机端解码：从ELF的rcslog段或导出的字典加载格式串，解析记录并离线格式化
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "binlog_decode.h"
+
+#define ELF_SHT_NOBITS 8
+
+/**
+ * @brief 读取整个文件
+ */
+static uint8_t *ReadFile(const char *path, size_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+
+    uint8_t *data = NULL;
+    size_t capacity = 0;
+    size_t used = 0;
+    for (;;) {
+        if (used == capacity) {
+            capacity = (capacity == 0) ? 65536 : capacity * 2;
+            uint8_t *grown = (uint8_t *)realloc(data, capacity);
+            if (grown == NULL) {
+                free(data);
+                fclose(file);
+                return NULL;
+            }
+            data = grown;
+        }
+        size_t got = fread(data + used, 1, capacity - used, file);
+        if (got == 0) {
+            break;
+        }
+        used += got;
+    }
+    fclose(file);
+    *size = used;
+    return data;
+}
+
+/**
+ * @brief 按ELF的字节序读取无符号整数
+ */
+static uint64_t ElfRead(const uint8_t *p, size_t width, int bigEndian)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < width; i++) {
+        size_t shift = bigEndian ? (width - 1 - i) : i;
+        value |= (uint64_t)p[i] << (8 * shift);
+    }
+    return value;
+}
+
+static int DictAssign(RcsLogDict_t *dict, const uint8_t *strings, size_t size)
+{
+    dict->strings = (char *)malloc(size + 1);
+    if (dict->strings == NULL) {
+        return RCS_LOG_ERROR;
+    }
+    memcpy(dict->strings, strings, size);
+    dict->strings[size] = '\0';
+    dict->size = size;
+    return RCS_LOG_OK;
+}
+
+/**
+ * @brief 从ELF文件的rcslog段加载字典，支持32/64位与大小端
+ * @param dict 字典
+ * @param path 带符号的固件，在主机上自解码时可以是/proc/self/exe
+ * @return 返回错误码
+ */
+int RcsLogDictLoadElf(RcsLogDict_t *dict, const char *path)
+{
+    if (dict == NULL || path == NULL) {
+        return RCS_LOG_INVALID_PARAM;
+    }
+    memset(dict, 0, sizeof(RcsLogDict_t));
+
+    size_t fileSize = 0;
+    uint8_t *elf = ReadFile(path, &fileSize);
+    if (elf == NULL) {
+        return RCS_LOG_NOT_FOUND;
+    }
+
+    int ret = RCS_LOG_NOT_FOUND;
+    if (fileSize < 0x40 || memcmp(elf, "\x7F" "ELF", 4) != 0 || (elf[4] != 1 && elf[4] != 2)) {
+        free(elf);
+        return ret;
+    }
+    int is64 = (elf[4] == 2);
+    int bigEndian = (elf[5] == 2);
+
+    uint64_t shoff = is64 ? ElfRead(elf + 0x28, 8, bigEndian) : ElfRead(elf + 0x20, 4, bigEndian);
+    size_t shentsize = (size_t)ElfRead(elf + (is64 ? 0x3A : 0x2E), 2, bigEndian);
+    size_t shnum = (size_t)ElfRead(elf + (is64 ? 0x3C : 0x30), 2, bigEndian);
+    size_t shstrndx = (size_t)ElfRead(elf + (is64 ? 0x3E : 0x32), 2, bigEndian);
+    size_t minEntSize = is64 ? 0x40 : 0x28;
+
+    if (shentsize < minEntSize || shstrndx >= shnum || shoff > fileSize || shnum > (fileSize - shoff) / shentsize) {
+        free(elf);
+        return ret;
+    }
+
+    // 第i个段的名称偏移、类型、文件偏移与大小
+#define SECTION_AT(i) (elf + shoff + (size_t)(i) * shentsize)
+#define SECTION_NAME(i) (size_t)ElfRead(SECTION_AT(i), 4, bigEndian)
+#define SECTION_TYPE(i) (uint32_t)ElfRead(SECTION_AT(i) + 4, 4, bigEndian)
+#define SECTION_OFFSET(i) ElfRead(SECTION_AT(i) + (is64 ? 0x18 : 0x10), is64 ? 8 : 4, bigEndian)
+#define SECTION_SIZE(i) ElfRead(SECTION_AT(i) + (is64 ? 0x20 : 0x14), is64 ? 8 : 4, bigEndian)
+
+    uint64_t strOffset = SECTION_OFFSET(shstrndx);
+    uint64_t strSize = SECTION_SIZE(shstrndx);
+    if (strOffset > fileSize || strSize > fileSize - strOffset) {
+        free(elf);
+        return ret;
+    }
+    const char *names = (const char *)elf + strOffset;
+
+    for (size_t i = 0; i < shnum; i++) {
+        size_t name = SECTION_NAME(i);
+        if (name >= strSize || memchr(names + name, '\0', strSize - name) == NULL ||
+            strcmp(names + name, RCS_LOG_SECTION) != 0) {
+            continue;
+        }
+        uint64_t offset = SECTION_OFFSET(i);
+        uint64_t size = SECTION_SIZE(i);
+        if (SECTION_TYPE(i) == ELF_SHT_NOBITS || offset > fileSize || size > fileSize - offset) {
+            break;
+        }
+        ret = DictAssign(dict, elf + offset, (size_t)size);
+        break;
+    }
+
+#undef SECTION_AT
+#undef SECTION_NAME
+#undef SECTION_TYPE
+#undef SECTION_OFFSET
+#undef SECTION_SIZE
+
+    free(elf);
+    return ret;
+}
+
+/**
+ * @brief 从导出的字典文件加载，即rcslog段的原始内容
+ * @param dict 字典
+ * @param path 字典文件，可由objcopy -O binary --only-section=rcslog firmware.elf rcslog.bin生成
+ * @return 返回错误码
+ */
+int RcsLogDictLoadRaw(RcsLogDict_t *dict, const char *path)
+{
+    if (dict == NULL || path == NULL) {
+        return RCS_LOG_INVALID_PARAM;
+    }
+    memset(dict, 0, sizeof(RcsLogDict_t));
+
+    size_t size = 0;
+    uint8_t *data = ReadFile(path, &size);
+    if (data == NULL) {
+        return RCS_LOG_NOT_FOUND;
+    }
+    int ret = DictAssign(dict, data, size);
+    free(data);
+    return ret;
+}
+
+/**
+ * @brief 释放字典
+ */
+void RcsLogDictFree(RcsLogDict_t *dict)
+{
+    if (dict == NULL) {
+        return;
+    }
+    free(dict->strings);
+    dict->strings = NULL;
+    dict->size = 0;
+}
+
+/**
+ * @brief 由编号查找格式串
+ * @param dict 字典
+ * @param id 格式串编号
+ * @return 返回格式串，编号不指向某个字符串的起点时返回NULL
+ */
+const char *RcsLogDictLookup(const RcsLogDict_t *dict, uint32_t id)
+{
+    if (dict == NULL || dict->strings == NULL || id >= dict->size) {
+        return NULL;
+    }
+    if (id != 0 && dict->strings[id - 1] != '\0') {
+        return NULL;
+    }
+    return dict->strings + id;
+}
+
+/**
+ * @brief 从原始数据的起点解析一条记录
+ * @param data 日志FIFO中取出的原始数据
+ * @param size 数据长度
+ * @param record 返回记录
+ * @return 返回该记录占用的字节数，数据不足时返回RCS_LOG_NEED_MORE
+ */
+int RcsLogParse(const void *data, size_t size, RcsLogRecord_t *record)
+{
+    if (data == NULL || record == NULL) {
+        return RCS_LOG_INVALID_PARAM;
+    }
+
+    const uint8_t *in = (const uint8_t *)data;
+    if (size < 2 * sizeof(uint32_t)) {
+        return RCS_LOG_NEED_MORE;
+    }
+    uint32_t header = (uint32_t)ElfRead(in, 4, 0);
+    size_t count = RCS_LOG_HEADER_COUNT(header);
+    if (count > RCS_LOG_MAX_ARGS) {
+        return RCS_LOG_ERROR;
+    }
+    size_t total = (2 + count) * sizeof(uint32_t);
+    if (size < total) {
+        return RCS_LOG_NEED_MORE;
+    }
+
+    record->id = RCS_LOG_HEADER_ID(header);
+    record->level = (uint8_t)RCS_LOG_HEADER_LEVEL(header);
+    record->count = (uint8_t)count;
+    record->timestamp = (uint32_t)ElfRead(in + 4, 4, 0);
+    for (size_t i = 0; i < count; i++) {
+        record->args[i] = (uint32_t)ElfRead(in + 8 + 4 * i, 4, 0);
+    }
+    return (int)total;
+}
+
+static void FormatAppend(char *out, size_t outSize, size_t *len, const char *text)
+{
+    size_t textLen = strlen(text);
+    if (*len < outSize) {
+        size_t room = outSize - 1 - *len;
+        memcpy(out + *len, text, (textLen < room) ? textLen : room);
+    }
+    *len += textLen;
+}
+
+/**
+ * @brief 按格式串格式化一条记录
+ * @param dict 字典
+ * @param record 记录
+ * @param out 输出
+ * @param outSize 输出缓冲区大小，结果总以'\0'结尾
+ * @return 返回完整结果的长度（同snprintf，可能大于outSize-1），编号未知时返回RCS_LOG_UNKNOWN_ID
+ * @note 参数均为32位：长度修饰符被忽略，%f/%e/%g按float解释，%s无法还原，输出"<?>"
+ */
+int RcsLogFormat(const RcsLogDict_t *dict, const RcsLogRecord_t *record, char *out, size_t outSize)
+{
+    if (dict == NULL || record == NULL || out == NULL || outSize == 0) {
+        return RCS_LOG_INVALID_PARAM;
+    }
+    if (record->id == RCS_LOG_ID_DROPPED) {
+        return snprintf(out, outSize, "<%u records dropped>", (unsigned)(record->count ? record->args[0] : 0));
+    }
+    const char *fmt = RcsLogDictLookup(dict, record->id);
+    if (fmt == NULL) {
+        return RCS_LOG_UNKNOWN_ID;
+    }
+
+    size_t len = 0;
+    size_t argIndex = 0;
+    char piece[64];
+    out[0] = '\0';
+    while (*fmt != '\0') {
+        if (*fmt != '%' || fmt[1] == '%') {
+            piece[0] = *fmt;
+            piece[1] = '\0';
+            FormatAppend(out, outSize, &len, piece);
+            fmt += (*fmt == '%') ? 2 : 1;
+            continue;
+        }
+
+        char spec[24];
+        size_t n = 0;
+        spec[n++] = *fmt++;
+        while (*fmt != '\0' && strchr("-+ #0123456789.", *fmt) != NULL && n < sizeof(spec) - 2) {
+            spec[n++] = *fmt++;
+        }
+        while (*fmt != '\0' && strchr("hlLqjzt", *fmt) != NULL) {
+            fmt++;
+        }
+        char conv = *fmt;
+        if (conv == '\0') {
+            break;
+        }
+        fmt++;
+        spec[n++] = conv;
+        spec[n] = '\0';
+
+        if (argIndex >= record->count) {
+            FormatAppend(out, outSize, &len, "<?>");
+            continue;
+        }
+        uint32_t arg = record->args[argIndex++];
+        float f;
+        switch (conv) {
+            case 'd':
+            case 'i':
+                snprintf(piece, sizeof(piece), spec, (int)(int32_t)arg);
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+                snprintf(piece, sizeof(piece), spec, (unsigned)arg);
+                break;
+            case 'c':
+                snprintf(piece, sizeof(piece), spec, (int)(uint8_t)arg);
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                memcpy(&f, &arg, sizeof(f));
+                snprintf(piece, sizeof(piece), spec, (double)f);
+                break;
+            case 'p':
+                snprintf(piece, sizeof(piece), "0x%08x", (unsigned)arg);
+                break;
+            default:
+                snprintf(piece, sizeof(piece), "<?>");
+                break;
+        }
+        FormatAppend(out, outSize, &len, piece);
+    }
+
+    if (len < outSize) {
+        out[len] = '\0';
+    }
+    else {
+        out[outSize - 1] = '\0';
+    }
+    return (int)len;
+}
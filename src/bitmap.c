@@ -0,0 +1,317 @@
+/**
+ * @file bitmap.c
+ * @brief 带多级摘要的位图，查找第一个置位/清零位只需逐层各一次CTZ，可用于编号分配
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "bitmap.h"
+
+#define SUMMARY_SET   0
+#define SUMMARY_CLEAR 1
+
+/**
+ * @brief 第wordIndex个字中有效位的掩码，末字超出bitCount的位不参与查找
+ */
+static inline uint32_t ValidMask(const RcsBitmapHandle_t *handle, uint32_t wordIndex)
+{
+    uint32_t tail = handle->bitCount & 31;
+    if (wordIndex + 1 < handle->wordCount || tail == 0) {
+        return 0xFFFFFFFFu;
+    }
+    return (1u << tail) - 1;
+}
+
+/**
+ * @brief 自底向上修改摘要位，某层字的"是否为零"不变时上层无需再改
+ */
+static void Propagate(RcsBitmapHandle_t *handle, int kind, uint32_t index, int flag)
+{
+    for (int level = 0; level < RCS_BITMAP_LEVELS - 1; level++) {
+        uint32_t *word = &handle->summary[kind][level][index >> 5];
+        uint32_t before = *word;
+        if (flag) {
+            *word |= 1u << (index & 31);
+        }
+        else {
+            *word &= ~(1u << (index & 31));
+        }
+        if ((before != 0) == (*word != 0)) {
+            break;
+        }
+        flag = (*word != 0);
+        index >>= 5;
+    }
+}
+
+/**
+ * @brief 写入位图的一个字，并维护计数与两类摘要
+ */
+static void UpdateWord(RcsBitmapHandle_t *handle, uint32_t wordIndex, uint32_t value)
+{
+    uint32_t old = handle->bits[wordIndex];
+    if (old == value) {
+        return;
+    }
+    handle->bits[wordIndex] = value;
+    handle->setCount = handle->setCount - BitmapPortPopcount32(old) + BitmapPortPopcount32(value);
+
+    if ((old != 0) != (value != 0)) {
+        Propagate(handle, SUMMARY_SET, wordIndex, value != 0);
+    }
+    uint32_t mask = ValidMask(handle, wordIndex);
+    int oldHasClear = (old & mask) != mask;
+    int newHasClear = (value & mask) != mask;
+    if (oldHasClear != newHasClear) {
+        Propagate(handle, SUMMARY_CLEAR, wordIndex, newHasClear);
+    }
+}
+
+/**
+ * @brief 对[start, start+count)逐字套用掩码置位或清零
+ */
+static int ApplyRange(RcsBitmap_t bitmap, size_t start, size_t count, int set)
+{
+    if (bitmap == NULL) {
+        return RCS_BITMAP_INVALID_PARAM;
+    }
+    RcsBitmapHandle_t *handle = (RcsBitmapHandle_t *)bitmap;
+    if (start > handle->bitCount || count > handle->bitCount - start) {
+        return RCS_BITMAP_INVALID_PARAM;
+    }
+
+    while (count > 0) {
+        uint32_t wordIndex = (uint32_t)(start >> 5);
+        uint32_t offset = (uint32_t)(start & 31);
+        uint32_t n = (count < 32 - offset) ? (uint32_t)count : 32 - offset;
+        uint32_t mask = (n == 32) ? 0xFFFFFFFFu : (((1u << n) - 1) << offset);
+
+        uint32_t value = handle->bits[wordIndex];
+        UpdateWord(handle, wordIndex, set ? (value | mask) : (value & ~mask));
+        start += n;
+        count -= n;
+    }
+    return RCS_BITMAP_OK;
+}
+
+/**
+ * @brief 自顶向下逐层取最低位，到达位图本身后得到位下标
+ */
+static int FindFirst(RcsBitmap_t bitmap, int kind)
+{
+    if (bitmap == NULL) {
+        return RCS_BITMAP_INVALID_PARAM;
+    }
+    RcsBitmapHandle_t *handle = (RcsBitmapHandle_t *)bitmap;
+
+    uint32_t index = 0;
+    for (int level = RCS_BITMAP_LEVELS - 2; level >= 0; level--) {
+        uint32_t word = handle->summary[kind][level][index];
+        if (word == 0) {
+            return RCS_BITMAP_NOT_FOUND;
+        }
+        index = (index << 5) + BitmapPortCtz32(word);
+    }
+
+    uint32_t word = handle->bits[index];
+    if (kind == SUMMARY_CLEAR) {
+        word = ~word & ValidMask(handle, index);
+    }
+    return (int)((index << 5) + BitmapPortCtz32(word));
+}
+
+/**
+ * @brief 使用静态申请的方式创建位图，初始全部清零
+ * @param bitCount 位数，不超过RCS_BITMAP_MAX_BITS
+ * @param staticHandle 静态的位图句柄
+ * @param bitmapMemory 静态内存，长度至少为RCS_BITMAP_MEM_WORDS(bitCount)个字
+ * @return 返回位图句柄
+ */
+RcsBitmap_t RcsBitmapCreateStatic(size_t bitCount, RcsBitmapHandle_t *staticHandle, uint32_t *bitmapMemory)
+{
+    if (staticHandle == NULL || bitmapMemory == NULL || bitCount == 0 || bitCount > RCS_BITMAP_MAX_BITS) {
+        return NULL;
+    }
+
+    uint32_t levelWords[RCS_BITMAP_LEVELS];
+    levelWords[0] = RCS_BITMAP_WORDS(bitCount);
+    for (int level = 1; level < RCS_BITMAP_LEVELS; level++) {
+        levelWords[level] = RCS_BITMAP_WORDS(levelWords[level - 1]);
+    }
+
+    uint32_t *cursor = bitmapMemory;
+    staticHandle->bits = cursor;
+    cursor += levelWords[0];
+    for (int kind = SUMMARY_SET; kind <= SUMMARY_CLEAR; kind++) {
+        for (int level = 0; level < RCS_BITMAP_LEVELS - 1; level++) {
+            staticHandle->summary[kind][level] = cursor;
+            cursor += levelWords[level + 1];
+        }
+    }
+    memset(bitmapMemory, 0, (size_t)(cursor - bitmapMemory) * sizeof(uint32_t));
+
+    staticHandle->wordCount = levelWords[0];
+    staticHandle->bitCount = (uint32_t)bitCount;
+    staticHandle->setCount = 0;
+
+    // 全部清零时每个字都含清零位
+    for (uint32_t i = 0; i < levelWords[0]; i++) {
+        Propagate(staticHandle, SUMMARY_CLEAR, i, 1);
+    }
+    return (RcsBitmap_t)staticHandle;
+}
+
+/**
+ * @brief 使用动态申请的方式创建位图
+ * @param bitCount 位数
+ * @return 返回位图句柄
+ */
+RcsBitmap_t RcsBitmapCreate(size_t bitCount)
+{
+    if (bitCount == 0 || bitCount > RCS_BITMAP_MAX_BITS) {
+        return NULL;
+    }
+
+    RcsBitmapHandle_t *handle = (RcsBitmapHandle_t *)BitmapPortMalloc(sizeof(RcsBitmapHandle_t));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    uint32_t *mem = (uint32_t *)BitmapPortMalloc(RCS_BITMAP_MEM_WORDS(bitCount) * sizeof(uint32_t));
+    if (mem == NULL) {
+        BitmapPortFree(handle);
+        return NULL;
+    }
+
+    return RcsBitmapCreateStatic(bitCount, handle, mem);
+}
+
+/**
+ * @brief 销毁位图
+ * @param bitmap 位图句柄
+ * @warning 请勿传入静态位图句柄
+ */
+void RcsBitmapDestroy(RcsBitmap_t bitmap)
+{
+    if (bitmap == NULL) {
+        return;
+    }
+    RcsBitmapHandle_t *handle = (RcsBitmapHandle_t *)bitmap;
+    BitmapPortFree(handle->bits);
+    BitmapPortFree(handle);
+}
+
+/**
+ * @brief 置位
+ * @param bitmap 位图句柄
+ * @param index 位下标
+ * @return 返回错误码
+ */
+int RcsBitmapSet(RcsBitmap_t bitmap, size_t index)
+{
+    return ApplyRange(bitmap, index, 1, 1);
+}
+
+/**
+ * @brief 清零
+ * @param bitmap 位图句柄
+ * @param index 位下标
+ * @return 返回错误码
+ */
+int RcsBitmapClear(RcsBitmap_t bitmap, size_t index)
+{
+    return ApplyRange(bitmap, index, 1, 0);
+}
+
+/**
+ * @brief 读取一位
+ * @param bitmap 位图句柄
+ * @param index 位下标
+ * @return 置位返回1，清零返回0，参数错误返回错误码
+ */
+int RcsBitmapIsSet(RcsBitmap_t bitmap, size_t index)
+{
+    if (bitmap == NULL || index >= ((RcsBitmapHandle_t *)bitmap)->bitCount) {
+        return RCS_BITMAP_INVALID_PARAM;
+    }
+    RcsBitmapHandle_t *handle = (RcsBitmapHandle_t *)bitmap;
+    return (int)((handle->bits[index >> 5] >> (index & 31)) & 1u);
+}
+
+/**
+ * @brief 将[start, start+count)全部置位，按字批量处理
+ * @param bitmap 位图句柄
+ * @param start 起始位下标
+ * @param count 位数
+ * @return 返回错误码
+ */
+int RcsBitmapSetRange(RcsBitmap_t bitmap, size_t start, size_t count)
+{
+    return ApplyRange(bitmap, start, count, 1);
+}
+
+/**
+ * @brief 将[start, start+count)全部清零，按字批量处理
+ * @param bitmap 位图句柄
+ * @param start 起始位下标
+ * @param count 位数
+ * @return 返回错误码
+ */
+int RcsBitmapClearRange(RcsBitmap_t bitmap, size_t start, size_t count)
+{
+    return ApplyRange(bitmap, start, count, 0);
+}
+
+/**
+ * @brief 查找下标最小的置位
+ * @param bitmap 位图句柄
+ * @return 返回位下标，全部清零时返回RCS_BITMAP_NOT_FOUND
+ */
+int RcsBitmapFindFirstSet(RcsBitmap_t bitmap)
+{
+    return FindFirst(bitmap, SUMMARY_SET);
+}
+
+/**
+ * @brief 查找下标最小的清零位
+ * @param bitmap 位图句柄
+ * @return 返回位下标，全部置位时返回RCS_BITMAP_NOT_FOUND
+ */
+int RcsBitmapFindFirstClear(RcsBitmap_t bitmap)
+{
+    return FindFirst(bitmap, SUMMARY_CLEAR);
+}
+
+/**
+ * @brief 分配编号：查找下标最小的清零位并置位
+ * @param bitmap 位图句柄
+ * @return 返回编号，已全部分配时返回RCS_BITMAP_NOT_FOUND
+ */
+int RcsBitmapAlloc(RcsBitmap_t bitmap)
+{
+    int index = FindFirst(bitmap, SUMMARY_CLEAR);
+    if (index < 0) {
+        return index;
+    }
+    RcsBitmapHandle_t *handle = (RcsBitmapHandle_t *)bitmap;
+    UpdateWord(handle, (uint32_t)index >> 5, handle->bits[index >> 5] | (1u << (index & 31)));
+    return index;
+}
+
+/**
+ * @brief 获取置位个数
+ * @param bitmap 位图句柄
+ * @return 返回置位个数
+ */
+size_t RcsBitmapGetSetCount(RcsBitmap_t bitmap)
+{
+    if (bitmap == NULL) {
+        return 0;
+    }
+    return ((RcsBitmapHandle_t *)bitmap)->setCount;
+}
@@ -0,0 +1,210 @@
+/**
+ * @file block_pool.c
+ * @brief 固定块内存池，O(1)申请与释放，可作为FIFO的分配器
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "block_pool.h"
+
+static void InitHandle(RcsPoolHandle_t *handle, uint8_t *mem, size_t blockSize, size_t blockCount)
+{
+    handle->mem = mem;
+    handle->blockSize = blockSize;
+    handle->blockCount = blockCount;
+    handle->freeCount = blockCount;
+    handle->nextUnused = 0;
+    handle->freeList = NULL;
+    handle->allocated = (uint32_t *)(mem + blockSize * blockCount);
+    memset(handle->allocated, 0, RCS_POOL_BITMAP_WORDS(blockCount) * sizeof(uint32_t));
+#if defined(__linux__)
+    pthread_mutex_init(&handle->hostLock, NULL);
+#endif
+}
+
+static void *PoolAllocatorAlloc(void *ctx, size_t size)
+{
+    RcsPoolHandle_t *handle = (RcsPoolHandle_t *)ctx;
+    if (size > handle->blockSize) {
+        return NULL;
+    }
+    return RcsPoolAlloc(ctx);
+}
+
+static void PoolAllocatorFree(void *ctx, void *ptr)
+{
+    RcsPoolFree(ctx, ptr);
+}
+
+/**
+ * @brief 使用静态申请的方式创建内存池
+ * @param blockSize 块大小，会按指针大小向上对齐
+ * @param blockCount 块数量
+ * @param staticHandle 静态的内存池句柄
+ * @param poolMemory 静态内存，大小至少为RCS_POOL_MEM_SIZE(blockSize, blockCount)，按指针对齐
+ * @return 返回内存池句柄
+ */
+RcsPool_t RcsPoolCreateStatic(size_t blockSize, size_t blockCount, RcsPoolHandle_t *staticHandle, uint8_t *poolMemory)
+{
+    if (staticHandle == NULL || poolMemory == NULL || blockSize == 0 || blockCount == 0) {
+        return NULL;
+    }
+    if (((uintptr_t)poolMemory & (RCS_POOL_ALIGN - 1)) != 0) {
+        return NULL;
+    }
+
+    InitHandle(staticHandle, poolMemory, RCS_POOL_BLOCK_SIZE(blockSize), blockCount);
+    return (RcsPool_t)staticHandle;
+}
+
+/**
+ * @brief 使用动态申请的方式创建内存池
+ * @param blockSize 块大小，会按指针大小向上对齐
+ * @param blockCount 块数量
+ * @return 返回内存池句柄
+ */
+RcsPool_t RcsPoolCreate(size_t blockSize, size_t blockCount)
+{
+    if (blockSize == 0 || blockCount == 0) {
+        return NULL;
+    }
+
+    RcsPoolHandle_t *handle = (RcsPoolHandle_t *)PoolPortMalloc(sizeof(RcsPoolHandle_t));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    uint8_t *mem = (uint8_t *)PoolPortMalloc(RCS_POOL_MEM_SIZE(blockSize, blockCount));
+    if (mem == NULL) {
+        PoolPortFree(handle);
+        return NULL;
+    }
+
+    InitHandle(handle, mem, RCS_POOL_BLOCK_SIZE(blockSize), blockCount);
+    return (RcsPool_t)handle;
+}
+
+/**
+ * @brief 销毁内存池
+ * @param pool 内存池句柄
+ * @warning 请勿传入静态内存池句柄
+ */
+void RcsPoolDestroy(RcsPool_t pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    RcsPoolHandle_t *handle = (RcsPoolHandle_t *)pool;
+#if defined(__linux__)
+    pthread_mutex_destroy(&handle->hostLock);
+#endif
+    PoolPortFree(handle->mem);
+    PoolPortFree(handle);
+}
+
+/**
+ * @brief 从内存池申请一个块，可在中断中调用
+ * @param pool 内存池句柄
+ * @return 返回块的地址，内存池耗尽时返回NULL
+ */
+void *RcsPoolAlloc(RcsPool_t pool)
+{
+    if (pool == NULL) {
+        return NULL;
+    }
+    RcsPoolHandle_t *handle = (RcsPoolHandle_t *)pool;
+    void *block = NULL;
+    PoolPortEnterCriticalFromAll(handle);
+
+    if (handle->freeList != NULL) {
+        block = handle->freeList;
+        handle->freeList = *(void **)block;
+        handle->freeCount--;
+    }
+    else if (handle->nextUnused < handle->blockCount) {
+        block = &handle->mem[handle->nextUnused * handle->blockSize];
+        handle->nextUnused++;
+        handle->freeCount--;
+    }
+    if (block != NULL) {
+        size_t index = (size_t)((uint8_t *)block - handle->mem) / handle->blockSize;
+        handle->allocated[index / 32] |= 1u << (index % 32);
+    }
+
+    PoolPortExitCriticalFromAll(handle);
+    return block;
+}
+
+/**
+ * @brief 将块归还给内存池，可在中断中调用
+ * @param pool 内存池句柄
+ * @param block 由RcsPoolAlloc返回的块
+ * @return 返回错误码，块不属于该内存池、从未分配过或已经释放时返回RCS_POOL_INVALID_PARAM
+ */
+int RcsPoolFree(RcsPool_t pool, void *block)
+{
+    if (pool == NULL || block == NULL) {
+        return RCS_POOL_INVALID_PARAM;
+    }
+    RcsPoolHandle_t *handle = (RcsPoolHandle_t *)pool;
+
+    uintptr_t offset = (uintptr_t)block - (uintptr_t)handle->mem;
+    if ((uintptr_t)block < (uintptr_t)handle->mem ||
+        offset >= handle->blockSize * handle->blockCount ||
+        offset % handle->blockSize != 0) {
+        return RCS_POOL_INVALID_PARAM;
+    }
+
+    PoolPortEnterCriticalFromAll(handle);
+
+    // 尚未切出或已经释放的块不在任何人手中，归还后会被再次分出
+    size_t index = offset / handle->blockSize;
+    uint32_t bit = 1u << (index % 32);
+    if (index >= handle->nextUnused || (handle->allocated[index / 32] & bit) == 0) {
+        PoolPortExitCriticalFromAll(handle);
+        return RCS_POOL_INVALID_PARAM;
+    }
+    handle->allocated[index / 32] &= ~bit;
+
+    *(void **)block = handle->freeList;
+    handle->freeList = block;
+    handle->freeCount++;
+
+    PoolPortExitCriticalFromAll(handle);
+    return RCS_POOL_OK;
+}
+
+/**
+ * @brief 获取内存池中剩余的块数
+ * @param pool 内存池句柄
+ * @return 返回剩余块数
+ */
+size_t RcsPoolGetFree(RcsPool_t pool)
+{
+    if (pool == NULL) {
+        return 0;
+    }
+    return ((RcsPoolHandle_t *)pool)->freeCount;
+}
+
+/**
+ * @brief 获取以该内存池为后端的分配器，申请大小超过块大小时分配失败
+ * @param pool 内存池句柄
+ * @param allocator 返回的分配器
+ * @return 返回错误码
+ */
+int RcsPoolGetAllocator(RcsPool_t pool, RcsAllocator_t *allocator)
+{
+    if (pool == NULL || allocator == NULL) {
+        return RCS_POOL_INVALID_PARAM;
+    }
+    allocator->alloc = PoolAllocatorAlloc;
+    allocator->free = PoolAllocatorFree;
+    allocator->ctx = pool;
+    return RCS_POOL_OK;
+}
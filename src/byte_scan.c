@@ -0,0 +1,417 @@
+/**
+ * @file byte_scan.c
+ * @brief 在内存块与FIFO两段视图上查找字节或字节集合（主机端SSE2/AVX2/NEON，MCU上按字SWAR），
+ *        以及以零拷贝视图交付整行的行读取器
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "byte_scan.h"
+
+#if RCS_SCAN_USE_SIMD && defined(__x86_64__)
+#include <immintrin.h>
+#define SCAN_HAVE_SSE2 1
+#elif RCS_SCAN_USE_SIMD && defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SCAN_HAVE_NEON 1
+#endif
+
+// 对齐后按字读取，允许与uint8_t别名
+typedef uint32_t __attribute__((may_alias)) ScanWord_t;
+
+#define SWAR_ONES  0x01010101u
+#define SWAR_HIGHS 0x80808080u
+
+// 最低的置位字节即第一个为0的字节（小端），更高位可能因借位误报，但不影响最低位
+#define SWAR_HAS_ZERO(x) (((x) - SWAR_ONES) & ~(x) & SWAR_HIGHS)
+
+static inline int IsNeedle(uint8_t byte, const uint8_t needles[RCS_BYTESET_FAST_MAX])
+{
+    return (byte == needles[0]) | (byte == needles[1]) | (byte == needles[2]) | (byte == needles[3]);
+}
+
+/**
+ * @brief 按32位字并行比较，先逐字节走到字对齐处，Cortex-M0等不支持非对齐访问的内核也可使用
+ */
+static size_t FindSwar(const uint8_t *data, size_t size, const uint8_t needles[RCS_BYTESET_FAST_MAX])
+{
+    size_t i = 0;
+    while (i < size && ((uintptr_t)(data + i) & 3) != 0) {
+        if (IsNeedle(data[i], needles)) {
+            return i;
+        }
+        i++;
+    }
+
+    uint32_t k0 = needles[0] * SWAR_ONES;
+    uint32_t k1 = needles[1] * SWAR_ONES;
+    uint32_t k2 = needles[2] * SWAR_ONES;
+    uint32_t k3 = needles[3] * SWAR_ONES;
+    for (; i + 4 <= size; i += 4) {
+        uint32_t word = *(const ScanWord_t *)(data + i);
+        uint32_t x0 = word ^ k0, x1 = word ^ k1, x2 = word ^ k2, x3 = word ^ k3;
+        uint32_t hit = SWAR_HAS_ZERO(x0) | SWAR_HAS_ZERO(x1) | SWAR_HAS_ZERO(x2) | SWAR_HAS_ZERO(x3);
+        if (hit != 0) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            break;   // 大端时交给下面逐字节定位
+#else
+            return i + ((size_t)__builtin_ctz(hit) >> 3);
+#endif
+        }
+    }
+
+    for (; i < size; i++) {
+        if (IsNeedle(data[i], needles)) {
+            return i;
+        }
+    }
+    return size;
+}
+
+#if defined(SCAN_HAVE_SSE2)
+static size_t FindSse2(const uint8_t *data, size_t size, const uint8_t needles[RCS_BYTESET_FAST_MAX])
+{
+    __m128i n0 = _mm_set1_epi8((char)needles[0]);
+    __m128i n1 = _mm_set1_epi8((char)needles[1]);
+    __m128i n2 = _mm_set1_epi8((char)needles[2]);
+    __m128i n3 = _mm_set1_epi8((char)needles[3]);
+    size_t i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, n0), _mm_cmpeq_epi8(v, n1)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(v, n2), _mm_cmpeq_epi8(v, n3)));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(eq);
+        if (mask != 0) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+    return i + FindSwar(data + i, size - i, needles);
+}
+
+__attribute__((target("avx2")))
+static size_t FindAvx2(const uint8_t *data, size_t size, const uint8_t needles[RCS_BYTESET_FAST_MAX])
+{
+    __m256i n0 = _mm256_set1_epi8((char)needles[0]);
+    __m256i n1 = _mm256_set1_epi8((char)needles[1]);
+    __m256i n2 = _mm256_set1_epi8((char)needles[2]);
+    __m256i n3 = _mm256_set1_epi8((char)needles[3]);
+    size_t i = 0;
+
+    for (; i + 32 <= size; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(data + i));
+        __m256i eq = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, n0), _mm256_cmpeq_epi8(v, n1)),
+                                     _mm256_or_si256(_mm256_cmpeq_epi8(v, n2), _mm256_cmpeq_epi8(v, n3)));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(eq);
+        if (mask != 0) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+    return i + FindSse2(data + i, size - i, needles);
+}
+
+static int ScanAvx2Supported(void)
+{
+    static int supported = -1;
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return supported;
+}
+#endif
+
+#if defined(SCAN_HAVE_NEON)
+static size_t FindNeon(const uint8_t *data, size_t size, const uint8_t needles[RCS_BYTESET_FAST_MAX])
+{
+    uint8x16_t n0 = vdupq_n_u8(needles[0]);
+    uint8x16_t n1 = vdupq_n_u8(needles[1]);
+    uint8x16_t n2 = vdupq_n_u8(needles[2]);
+    uint8x16_t n3 = vdupq_n_u8(needles[3]);
+    size_t i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        uint8x16_t v = vld1q_u8(data + i);
+        uint8x16_t eq = vorrq_u8(vorrq_u8(vceqq_u8(v, n0), vceqq_u8(v, n1)),
+                                 vorrq_u8(vceqq_u8(v, n2), vceqq_u8(v, n3)));
+        // 每字节压缩为4位，得到64位掩码
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        if (mask != 0) {
+            return i + ((size_t)__builtin_ctzll(mask) >> 2);
+        }
+    }
+    return i + FindSwar(data + i, size - i, needles);
+}
+#endif
+
+/**
+ * @brief 按平台选择最快的实现
+ */
+static size_t FindFast(const uint8_t *data, size_t size, const uint8_t needles[RCS_BYTESET_FAST_MAX])
+{
+#if defined(SCAN_HAVE_SSE2)
+    if (size >= 32 && ScanAvx2Supported()) {
+        return FindAvx2(data, size, needles);
+    }
+    return FindSse2(data, size, needles);
+#elif defined(SCAN_HAVE_NEON)
+    return FindNeon(data, size, needles);
+#else
+    return FindSwar(data, size, needles);
+#endif
+}
+
+static size_t FindInSet(const uint8_t *data, size_t size, const RcsByteSet_t *set)
+{
+    if (set->count <= RCS_BYTESET_FAST_MAX) {
+        return FindFast(data, size, set->bytes);
+    }
+    for (size_t i = 0; i < size; i++) {
+        if ((set->bits[data[i] >> 5] >> (data[i] & 31)) & 1) {
+            return i;
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief 初始化字节集合
+ * @param set 字节集合
+ * @param bytes 成员
+ * @param count 成员个数，重复的成员只计一次
+ * @return 返回错误码
+ */
+int RcsByteSetInit(RcsByteSet_t *set, const void *bytes, size_t count)
+{
+    if (set == NULL || bytes == NULL || count == 0) {
+        return RCS_LINE_INVALID_PARAM;
+    }
+
+    const uint8_t *in = (const uint8_t *)bytes;
+    memset(set, 0, sizeof(RcsByteSet_t));
+    for (size_t i = 0; i < count; i++) {
+        uint8_t byte = in[i];
+        if ((set->bits[byte >> 5] >> (byte & 31)) & 1) {
+            continue;
+        }
+        set->bits[byte >> 5] |= 1u << (byte & 31);
+        if (set->count < RCS_BYTESET_FAST_MAX) {
+            set->bytes[set->count] = byte;
+        }
+        set->count++;
+    }
+    for (size_t i = set->count; i < RCS_BYTESET_FAST_MAX; i++) {
+        set->bytes[i] = set->bytes[0];
+    }
+    return RCS_LINE_OK;
+}
+
+/**
+ * @brief 查找第一个等于byte的字节
+ * @param data 数据
+ * @param size 数据长度
+ * @param byte 要查找的字节
+ * @return 返回下标，找不到时返回size
+ */
+size_t RcsMemFindByte(const void *data, size_t size, uint8_t byte)
+{
+    if (data == NULL) {
+        return size;
+    }
+    const uint8_t needles[RCS_BYTESET_FAST_MAX] = {byte, byte, byte, byte};
+    return FindFast((const uint8_t *)data, size, needles);
+}
+
+/**
+ * @brief 查找第一个属于字节集合的字节
+ * @param data 数据
+ * @param size 数据长度
+ * @param set 字节集合
+ * @return 返回下标，找不到时返回size
+ */
+size_t RcsMemFindSet(const void *data, size_t size, const RcsByteSet_t *set)
+{
+    if (data == NULL || set == NULL || set->count == 0) {
+        return size;
+    }
+    return FindInSet((const uint8_t *)data, size, set);
+}
+
+/**
+ * @brief 从offset起在两段视图上查找，set为NULL时直接比较needles
+ */
+static size_t ViewFind(const RcsFifoView_t *view, size_t offset, const uint8_t needles[RCS_BYTESET_FAST_MAX],
+                       const RcsByteSet_t *set)
+{
+    size_t total = view->len[0] + view->len[1];
+    for (int i = 0; i < 2; i++) {
+        if (offset >= view->len[i]) {
+            offset -= view->len[i];
+            continue;
+        }
+        size_t size = view->len[i] - offset;
+        size_t hit = (set != NULL) ? FindInSet(view->seg[i] + offset, size, set)
+                                   : FindFast(view->seg[i] + offset, size, needles);
+        if (hit < size) {
+            return (i == 0) ? offset + hit : view->len[0] + offset + hit;
+        }
+        offset = 0;
+    }
+    return total;
+}
+
+/**
+ * @brief 从offset起在两段视图上查找字节
+ * @param view 视图
+ * @param offset 起始偏移
+ * @param byte 要查找的字节
+ * @return 返回相对视图起点的偏移，找不到时返回视图长度
+ */
+size_t RcsFifoViewFindByte(const RcsFifoView_t *view, size_t offset, uint8_t byte)
+{
+    if (view == NULL) {
+        return 0;
+    }
+    const uint8_t needles[RCS_BYTESET_FAST_MAX] = {byte, byte, byte, byte};
+    return ViewFind(view, offset, needles, NULL);
+}
+
+/**
+ * @brief 从offset起在两段视图上查找属于字节集合的字节
+ * @param view 视图
+ * @param offset 起始偏移
+ * @param set 字节集合
+ * @return 返回相对视图起点的偏移，找不到时返回视图长度
+ */
+size_t RcsFifoViewFindSet(const RcsFifoView_t *view, size_t offset, const RcsByteSet_t *set)
+{
+    if (view == NULL) {
+        return 0;
+    }
+    if (set == NULL || set->count == 0) {
+        return view->len[0] + view->len[1];
+    }
+    return ViewFind(view, offset, set->bytes, set);
+}
+
+/**
+ * @brief 初始化行读取器
+ * @param reader 行读取器
+ * @param fifo 接收FIFO
+ * @param delim 行分隔符，通常为'\n'
+ * @param maxLine 不含行尾的最大行长，连同"\r\n"必须能放入FIFO
+ * @return 返回错误码
+ */
+int RcsLineReaderInit(RcsLineReader_t *reader, RcsFifo_t fifo, uint8_t delim, size_t maxLine)
+{
+    if (reader == NULL || fifo == NULL || maxLine == 0 || maxLine + 2 >= ((RcsFifoHandle_t *)fifo)->memSize) {
+        return RCS_LINE_INVALID_PARAM;
+    }
+    memset(reader, 0, sizeof(RcsLineReader_t));
+    reader->fifo = fifo;
+    reader->delim = delim;
+    reader->maxLine = maxLine;
+    reader->overruns = RcsFifoGetOverrunCount(fifo);
+    return RCS_LINE_OK;
+}
+
+/**
+ * @brief 取出下一整行，行内容以两段视图给出，直接指向FIFO内存
+ * @param reader 行读取器
+ * @param line 返回行视图，不含分隔符；分隔符为'\n'时同时去掉行尾的'\r'
+ * @return 返回行长度，没有完整的行时返回RCS_LINE_NONE，超长时返回RCS_LINE_TOO_LONG
+ * @note 成功时必须调用RcsLineRelease释放该行后才能读取下一行；未完成的行下次调用时不会重复扫描
+ */
+int RcsLineRead(RcsLineReader_t *reader, RcsFifoView_t *line)
+{
+    if (reader == NULL || line == NULL) {
+        return RCS_LINE_INVALID_PARAM;
+    }
+
+    // 外部写入者覆盖时FIFO已丢弃未读数据，已扫描的偏移与丢弃状态随之失效
+    size_t used = RcsFifoGetUsed(reader->fifo);
+    uint32_t overruns = RcsFifoGetOverrunCount(reader->fifo);
+    if (overruns != reader->overruns || used < reader->scanned) {
+        reader->overruns = overruns;
+        reader->scanned = 0;
+        reader->discarding = 0;
+    }
+    if (used <= reader->scanned) {
+        return RCS_LINE_NONE;
+    }
+    int first = RcsFifoRecvAcquire(reader->fifo, used, reader->memAcquired);
+    if (first == RCS_FIFO_OVERRUN) {
+        reader->scanned = 0;
+        reader->discarding = 0;
+    }
+    if (first < 0) {
+        return (first == RCS_FIFO_NO_DATA || first == RCS_FIFO_OVERRUN) ? RCS_LINE_NONE : RCS_LINE_ERROR;
+    }
+
+    RcsFifoView_t view;
+    RcsFifoViewInit(&view, reader->memAcquired, (size_t)first, used);
+    size_t pos = RcsFifoViewFindByte(&view, reader->scanned, reader->delim);
+
+    if (reader->discarding) {
+        // 超长行的其余部分，已报告过RCS_LINE_TOO_LONG，不再重复报告
+        if (pos == used) {
+            RcsFifoRecvCompletePartial(reader->fifo, (const void **)reader->memAcquired, used);
+            return RCS_LINE_NONE;
+        }
+        RcsFifoRecvCompletePartial(reader->fifo, (const void **)reader->memAcquired, pos + 1);
+        reader->discarding = 0;
+        return RcsLineRead(reader, line);
+    }
+
+    if (pos == used) {
+        // 多留一个字节给尚未等到'\n'的'\r'
+        if (used > reader->maxLine + 1) {
+            RcsFifoRecvCompletePartial(reader->fifo, (const void **)reader->memAcquired, used);
+            reader->scanned = 0;
+            reader->discarding = 1;
+            return RCS_LINE_TOO_LONG;
+        }
+        RcsFifoRecvCompletePartial(reader->fifo, (const void **)reader->memAcquired, 0);
+        reader->scanned = used;
+        return RCS_LINE_NONE;
+    }
+
+    size_t len = pos;
+    if (reader->delim == '\n' && len > 0) {
+        uint8_t last;
+        RcsFifoViewCopy(&view, len - 1, &last, 1);
+        if (last == '\r') {
+            len--;
+        }
+    }
+    if (len > reader->maxLine) {
+        // 超长行：丢弃到分隔符（含）为止
+        RcsFifoRecvCompletePartial(reader->fifo, (const void **)reader->memAcquired, pos + 1);
+        reader->scanned = 0;
+        return RCS_LINE_TOO_LONG;
+    }
+    RcsFifoViewSlice(&view, 0, len, line);
+    reader->consumed = pos + 1;
+    reader->scanned = 0;
+    return (int)len;
+}
+
+/**
+ * @brief 释放RcsLineRead取出的行
+ * @param reader 行读取器
+ * @return 返回错误码
+ */
+int RcsLineRelease(RcsLineReader_t *reader)
+{
+    if (reader == NULL || reader->consumed == 0) {
+        return RCS_LINE_INVALID_PARAM;
+    }
+    int ret = RcsFifoRecvCompletePartial(reader->fifo, (const void **)reader->memAcquired, reader->consumed);
+    reader->consumed = 0;
+    return (ret == RCS_FIFO_OK) ? RCS_LINE_OK : RCS_LINE_ERROR;
+}
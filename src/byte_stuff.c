@@ -0,0 +1,337 @@
+/**
+ * @file byte_stuff.c
+ * @brief COBS与SLIP字节填充编解码：编码直接写入FIFO的发送申请区域，解码在接收视图上增量进行
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "byte_stuff.h"
+
+/**
+ * @brief 发送申请区域的顺序写入器，跨越两段时自动换段
+ */
+typedef struct
+{
+    uint8_t *seg[2];
+    size_t   len[2];
+    size_t   pos;
+}SegWriter_t;
+
+typedef void (*EncodeFunc_t)(SegWriter_t *writer, const uint8_t *data, size_t size);
+typedef int (*DecodeByteFunc_t)(RcsStuffDecoder_t *decoder, uint8_t byte);
+
+static inline uint8_t *WriterAt(SegWriter_t *writer, size_t pos)
+{
+    return (pos < writer->len[0]) ? &writer->seg[0][pos] : &writer->seg[1][pos - writer->len[0]];
+}
+
+static inline void WriterPut(SegWriter_t *writer, uint8_t byte)
+{
+    *WriterAt(writer, writer->pos++) = byte;
+}
+
+/**
+ * @brief COBS编码，每个编码字节在其块结束后回填
+ */
+static void CobsEncode(SegWriter_t *writer, const uint8_t *data, size_t size)
+{
+    size_t codePos = writer->pos++;
+    uint8_t code = 1;
+
+    for (size_t i = 0; i < size; i++) {
+        if (data[i] == 0) {
+            *WriterAt(writer, codePos) = code;
+            codePos = writer->pos++;
+            code = 1;
+            continue;
+        }
+        WriterPut(writer, data[i]);
+        // 满254字节的块，若数据恰好结束则不再开新块，保持最短编码
+        if (++code == 0xFF && i + 1 < size) {
+            *WriterAt(writer, codePos) = code;
+            codePos = writer->pos++;
+            code = 1;
+        }
+    }
+    *WriterAt(writer, codePos) = code;
+    WriterPut(writer, 0x00);
+}
+
+/**
+ * @brief SLIP编码，帧首尾各一个END，首部的END用于冲掉线路上的残余字节
+ */
+static void SlipEncode(SegWriter_t *writer, const uint8_t *data, size_t size)
+{
+    WriterPut(writer, RCS_SLIP_END);
+    for (size_t i = 0; i < size; i++) {
+        if (data[i] == RCS_SLIP_END) {
+            WriterPut(writer, RCS_SLIP_ESC);
+            WriterPut(writer, RCS_SLIP_ESC_END);
+        }
+        else if (data[i] == RCS_SLIP_ESC) {
+            WriterPut(writer, RCS_SLIP_ESC);
+            WriterPut(writer, RCS_SLIP_ESC_ESC);
+        }
+        else {
+            WriterPut(writer, data[i]);
+        }
+    }
+    WriterPut(writer, RCS_SLIP_END);
+}
+
+/**
+ * @brief 按最坏情况申请发送空间，原地编码后只提交实际长度
+ */
+static int EncodeToFifo(RcsFifo_t fifo, const void *data, size_t size, size_t maxEncoded, EncodeFunc_t encode)
+{
+    if (fifo == NULL || (data == NULL && size != 0)) {
+        return RCS_STUFF_INVALID_PARAM;
+    }
+
+    void *memAcquired[2] = {NULL, NULL};
+    int first = RcsFifoSendAcquire(fifo, maxEncoded, memAcquired);
+    if (first < 0) {
+        return (first == RCS_FIFO_NO_SPACE) ? RCS_STUFF_NO_SPACE : RCS_STUFF_ERROR;
+    }
+
+    SegWriter_t writer = {
+        {(uint8_t *)memAcquired[0], (uint8_t *)memAcquired[1]},
+        {(size_t)first, maxEncoded - (size_t)first},
+        0,
+    };
+    encode(&writer, (const uint8_t *)data, size);
+
+    RcsFifoSendCompletePartial(fifo, (const void **)memAcquired, writer.pos);
+    return (int)writer.pos;
+}
+
+static inline void DecoderAppend(RcsStuffDecoder_t *decoder, uint8_t byte)
+{
+    if (decoder->len >= decoder->outSize) {
+        decoder->broken = 1;
+        return;
+    }
+    decoder->out[decoder->len++] = byte;
+}
+
+/**
+ * @brief 帧定界符到达时给出结果并复位状态，len保留给调用者读取
+ */
+static int DecoderFinish(RcsStuffDecoder_t *decoder, int incomplete)
+{
+    int ret = (decoder->broken || incomplete) ? RCS_STUFF_BAD_FRAME : RCS_STUFF_FRAME;
+    decoder->started = 0;
+    decoder->broken = 0;
+    decoder->escaped = 0;
+    decoder->remain = 0;
+    return ret;
+}
+
+static int CobsDecodeByte(RcsStuffDecoder_t *decoder, uint8_t byte)
+{
+    if (byte == 0x00) {
+        // 连续的定界符视为空闲填充
+        return decoder->started ? DecoderFinish(decoder, decoder->remain != 0) : RCS_STUFF_OK;
+    }
+    if (!decoder->started) {
+        decoder->started = 1;
+        decoder->len = 0;
+        decoder->code = 0xFF;   // 第一个块之前不补0
+        decoder->remain = 0;
+    }
+    if (decoder->broken) {
+        return RCS_STUFF_OK;
+    }
+
+    if (decoder->remain == 0) {
+        if (decoder->code != 0xFF) {
+            DecoderAppend(decoder, 0x00);
+        }
+        decoder->code = byte;
+        decoder->remain = (uint8_t)(byte - 1);
+    }
+    else {
+        DecoderAppend(decoder, byte);
+        decoder->remain--;
+    }
+    return RCS_STUFF_OK;
+}
+
+static int SlipDecodeByte(RcsStuffDecoder_t *decoder, uint8_t byte)
+{
+    if (byte == RCS_SLIP_END) {
+        return decoder->started ? DecoderFinish(decoder, decoder->escaped) : RCS_STUFF_OK;
+    }
+    if (!decoder->started) {
+        decoder->started = 1;
+        decoder->len = 0;
+    }
+    if (decoder->broken) {
+        return RCS_STUFF_OK;
+    }
+
+    if (decoder->escaped) {
+        decoder->escaped = 0;
+        if (byte == RCS_SLIP_ESC_END) {
+            DecoderAppend(decoder, RCS_SLIP_END);
+        }
+        else if (byte == RCS_SLIP_ESC_ESC) {
+            DecoderAppend(decoder, RCS_SLIP_ESC);
+        }
+        else {
+            decoder->broken = 1;
+        }
+    }
+    else if (byte == RCS_SLIP_ESC) {
+        decoder->escaped = 1;
+    }
+    else {
+        DecoderAppend(decoder, byte);
+    }
+    return RCS_STUFF_OK;
+}
+
+/**
+ * @brief 逐段逐字节喂给解码器，遇到帧结束即返回
+ */
+static int DecodeView(RcsStuffDecoder_t *decoder, const RcsFifoView_t *view, size_t *consumed, DecodeByteFunc_t decodeByte)
+{
+    if (decoder == NULL || view == NULL || consumed == NULL) {
+        return RCS_STUFF_INVALID_PARAM;
+    }
+
+    size_t offset = 0;
+    for (int s = 0; s < 2; s++) {
+        for (size_t i = 0; i < view->len[s]; i++) {
+            int ret = decodeByte(decoder, view->seg[s][i]);
+            if (ret != RCS_STUFF_OK) {
+                *consumed = offset + i + 1;
+                return ret;
+            }
+        }
+        offset += view->len[s];
+    }
+    *consumed = offset;
+    return RCS_STUFF_OK;
+}
+
+/**
+ * @brief 取出FIFO中的数据解码，直到一帧结束或数据用完，只释放实际消费的字节
+ */
+static int DecodeFromFifo(RcsStuffDecoder_t *decoder, RcsFifo_t fifo, DecodeByteFunc_t decodeByte)
+{
+    if (decoder == NULL || fifo == NULL) {
+        return RCS_STUFF_INVALID_PARAM;
+    }
+
+    size_t used = RcsFifoGetUsed(fifo);
+    if (used == 0) {
+        return RCS_STUFF_OK;
+    }
+    void *memAcquired[2] = {NULL, NULL};
+    int first = RcsFifoRecvAcquire(fifo, used, memAcquired);
+    if (first < 0) {
+        return RCS_STUFF_ERROR;
+    }
+
+    RcsFifoView_t view;
+    size_t consumed = 0;
+    RcsFifoViewInit(&view, memAcquired, (size_t)first, used);
+    int ret = DecodeView(decoder, &view, &consumed, decodeByte);
+    RcsFifoRecvCompletePartial(fifo, (const void **)memAcquired, consumed);
+    return ret;
+}
+
+/**
+ * @brief COBS编码并写入发送FIFO，末尾附加0x00定界符
+ * @param fifo 发送FIFO
+ * @param data 原始数据
+ * @param size 原始数据长度
+ * @return 返回写入FIFO的字节数，空间不足RCS_COBS_MAX_ENCODED(size)时返回RCS_STUFF_NO_SPACE
+ */
+int RcsCobsEncodeToFifo(RcsFifo_t fifo, const void *data, size_t size)
+{
+    return EncodeToFifo(fifo, data, size, RCS_COBS_MAX_ENCODED(size), CobsEncode);
+}
+
+/**
+ * @brief SLIP编码并写入发送FIFO
+ * @param fifo 发送FIFO
+ * @param data 原始数据
+ * @param size 原始数据长度
+ * @return 返回写入FIFO的字节数，空间不足RCS_SLIP_MAX_ENCODED(size)时返回RCS_STUFF_NO_SPACE
+ */
+int RcsSlipEncodeToFifo(RcsFifo_t fifo, const void *data, size_t size)
+{
+    return EncodeToFifo(fifo, data, size, RCS_SLIP_MAX_ENCODED(size), SlipEncode);
+}
+
+/**
+ * @brief 初始化解码器
+ * @param decoder 解码器
+ * @param out 解码输出缓冲区，容纳一帧
+ * @param outSize 输出缓冲区大小，帧超长时整帧丢弃
+ * @return 返回错误码
+ */
+int RcsStuffDecoderInit(RcsStuffDecoder_t *decoder, uint8_t *out, size_t outSize)
+{
+    if (decoder == NULL || out == NULL || outSize == 0) {
+        return RCS_STUFF_INVALID_PARAM;
+    }
+    memset(decoder, 0, sizeof(RcsStuffDecoder_t));
+    decoder->out = out;
+    decoder->outSize = outSize;
+    return RCS_STUFF_OK;
+}
+
+/**
+ * @brief 在接收视图上增量解码COBS
+ * @param decoder 解码器
+ * @param view 接收视图
+ * @param consumed 返回消费的字节数
+ * @return 返回RCS_STUFF_FRAME表示out中有一帧，长度为decoder->len；RCS_STUFF_OK表示输入用完
+ */
+int RcsCobsDecode(RcsStuffDecoder_t *decoder, const RcsFifoView_t *view, size_t *consumed)
+{
+    return DecodeView(decoder, view, consumed, CobsDecodeByte);
+}
+
+/**
+ * @brief 在接收视图上增量解码SLIP
+ * @param decoder 解码器
+ * @param view 接收视图
+ * @param consumed 返回消费的字节数
+ * @return 同RcsCobsDecode
+ * @note 连续的END之间没有数据时视为空闲，不产生空帧
+ */
+int RcsSlipDecode(RcsStuffDecoder_t *decoder, const RcsFifoView_t *view, size_t *consumed)
+{
+    return DecodeView(decoder, view, consumed, SlipDecodeByte);
+}
+
+/**
+ * @brief 从接收FIFO增量解码COBS，解出一帧即返回，剩余数据留在FIFO中
+ * @param decoder 解码器
+ * @param fifo 接收FIFO
+ * @return 同RcsCobsDecode
+ */
+int RcsCobsDecodeFromFifo(RcsStuffDecoder_t *decoder, RcsFifo_t fifo)
+{
+    return DecodeFromFifo(decoder, fifo, CobsDecodeByte);
+}
+
+/**
+ * @brief 从接收FIFO增量解码SLIP，解出一帧即返回，剩余数据留在FIFO中
+ * @param decoder 解码器
+ * @param fifo 接收FIFO
+ * @return 同RcsCobsDecode
+ */
+int RcsSlipDecodeFromFifo(RcsStuffDecoder_t *decoder, RcsFifo_t fifo)
+{
+    return DecodeFromFifo(decoder, fifo, SlipDecodeByte);
+}
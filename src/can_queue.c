@@ -0,0 +1,228 @@
+/**
+ * @file can_queue.c
+ * @brief 定长槽的CAN/CAN-FD帧队列，单生产者单消费者无锁，中断内入队只需一次比较和一次发布，接收方批量取出
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "can_queue.h"
+
+// CAN-FD的DLC到字节数的映射，DLC 9~15对应12~64字节
+static const uint8_t dlcToLen[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+static inline size_t SlotDataSize(const RcsCanQueueHandle_t *handle)
+{
+    return handle->slotSize - offsetof(RcsCanFrame_t, data);
+}
+
+/**
+ * @brief 使用静态申请的方式创建CAN帧队列
+ * @param depth 槽数，必须为2的幂
+ * @param slotSize 槽大小，RCS_CAN_SLOT_CLASSIC或RCS_CAN_SLOT_FD
+ * @param staticHandle 静态的队列句柄
+ * @param slotMemory 槽内存，大小为RCS_CAN_QUEUE_MEM_SIZE(depth, slotSize)，按4字节对齐
+ * @return 返回队列句柄
+ */
+RcsCanQueue_t RcsCanQueueCreateStatic(size_t depth, size_t slotSize, RcsCanQueueHandle_t *staticHandle, uint8_t *slotMemory)
+{
+    if (depth == 0 || (depth & (depth - 1)) != 0 || depth > 0x80000000u ||
+        staticHandle == NULL || slotMemory == NULL || ((uintptr_t)slotMemory & 3) != 0 ||
+        (slotSize != RCS_CAN_SLOT_CLASSIC && slotSize != RCS_CAN_SLOT_FD)) {
+        return NULL;
+    }
+
+    staticHandle->slots = slotMemory;
+    staticHandle->slotSize = (uint32_t)slotSize;
+    staticHandle->mask = (uint32_t)(depth - 1);
+    staticHandle->head = 0;
+    staticHandle->tail = 0;
+    staticHandle->overrunCount = 0;
+
+    return (RcsCanQueue_t)staticHandle;
+}
+
+/**
+ * @brief 使用动态申请的方式创建CAN帧队列
+ * @param depth 槽数，必须为2的幂
+ * @param slotSize 槽大小，RCS_CAN_SLOT_CLASSIC或RCS_CAN_SLOT_FD
+ * @return 返回队列句柄
+ */
+RcsCanQueue_t RcsCanQueueCreate(size_t depth, size_t slotSize)
+{
+    if (depth == 0 || (depth & (depth - 1)) != 0 ||
+        (slotSize != RCS_CAN_SLOT_CLASSIC && slotSize != RCS_CAN_SLOT_FD)) {
+        return NULL;
+    }
+
+    RcsCanQueueHandle_t *handle = (RcsCanQueueHandle_t *)CanPortMalloc(sizeof(RcsCanQueueHandle_t));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    uint8_t *mem = (uint8_t *)CanPortMalloc(RCS_CAN_QUEUE_MEM_SIZE(depth, slotSize));
+    if (mem == NULL) {
+        CanPortFree(handle);
+        return NULL;
+    }
+
+    RcsCanQueue_t queue = RcsCanQueueCreateStatic(depth, slotSize, handle, mem);
+    if (queue == NULL) {
+        CanPortFree(mem);
+        CanPortFree(handle);
+    }
+    return queue;
+}
+
+/**
+ * @brief 销毁CAN帧队列
+ * @param queue 队列句柄
+ * @warning 请勿传入静态队列句柄
+ */
+void RcsCanQueueDestroy(RcsCanQueue_t queue)
+{
+    if (queue == NULL) {
+        return;
+    }
+    RcsCanQueueHandle_t *handle = (RcsCanQueueHandle_t *)queue;
+    CanPortFree(handle->slots);
+    CanPortFree(handle);
+}
+
+/**
+ * @brief 拷贝一帧入队，只拷贝帧头与len个数据字节
+ * @param queue 队列句柄
+ * @param frame 帧，FD队列可传入RcsCanFdFrame_t
+ * @return 返回错误码，队列满时返回RCS_CAN_FULL并累加溢出计数
+ * @note 只允许唯一的发送方调用
+ */
+int RcsCanQueuePush(RcsCanQueue_t queue, const RcsCanFrame_t *frame)
+{
+    if (queue == NULL || frame == NULL || frame->len > SlotDataSize((RcsCanQueueHandle_t *)queue)) {
+        return RCS_CAN_INVALID_PARAM;
+    }
+
+    RcsCanFrame_t *slot = RcsCanQueuePushAcquire(queue);
+    if (slot == NULL) {
+        return RCS_CAN_FULL;
+    }
+    memcpy(slot, frame, offsetof(RcsCanFrame_t, data) + frame->len);
+    RcsCanQueuePushCommit(queue);
+    return RCS_CAN_OK;
+}
+
+/**
+ * @brief 取得所有已入队且在内存中连续的帧，不拷贝
+ * @param queue 队列句柄
+ * @param frames 返回第一帧的地址，后续帧按槽大小依次排列
+ * @return 返回连续的帧数，队列回绕时只返回到内存末尾，完成后再次调用即可取得剩余部分
+ * @note 只允许唯一的接收方调用，帧在RcsCanQueueRecvComplete之前保持有效
+ */
+size_t RcsCanQueueRecvAcquire(RcsCanQueue_t queue, const RcsCanFrame_t **frames)
+{
+    if (queue == NULL || frames == NULL) {
+        return 0;
+    }
+    RcsCanQueueHandle_t *handle = (RcsCanQueueHandle_t *)queue;
+
+    uint32_t head = handle->head;
+    uint32_t count = __atomic_load_n(&handle->tail, __ATOMIC_ACQUIRE) - head;
+    uint32_t index = head & handle->mask;
+    uint32_t untilEnd = handle->mask + 1 - index;
+
+    *frames = (const RcsCanFrame_t *)(handle->slots + (size_t)index * handle->slotSize);
+    return (count < untilEnd) ? count : untilEnd;
+}
+
+/**
+ * @brief 释放已处理的帧，槽归还给发送方
+ * @param queue 队列句柄
+ * @param count 释放的帧数，不得超过RcsCanQueueRecvAcquire的返回值
+ */
+void RcsCanQueueRecvComplete(RcsCanQueue_t queue, size_t count)
+{
+    if (queue == NULL || count == 0) {
+        return;
+    }
+    RcsCanQueueHandle_t *handle = (RcsCanQueueHandle_t *)queue;
+    __atomic_store_n(&handle->head, handle->head + (uint32_t)count, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief 批量取出当前所有帧，逐帧回调后一次性释放
+ * @param queue 队列句柄
+ * @param callback 逐帧回调
+ * @param arg 用户参数
+ * @return 返回处理的帧数
+ * @note 只读取一次发送方的写指针，回调期间新到的帧留到下次处理
+ */
+size_t RcsCanQueueDrain(RcsCanQueue_t queue, RcsCanDrainCallback_t callback, void *arg)
+{
+    if (queue == NULL || callback == NULL) {
+        return 0;
+    }
+    RcsCanQueueHandle_t *handle = (RcsCanQueueHandle_t *)queue;
+
+    uint32_t head = handle->head;
+    uint32_t tail = __atomic_load_n(&handle->tail, __ATOMIC_ACQUIRE);
+    for (uint32_t i = head; i != tail; i++) {
+        callback((const RcsCanFrame_t *)(handle->slots + (size_t)(i & handle->mask) * handle->slotSize), arg);
+    }
+    __atomic_store_n(&handle->head, tail, __ATOMIC_RELEASE);
+    return (size_t)(tail - head);
+}
+
+/**
+ * @brief 获取队列中的帧数
+ * @param queue 队列句柄
+ * @return 返回帧数
+ */
+size_t RcsCanQueueGetCount(RcsCanQueue_t queue)
+{
+    if (queue == NULL) {
+        return 0;
+    }
+    RcsCanQueueHandle_t *handle = (RcsCanQueueHandle_t *)queue;
+    return (size_t)(__atomic_load_n(&handle->tail, __ATOMIC_ACQUIRE) - __atomic_load_n(&handle->head, __ATOMIC_ACQUIRE));
+}
+
+/**
+ * @brief 获取因队列满而丢弃的帧数
+ * @param queue 队列句柄
+ * @return 返回溢出计数
+ */
+uint32_t RcsCanQueueGetOverrun(RcsCanQueue_t queue)
+{
+    if (queue == NULL) {
+        return 0;
+    }
+    return __atomic_load_n(&((RcsCanQueueHandle_t *)queue)->overrunCount, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief DLC转换为数据字节数
+ * @param dlc 数据长度码，0~15
+ * @return 返回字节数
+ */
+uint8_t RcsCanDlcToLen(uint8_t dlc)
+{
+    return dlcToLen[dlc & 0x0F];
+}
+
+/**
+ * @brief 数据字节数转换为能容纳它的最小DLC
+ * @param len 字节数，0~64
+ * @return 返回数据长度码，超过64时返回15
+ */
+uint8_t RcsCanLenToDlc(uint8_t len)
+{
+    uint8_t dlc = 0;
+    while (dlc < 15 && dlcToLen[dlc] < len) {
+        dlc++;
+    }
+    return dlc;
+}
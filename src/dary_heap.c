@@ -0,0 +1,332 @@
+/**
+ * @file dary_heap.c
+ * @brief 带索引的d叉最小堆优先队列，按编号进行O(log n)的降键与删除，用于按截止时间调度发送
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "dary_heap.h"
+
+/**
+ * @brief 上浮：沿父节点链移动空位，最后一次写入，减少交换次数
+ */
+static void SiftUp(RcsHeapHandle_t *handle, uint32_t index)
+{
+    RcsHeapEntry_t entry = handle->heap[index];
+
+    while (index > 0) {
+        uint32_t parent = (index - 1) / handle->arity;
+        if (handle->heap[parent].key <= entry.key) {
+            break;
+        }
+        handle->heap[index] = handle->heap[parent];
+        handle->pos[handle->heap[index].id] = index;
+        index = parent;
+    }
+    handle->heap[index] = entry;
+    handle->pos[entry.id] = index;
+}
+
+/**
+ * @brief 下沉：在连续存放的d个子节点中选最小者，子节点组不跨缓存行
+ */
+static void SiftDown(RcsHeapHandle_t *handle, uint32_t index)
+{
+    RcsHeapEntry_t entry = handle->heap[index];
+
+    for (;;) {
+        uint32_t first = index * handle->arity + 1;
+        if (first >= handle->count) {
+            break;
+        }
+        uint32_t last = first + handle->arity;
+        if (last > handle->count) {
+            last = handle->count;
+        }
+
+        uint32_t best = first;
+        RcsHeapKey_t bestKey = handle->heap[first].key;
+        for (uint32_t child = first + 1; child < last; child++) {
+            if (handle->heap[child].key < bestKey) {
+                best = child;
+                bestKey = handle->heap[child].key;
+            }
+        }
+        if (bestKey >= entry.key) {
+            break;
+        }
+        handle->heap[index] = handle->heap[best];
+        handle->pos[handle->heap[index].id] = index;
+        index = best;
+    }
+    handle->heap[index] = entry;
+    handle->pos[entry.id] = index;
+}
+
+/**
+ * @brief 用末尾元素填补index处的空位并恢复堆序
+ */
+static void RemoveAt(RcsHeapHandle_t *handle, uint32_t index)
+{
+    handle->pos[handle->heap[index].id] = RCS_HEAP_NIL;
+    handle->count--;
+    if (index == handle->count) {
+        return;
+    }
+
+    handle->heap[index] = handle->heap[handle->count];
+    handle->pos[handle->heap[index].id] = index;
+    if (index > 0 && handle->heap[index].key < handle->heap[(index - 1) / handle->arity].key) {
+        SiftUp(handle, index);
+    }
+    else {
+        SiftDown(handle, index);
+    }
+}
+
+/**
+ * @brief 使用静态申请的方式创建堆
+ * @param arity 叉数，取值2~RCS_HEAP_MAX_ARITY，推荐4
+ * @param capacity 容量，即编号的取值范围
+ * @param staticHandle 静态的堆句柄
+ * @param heapMemory 静态内存，大小至少为RCS_HEAP_MEM_SIZE(capacity)，按4字节对齐，堆数组在其中按缓存行对齐
+ * @return 返回堆句柄
+ */
+RcsHeap_t RcsHeapCreateStatic(size_t arity, size_t capacity, RcsHeapHandle_t *staticHandle, uint8_t *heapMemory)
+{
+    if (staticHandle == NULL || heapMemory == NULL || arity < 2 || arity > RCS_HEAP_MAX_ARITY ||
+        capacity == 0 || capacity >= RCS_HEAP_NIL) {
+        return NULL;
+    }
+    if (((uintptr_t)heapMemory & (sizeof(uint32_t) - 1)) != 0) {
+        return NULL;
+    }
+
+    // 根节点位于第arity-1个节点，节点i的子节点从第arity*(i+1)个节点开始
+    uintptr_t base = ((uintptr_t)heapMemory + RCS_HEAP_CACHE_LINE - 1) & ~(uintptr_t)(RCS_HEAP_CACHE_LINE - 1);
+    staticHandle->heap = (RcsHeapEntry_t *)base + (arity - 1);
+    staticHandle->pos = (uint32_t *)((RcsHeapEntry_t *)base + capacity + RCS_HEAP_MAX_ARITY - 1);
+    staticHandle->mem = heapMemory;
+    staticHandle->capacity = (uint32_t)capacity;
+    staticHandle->count = 0;
+    staticHandle->arity = (uint32_t)arity;
+
+    for (size_t i = 0; i < capacity; i++) {
+        staticHandle->pos[i] = RCS_HEAP_NIL;
+    }
+    return (RcsHeap_t)staticHandle;
+}
+
+/**
+ * @brief 使用动态申请的方式创建堆
+ * @param arity 叉数
+ * @param capacity 容量
+ * @return 返回堆句柄
+ */
+RcsHeap_t RcsHeapCreate(size_t arity, size_t capacity)
+{
+    if (arity < 2 || arity > RCS_HEAP_MAX_ARITY || capacity == 0 || capacity >= RCS_HEAP_NIL) {
+        return NULL;
+    }
+
+    RcsHeapHandle_t *handle = (RcsHeapHandle_t *)HeapPortMalloc(sizeof(RcsHeapHandle_t));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    uint8_t *mem = (uint8_t *)HeapPortMalloc(RCS_HEAP_MEM_SIZE(capacity));
+    if (mem == NULL) {
+        HeapPortFree(handle);
+        return NULL;
+    }
+
+    return RcsHeapCreateStatic(arity, capacity, handle, mem);
+}
+
+/**
+ * @brief 销毁堆
+ * @param heap 堆句柄
+ * @warning 请勿传入静态堆句柄
+ */
+void RcsHeapDestroy(RcsHeap_t heap)
+{
+    if (heap == NULL) {
+        return;
+    }
+    RcsHeapHandle_t *handle = (RcsHeapHandle_t *)heap;
+    HeapPortFree(handle->mem);
+    HeapPortFree(handle);
+}
+
+/**
+ * @brief 插入元素
+ * @param heap 堆句柄
+ * @param id 元素编号，小于容量且当前不在堆中
+ * @param key 键
+ * @return 返回错误码
+ */
+int RcsHeapPush(RcsHeap_t heap, uint32_t id, RcsHeapKey_t key)
+{
+    if (heap == NULL) {
+        return RCS_HEAP_INVALID_PARAM;
+    }
+    RcsHeapHandle_t *handle = (RcsHeapHandle_t *)heap;
+    if (id >= handle->capacity || handle->pos[id] != RCS_HEAP_NIL) {
+        return RCS_HEAP_INVALID_PARAM;
+    }
+
+    handle->heap[handle->count].key = key;
+    handle->heap[handle->count].id = id;
+    SiftUp(handle, handle->count++);
+    return RCS_HEAP_OK;
+}
+
+/**
+ * @brief 查看键最小的元素，不出队
+ * @param heap 堆句柄
+ * @param id 返回编号，可为NULL
+ * @param key 返回键，可为NULL
+ * @return 返回错误码，堆空时返回RCS_HEAP_EMPTY
+ */
+int RcsHeapPeek(RcsHeap_t heap, uint32_t *id, RcsHeapKey_t *key)
+{
+    if (heap == NULL) {
+        return RCS_HEAP_INVALID_PARAM;
+    }
+    RcsHeapHandle_t *handle = (RcsHeapHandle_t *)heap;
+    if (handle->count == 0) {
+        return RCS_HEAP_EMPTY;
+    }
+
+    if (id != NULL) {
+        *id = handle->heap[0].id;
+    }
+    if (key != NULL) {
+        *key = handle->heap[0].key;
+    }
+    return RCS_HEAP_OK;
+}
+
+/**
+ * @brief 取出键最小的元素
+ * @param heap 堆句柄
+ * @param id 返回编号，可为NULL
+ * @param key 返回键，可为NULL
+ * @return 返回错误码，堆空时返回RCS_HEAP_EMPTY
+ */
+int RcsHeapPop(RcsHeap_t heap, uint32_t *id, RcsHeapKey_t *key)
+{
+    int ret = RcsHeapPeek(heap, id, key);
+    if (ret != RCS_HEAP_OK) {
+        return ret;
+    }
+    RemoveAt((RcsHeapHandle_t *)heap, 0);
+    return RCS_HEAP_OK;
+}
+
+/**
+ * @brief 降低元素的键，只上浮
+ * @param heap 堆句柄
+ * @param id 元素编号
+ * @param key 新键，不得大于原键
+ * @return 返回错误码，元素不在堆中时返回RCS_HEAP_NOT_FOUND
+ */
+int RcsHeapDecreaseKey(RcsHeap_t heap, uint32_t id, RcsHeapKey_t key)
+{
+    if (heap == NULL) {
+        return RCS_HEAP_INVALID_PARAM;
+    }
+    RcsHeapHandle_t *handle = (RcsHeapHandle_t *)heap;
+    if (id >= handle->capacity || handle->pos[id] == RCS_HEAP_NIL) {
+        return RCS_HEAP_NOT_FOUND;
+    }
+    uint32_t index = handle->pos[id];
+    if (key > handle->heap[index].key) {
+        return RCS_HEAP_INVALID_PARAM;
+    }
+
+    handle->heap[index].key = key;
+    SiftUp(handle, index);
+    return RCS_HEAP_OK;
+}
+
+/**
+ * @brief 修改元素的键，可增可减
+ * @param heap 堆句柄
+ * @param id 元素编号
+ * @param key 新键
+ * @return 返回错误码，元素不在堆中时返回RCS_HEAP_NOT_FOUND
+ */
+int RcsHeapUpdate(RcsHeap_t heap, uint32_t id, RcsHeapKey_t key)
+{
+    if (heap == NULL) {
+        return RCS_HEAP_INVALID_PARAM;
+    }
+    RcsHeapHandle_t *handle = (RcsHeapHandle_t *)heap;
+    if (id >= handle->capacity || handle->pos[id] == RCS_HEAP_NIL) {
+        return RCS_HEAP_NOT_FOUND;
+    }
+
+    uint32_t index = handle->pos[id];
+    RcsHeapKey_t old = handle->heap[index].key;
+    handle->heap[index].key = key;
+    if (key < old) {
+        SiftUp(handle, index);
+    }
+    else {
+        SiftDown(handle, index);
+    }
+    return RCS_HEAP_OK;
+}
+
+/**
+ * @brief 按编号删除元素
+ * @param heap 堆句柄
+ * @param id 元素编号
+ * @return 返回错误码，元素不在堆中时返回RCS_HEAP_NOT_FOUND
+ */
+int RcsHeapRemove(RcsHeap_t heap, uint32_t id)
+{
+    if (heap == NULL) {
+        return RCS_HEAP_INVALID_PARAM;
+    }
+    RcsHeapHandle_t *handle = (RcsHeapHandle_t *)heap;
+    if (id >= handle->capacity || handle->pos[id] == RCS_HEAP_NIL) {
+        return RCS_HEAP_NOT_FOUND;
+    }
+
+    RemoveAt(handle, handle->pos[id]);
+    return RCS_HEAP_OK;
+}
+
+/**
+ * @brief 查询元素是否在堆中
+ * @param heap 堆句柄
+ * @param id 元素编号
+ * @return 在堆中返回1，否则返回0
+ */
+int RcsHeapContains(RcsHeap_t heap, uint32_t id)
+{
+    if (heap == NULL) {
+        return 0;
+    }
+    RcsHeapHandle_t *handle = (RcsHeapHandle_t *)heap;
+    return (id < handle->capacity && handle->pos[id] != RCS_HEAP_NIL) ? 1 : 0;
+}
+
+/**
+ * @brief 获取元素个数
+ * @param heap 堆句柄
+ * @return 返回元素个数
+ */
+size_t RcsHeapGetCount(RcsHeap_t heap)
+{
+    if (heap == NULL) {
+        return 0;
+    }
+    return ((RcsHeapHandle_t *)heap)->count;
+}
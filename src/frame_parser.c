@@ -0,0 +1,172 @@
+/**
+ * @file frame_parser.c
+ * @brief 直接在FIFO两段视图上工作的流式帧解析器，帧格式为SOF+长度+负载+CRC16，出错后自动重新同步
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "frame_parser.h"
+#include "crc.h"
+#include "byte_scan.h"
+
+static inline uint8_t ViewByte(const RcsFifoView_t *view, size_t offset)
+{
+    return (offset < view->len[0]) ? view->seg[0][offset] : view->seg[1][offset - view->len[0]];
+}
+
+/**
+ * @brief 将数据写入发送申请区域的offset处，自动跨越两段
+ */
+static void WriteAt(void *memAcquired[2], size_t firstSize, size_t offset, const void *src, size_t size)
+{
+    const uint8_t *in = (const uint8_t *)src;
+    if (offset < firstSize) {
+        size_t n = (size < firstSize - offset) ? size : firstSize - offset;
+        memcpy((uint8_t *)memAcquired[0] + offset, in, n);
+        in += n;
+        size -= n;
+        offset = firstSize;
+    }
+    if (size > 0) {
+        memcpy((uint8_t *)memAcquired[1] + (offset - firstSize), in, size);
+    }
+}
+
+/**
+ * @brief 初始化帧解析器
+ * @param parser 解析器实例
+ * @param fifo 接收FIFO，解析器是其唯一的接收方
+ * @param sof 帧起始字节
+ * @param maxPayload 最大负载长度，长度字段超出时视为错误帧；整帧必须能放进FIFO
+ * @param callback 完整帧回调
+ * @param arg 回调参数
+ * @return 返回错误码
+ */
+int RcsFrameParserInit(RcsFrameParser_t *parser, RcsFifo_t fifo, uint8_t sof, size_t maxPayload,
+                       RcsFrameCallback_t callback, void *arg)
+{
+    if (parser == NULL || fifo == NULL || callback == NULL || maxPayload > 0xFFFF) {
+        return RCS_FRAME_INVALID_PARAM;
+    }
+    // FIFO最多容纳memSize-1字节，否则最大帧永远收不齐
+    if (maxPayload + RCS_FRAME_OVERHEAD > ((RcsFifoHandle_t *)fifo)->memSize - 1) {
+        return RCS_FRAME_INVALID_PARAM;
+    }
+
+    memset(parser, 0, sizeof(RcsFrameParser_t));
+    parser->fifo = fifo;
+    parser->callback = callback;
+    parser->arg = arg;
+    parser->maxPayload = maxPayload;
+    parser->sof = sof;
+    return RCS_FRAME_OK;
+}
+
+/**
+ * @brief 解析FIFO中已有的数据，完整帧直接以视图形式交给回调，之后一次性释放已消费的字节
+ * @param parser 解析器实例
+ * @return 返回本次解析出的帧数，出错时返回错误码
+ * @note 不完整的帧留在FIFO中等待下次调用；SOF、长度或CRC不符时只跳过一个字节后重新搜索SOF
+ */
+int RcsFrameParserPoll(RcsFrameParser_t *parser)
+{
+    if (parser == NULL) {
+        return RCS_FRAME_INVALID_PARAM;
+    }
+
+    size_t used = RcsFifoGetUsed(parser->fifo);
+    if (used == 0) {
+        return 0;
+    }
+    void *memAcquired[2] = {NULL, NULL};
+    int first = RcsFifoRecvAcquire(parser->fifo, used, memAcquired);
+    if (first < 0) {
+        return (first == RCS_FIFO_NO_DATA) ? 0 : RCS_FRAME_ERROR;
+    }
+    RcsFifoView_t view;
+    RcsFifoViewInit(&view, memAcquired, (size_t)first, used);
+
+    int frames = 0;
+    size_t pos = 0;
+    for (;;) {
+        size_t sofPos = RcsFifoViewFindByte(&view, pos, parser->sof);
+        parser->discardCount += (uint32_t)(sofPos - pos);
+        pos = sofPos;
+        if (used - pos < RCS_FRAME_HEADER_SIZE) {
+            break;
+        }
+
+        size_t len = (size_t)ViewByte(&view, pos + 1) | ((size_t)ViewByte(&view, pos + 2) << 8);
+        if (len > parser->maxPayload) {
+            parser->lengthErrorCount++;
+            parser->discardCount++;
+            pos++;
+            continue;
+        }
+        if (used - pos < len + RCS_FRAME_OVERHEAD) {
+            break;
+        }
+
+        RcsFifoView_t covered;
+        RcsFifoViewSlice(&view, pos + 1, len + 2, &covered);
+        size_t crcPos = pos + RCS_FRAME_HEADER_SIZE + len;
+        uint16_t crc = (uint16_t)(ViewByte(&view, crcPos) | (ViewByte(&view, crcPos + 1) << 8));
+        if (RcsCrc16View(RCS_CRC16_INIT, &covered) != crc) {
+            parser->crcErrorCount++;
+            parser->discardCount++;
+            pos++;
+            continue;
+        }
+
+        RcsFifoView_t payload;
+        RcsFifoViewSlice(&view, pos + RCS_FRAME_HEADER_SIZE, len, &payload);
+        parser->callback(&payload, parser->arg);
+        parser->frameCount++;
+        frames++;
+        pos += len + RCS_FRAME_OVERHEAD;
+    }
+
+    RcsFifoRecvCompletePartial(parser->fifo, (const void **)memAcquired, pos);
+    return frames;
+}
+
+/**
+ * @brief 组帧并写入发送FIFO，负载直接拷入发送申请区域
+ * @param fifo 发送FIFO
+ * @param sof 帧起始字节
+ * @param payload 负载
+ * @param size 负载长度
+ * @return 返回错误码，空间不足时返回RCS_FRAME_NO_SPACE
+ */
+int RcsFrameWrite(RcsFifo_t fifo, uint8_t sof, const void *payload, size_t size)
+{
+    if (fifo == NULL || (payload == NULL && size != 0) || size > 0xFFFF) {
+        return RCS_FRAME_INVALID_PARAM;
+    }
+
+    size_t total = size + RCS_FRAME_OVERHEAD;
+    void *memAcquired[2] = {NULL, NULL};
+    int first = RcsFifoSendAcquire(fifo, total, memAcquired);
+    if (first < 0) {
+        return (first == RCS_FIFO_NO_SPACE) ? RCS_FRAME_NO_SPACE : RCS_FRAME_ERROR;
+    }
+
+    uint8_t header[RCS_FRAME_HEADER_SIZE] = {sof, (uint8_t)(size & 0xFF), (uint8_t)(size >> 8)};
+    uint16_t crc = RcsCrc16Update(RCS_CRC16_INIT, &header[1], 2);
+    crc = RcsCrc16Update(crc, payload, size);
+    uint8_t tail[RCS_FRAME_CRC_SIZE] = {(uint8_t)(crc & 0xFF), (uint8_t)(crc >> 8)};
+
+    WriteAt(memAcquired, (size_t)first, 0, header, sizeof(header));
+    if (size != 0) {
+        WriteAt(memAcquired, (size_t)first, RCS_FRAME_HEADER_SIZE, payload, size);
+    }
+    WriteAt(memAcquired, (size_t)first, RCS_FRAME_HEADER_SIZE + size, tail, sizeof(tail));
+
+    RcsFifoSendComplete(fifo, (const void **)memAcquired);
+    return RCS_FRAME_OK;
+}
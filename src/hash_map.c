@@ -0,0 +1,251 @@
+/**
+ * @file hash_map.c
+ * @brief 固定容量的Robin Hood开放寻址哈希表，以CAN标识符为键分发报文，查找的探测长度有上界
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "hash_map.h"
+
+/**
+ * @brief Fibonacci散列，取乘积的高位，相邻的CAN标识符也能均匀分散
+ */
+static inline uint32_t HashIndex(const RcsHashMapHandle_t *handle, uint32_t key)
+{
+    return (key * 0x9E3779B1u) >> handle->shift;
+}
+
+/**
+ * @brief 查找键所在的槽
+ * @return 返回槽下标，不存在时返回-1
+ */
+static int32_t FindIndex(const RcsHashMapHandle_t *handle, uint32_t key)
+{
+    uint32_t index = HashIndex(handle, key);
+    for (uint32_t dist = 1; dist <= RCS_HASH_MAX_PROBE; dist++) {
+        const RcsHashEntry_t *entry = &handle->entries[index];
+        // 遇到空槽或比自己更"富"的槽即可提前结束
+        if (entry->dist < dist) {
+            return -1;
+        }
+        if (entry->key == key) {
+            return (int32_t)index;
+        }
+        index = (index + 1) & handle->mask;
+    }
+    return -1;
+}
+
+/**
+ * @brief 使用静态申请的方式创建哈希表
+ * @param capacity 槽数，必须为2的幂且不小于2，建议为最大键数的2倍
+ * @param staticHandle 静态的哈希表句柄
+ * @param entryMemory 静态槽数组，长度为capacity
+ * @return 返回哈希表句柄
+ */
+RcsHashMap_t RcsHashMapCreateStatic(size_t capacity, RcsHashMapHandle_t *staticHandle, RcsHashEntry_t *entryMemory)
+{
+    if (staticHandle == NULL || entryMemory == NULL || capacity < 2 ||
+        capacity > 0x80000000u || (capacity & (capacity - 1)) != 0) {
+        return NULL;
+    }
+
+    uint32_t bits = 0;
+    while ((1u << bits) < capacity) {
+        bits++;
+    }
+    staticHandle->entries = entryMemory;
+    staticHandle->mask = (uint32_t)capacity - 1;
+    staticHandle->shift = 32 - bits;
+    RcsHashMapClear(staticHandle);
+
+    return (RcsHashMap_t)staticHandle;
+}
+
+/**
+ * @brief 使用动态申请的方式创建哈希表，创建后不再申请内存
+ * @param capacity 槽数，必须为2的幂
+ * @return 返回哈希表句柄
+ */
+RcsHashMap_t RcsHashMapCreate(size_t capacity)
+{
+    if (capacity < 2 || capacity > 0x80000000u || (capacity & (capacity - 1)) != 0) {
+        return NULL;
+    }
+
+    RcsHashMapHandle_t *handle = (RcsHashMapHandle_t *)HashPortMalloc(sizeof(RcsHashMapHandle_t));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    RcsHashEntry_t *entries = (RcsHashEntry_t *)HashPortMalloc(RCS_HASH_MEM_SIZE(capacity));
+    if (entries == NULL) {
+        HashPortFree(handle);
+        return NULL;
+    }
+
+    return RcsHashMapCreateStatic(capacity, handle, entries);
+}
+
+/**
+ * @brief 销毁哈希表
+ * @param map 哈希表句柄
+ * @warning 请勿传入静态哈希表句柄
+ */
+void RcsHashMapDestroy(RcsHashMap_t map)
+{
+    if (map == NULL) {
+        return;
+    }
+    RcsHashMapHandle_t *handle = (RcsHashMapHandle_t *)map;
+    HashPortFree(handle->entries);
+    HashPortFree(handle);
+}
+
+/**
+ * @brief 插入键值，键已存在时更新值
+ * @param map 哈希表句柄
+ * @param key 键，如CAN标识符
+ * @param value 值，如处理函数或会话指针
+ * @return 返回错误码，探测长度将超过RCS_HASH_MAX_PROBE时返回RCS_HASH_FULL且表不变
+ */
+int RcsHashMapInsert(RcsHashMap_t map, uint32_t key, void *value)
+{
+    if (map == NULL) {
+        return RCS_HASH_INVALID_PARAM;
+    }
+    RcsHashMapHandle_t *handle = (RcsHashMapHandle_t *)map;
+
+    int32_t found = FindIndex(handle, key);
+    if (found >= 0) {
+        handle->entries[found].value = value;
+        return RCS_HASH_OK;
+    }
+    if (handle->count > handle->mask) {
+        return RCS_HASH_FULL;
+    }
+
+    // 先只读地模拟一遍：每个槽只经过一次，被挤出元素的距离可以直接算出
+    uint32_t index = HashIndex(handle, key);
+    uint32_t dist = 1;
+    for (;;) {
+        const RcsHashEntry_t *entry = &handle->entries[index];
+        if (dist > RCS_HASH_MAX_PROBE) {
+            return RCS_HASH_FULL;
+        }
+        if (entry->dist == 0) {
+            break;
+        }
+        if (entry->dist < dist) {
+            dist = entry->dist;
+        }
+        index = (index + 1) & handle->mask;
+        dist++;
+    }
+
+    // 确认可行后再真正插入，沿途劫富济贫
+    RcsHashEntry_t carry = {key, 1, value};
+    index = HashIndex(handle, key);
+    for (;;) {
+        RcsHashEntry_t *entry = &handle->entries[index];
+        if (entry->dist == 0) {
+            *entry = carry;
+            break;
+        }
+        if (entry->dist < carry.dist) {
+            RcsHashEntry_t tmp = *entry;
+            *entry = carry;
+            carry = tmp;
+        }
+        index = (index + 1) & handle->mask;
+        carry.dist++;
+    }
+    handle->count++;
+    return RCS_HASH_OK;
+}
+
+/**
+ * @brief 查找键对应的值，只读，可在中断中调用
+ * @param map 哈希表句柄
+ * @param key 键
+ * @param value 返回的值
+ * @return 返回错误码，不存在时返回RCS_HASH_NOT_FOUND
+ */
+int RcsHashMapLookup(RcsHashMap_t map, uint32_t key, void **value)
+{
+    if (map == NULL || value == NULL) {
+        return RCS_HASH_INVALID_PARAM;
+    }
+    RcsHashMapHandle_t *handle = (RcsHashMapHandle_t *)map;
+
+    int32_t found = FindIndex(handle, key);
+    if (found < 0) {
+        return RCS_HASH_NOT_FOUND;
+    }
+    *value = handle->entries[found].value;
+    return RCS_HASH_OK;
+}
+
+/**
+ * @brief 删除键，后续元素逐个前移，不留墓碑
+ * @param map 哈希表句柄
+ * @param key 键
+ * @return 返回错误码，不存在时返回RCS_HASH_NOT_FOUND
+ */
+int RcsHashMapRemove(RcsHashMap_t map, uint32_t key)
+{
+    if (map == NULL) {
+        return RCS_HASH_INVALID_PARAM;
+    }
+    RcsHashMapHandle_t *handle = (RcsHashMapHandle_t *)map;
+
+    int32_t found = FindIndex(handle, key);
+    if (found < 0) {
+        return RCS_HASH_NOT_FOUND;
+    }
+
+    uint32_t index = (uint32_t)found;
+    uint32_t next = (index + 1) & handle->mask;
+    while (handle->entries[next].dist > 1) {
+        handle->entries[index] = handle->entries[next];
+        handle->entries[index].dist--;
+        index = next;
+        next = (next + 1) & handle->mask;
+    }
+    handle->entries[index].dist = 0;
+    handle->count--;
+    return RCS_HASH_OK;
+}
+
+/**
+ * @brief 清空哈希表
+ * @param map 哈希表句柄
+ */
+void RcsHashMapClear(RcsHashMap_t map)
+{
+    if (map == NULL) {
+        return;
+    }
+    RcsHashMapHandle_t *handle = (RcsHashMapHandle_t *)map;
+    for (uint32_t i = 0; i <= handle->mask; i++) {
+        handle->entries[i].dist = 0;
+    }
+    handle->count = 0;
+}
+
+/**
+ * @brief 获取键的个数
+ * @param map 哈希表句柄
+ * @return 返回键的个数
+ */
+size_t RcsHashMapGetCount(RcsHashMap_t map)
+{
+    if (map == NULL) {
+        return 0;
+    }
+    return ((RcsHashMapHandle_t *)map)->count;
+}
@@ -0,0 +1,518 @@
+/**
+ * @file isotp.c
+ * @brief ISO 15765-2（ISO-TP）分段与重组，接收的消息直接重组进FIFO的发送申请区域，
+ *        收发帧经CAN帧队列，流控超时与STmin节拍由时间轮驱动，会话全部静态分配
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "isotp.h"
+#include "view_cursor.h"
+
+// 协议控制信息
+#define PCI_SF 0x0
+#define PCI_FF 0x1
+#define PCI_CF 0x2
+#define PCI_FC 0x3
+
+#define FC_CTS   0x0
+#define FC_WAIT  0x1
+#define FC_OVFLW 0x2
+
+#define SF_MAX_DATA 7
+#define FF_MAX_SHORT 0xFFF
+
+enum {
+    TX_IDLE = 0,
+    TX_WAIT_FC,
+    TX_SENDING,
+};
+
+static void Notify(RcsIsoTpSession_t *session, int event)
+{
+    if (session->config.callback != NULL) {
+        session->config.callback(session, event, session->config.arg);
+    }
+}
+
+/**
+ * @brief 组一帧并推入发送帧队列，不足8字节的部分填充
+ */
+static int PushFrame(RcsIsoTpSession_t *session, const uint8_t *pci, size_t pciSize, const uint8_t *data, size_t size)
+{
+    RcsCanFrame_t *slot = RcsCanQueuePushAcquire(session->config.txQueue);
+    if (slot == NULL) {
+        return RCS_ISOTP_NO_SPACE;
+    }
+    slot->id = session->config.txId;
+    slot->timestamp = 0;
+    slot->len = 8;
+    slot->flags = session->config.txFlags;
+    memcpy(slot->data, pci, pciSize);
+    memcpy(slot->data + pciSize, data, size);
+    memset(slot->data + pciSize + size, RCS_ISOTP_PADDING, 8 - pciSize - size);
+    RcsCanQueuePushCommit(session->config.txQueue);
+    return RCS_ISOTP_OK;
+}
+
+static int SendFlowControl(RcsIsoTpSession_t *session, uint8_t status)
+{
+    uint8_t pci[3] = {(uint8_t)((PCI_FC << 4) | status), session->config.blockSize, session->config.stMin};
+    return PushFrame(session, pci, sizeof(pci), NULL, 0);
+}
+
+/**
+ * @brief STmin编码换算为节拍数，多加一个节拍保证间隔不小于要求
+ */
+static uint32_t StMinToTicks(uint8_t stMin)
+{
+    uint32_t us;
+    if (stMin == 0) {
+        return 0;
+    }
+    if (stMin <= 0x7F) {
+        us = (uint32_t)stMin * 1000;
+    }
+    else if (stMin >= 0xF1 && stMin <= 0xF9) {
+        us = (uint32_t)(stMin - 0xF0) * 100;
+    }
+    else {
+        us = 0x7F * 1000;   // 保留值按最大间隔处理
+    }
+    return (us + RCS_ISOTP_TICK_US - 1) / RCS_ISOTP_TICK_US + 1;
+}
+
+/**
+ * @brief 写入接收申请区域的offset处，自动跨越两段
+ */
+static void RxWrite(RcsIsoTpSession_t *session, size_t offset, const uint8_t *src, size_t size)
+{
+    if (offset < session->rxFirst) {
+        size_t n = (size < session->rxFirst - offset) ? size : session->rxFirst - offset;
+        memcpy((uint8_t *)session->rxMem[0] + offset, src, n);
+        src += n;
+        size -= n;
+        offset = session->rxFirst;
+    }
+    if (size > 0) {
+        memcpy((uint8_t *)session->rxMem[1] + (offset - session->rxFirst), src, size);
+    }
+}
+
+static void RxAbort(RcsIsoTpSession_t *session, int event)
+{
+    if (!session->rxActive) {
+        return;
+    }
+    RcsTimerStop(session->config.wheel, &session->rxTimer);
+    RcsFifoSendCompletePartial(session->config.rxFifo, (const void **)session->rxMem, 0);
+    session->rxActive = 0;
+    if (event >= 0) {
+        Notify(session, event);
+    }
+}
+
+/**
+ * @brief 为整条消息申请接收区域并写入长度前缀
+ */
+static int RxBegin(RcsIsoTpSession_t *session, uint32_t size)
+{
+    size_t total = (size_t)size + RCS_ISOTP_MSG_HEADER_SIZE;
+    if (total < size) {
+        return RCS_ISOTP_NO_SPACE;
+    }
+    int first = RcsFifoSendAcquire(session->config.rxFifo, total, session->rxMem);
+    if (first < 0) {
+        return RCS_ISOTP_NO_SPACE;
+    }
+    RcsCursor_t cursor;
+    RcsCursorInit(&cursor, session->rxMem, (size_t)first, total);
+    RcsCursorPutU32Le(&cursor, size);
+    session->rxFirst = (size_t)first;
+    session->rxSize = size;
+    session->rxOffset = 0;
+    session->rxActive = 1;
+    return RCS_ISOTP_OK;
+}
+
+static void RxAppend(RcsIsoTpSession_t *session, const uint8_t *data, size_t size)
+{
+    size_t remain = session->rxSize - session->rxOffset;
+    if (size > remain) {
+        size = remain;
+    }
+    RxWrite(session, RCS_ISOTP_MSG_HEADER_SIZE + session->rxOffset, data, size);
+    session->rxOffset += (uint32_t)size;
+}
+
+static void RxFinish(RcsIsoTpSession_t *session)
+{
+    RcsTimerStop(session->config.wheel, &session->rxTimer);
+    RcsFifoSendComplete(session->config.rxFifo, (const void **)session->rxMem);
+    session->rxActive = 0;
+    Notify(session, RCS_ISOTP_EVENT_RX_DONE);
+}
+
+static void RxTimeout(RcsTimerNode_t *node, void *arg)
+{
+    (void)node;
+    RxAbort((RcsIsoTpSession_t *)arg, RCS_ISOTP_EVENT_RX_TIMEOUT);
+}
+
+static void TxAbort(RcsIsoTpSession_t *session, int event)
+{
+    RcsTimerStop(session->config.wheel, &session->txTimer);
+    session->txState = TX_IDLE;
+    session->txData = NULL;
+    Notify(session, event);
+}
+
+/**
+ * @brief 连续发送连续帧，直到发完、块用完或需要等待STmin
+ */
+static void TxPump(RcsIsoTpSession_t *session)
+{
+    while (session->txState == TX_SENDING) {
+        uint32_t remain = session->txSize - session->txOffset;
+        size_t n = (remain < SF_MAX_DATA) ? remain : SF_MAX_DATA;
+        uint8_t pci = (uint8_t)((PCI_CF << 4) | session->txSn);
+
+        if (PushFrame(session, &pci, 1, session->txData + session->txOffset, n) != RCS_ISOTP_OK) {
+            // 发送帧队列满，下个节拍重试，累计超时则放弃
+            if (++session->txRetry > session->config.timeout) {
+                TxAbort(session, RCS_ISOTP_EVENT_TX_ERROR);
+                return;
+            }
+            RcsTimerStart(session->config.wheel, &session->txTimer, 1);
+            return;
+        }
+        session->txRetry = 0;
+        session->txOffset += (uint32_t)n;
+        session->txSn = (uint8_t)((session->txSn + 1) & 0x0F);
+
+        if (session->txOffset >= session->txSize) {
+            RcsTimerStop(session->config.wheel, &session->txTimer);
+            session->txState = TX_IDLE;
+            session->txData = NULL;
+            Notify(session, RCS_ISOTP_EVENT_TX_DONE);
+            return;
+        }
+        if (session->txBlockRemain != 0 && --session->txBlockRemain == 0) {
+            session->txState = TX_WAIT_FC;
+            RcsTimerStart(session->config.wheel, &session->txTimer, session->config.timeout);
+            return;
+        }
+        if (session->txGapTicks != 0) {
+            RcsTimerStart(session->config.wheel, &session->txTimer, session->txGapTicks);
+            return;
+        }
+    }
+}
+
+static void TxTimer(RcsTimerNode_t *node, void *arg)
+{
+    (void)node;
+    RcsIsoTpSession_t *session = (RcsIsoTpSession_t *)arg;
+    if (session->txState == TX_WAIT_FC) {
+        TxAbort(session, RCS_ISOTP_EVENT_TX_TIMEOUT);
+    }
+    else if (session->txState == TX_SENDING) {
+        TxPump(session);
+    }
+}
+
+static void OnSingleFrame(RcsIsoTpSession_t *session, const RcsCanFrame_t *frame)
+{
+    uint8_t size = frame->data[0] & 0x0F;
+    if (size == 0 || size > SF_MAX_DATA || size + 1 > frame->len) {
+        return;
+    }
+    // 接收中途收到新消息时放弃旧消息
+    RxAbort(session, RCS_ISOTP_EVENT_RX_BAD_SEQ);
+    if (RxBegin(session, size) != RCS_ISOTP_OK) {
+        Notify(session, RCS_ISOTP_EVENT_RX_OVERFLOW);
+        return;
+    }
+    RxAppend(session, &frame->data[1], size);
+    RxFinish(session);
+}
+
+static void OnFirstFrame(RcsIsoTpSession_t *session, const RcsCanFrame_t *frame)
+{
+    if (frame->len < 8) {
+        return;
+    }
+    uint32_t size = ((uint32_t)(frame->data[0] & 0x0F) << 8) | frame->data[1];
+    size_t dataPos = 2;
+    if (size == 0) {
+        // 超过4095字节的消息使用32位长度
+        size = ((uint32_t)frame->data[2] << 24) | ((uint32_t)frame->data[3] << 16) |
+               ((uint32_t)frame->data[4] << 8) | frame->data[5];
+        dataPos = 6;
+        if (size <= FF_MAX_SHORT) {
+            return;
+        }
+    }
+    else if (size <= SF_MAX_DATA) {
+        return;
+    }
+
+    RxAbort(session, RCS_ISOTP_EVENT_RX_BAD_SEQ);
+    if (RxBegin(session, size) != RCS_ISOTP_OK) {
+        SendFlowControl(session, FC_OVFLW);
+        Notify(session, RCS_ISOTP_EVENT_RX_OVERFLOW);
+        return;
+    }
+    RxAppend(session, &frame->data[dataPos], 8 - dataPos);
+    session->rxSn = 1;
+    session->rxBlockCount = 0;
+    SendFlowControl(session, FC_CTS);
+    RcsTimerStart(session->config.wheel, &session->rxTimer, session->config.timeout);
+}
+
+static void OnConsecutiveFrame(RcsIsoTpSession_t *session, const RcsCanFrame_t *frame)
+{
+    if (!session->rxActive || frame->len < 2) {
+        return;
+    }
+    if ((frame->data[0] & 0x0F) != session->rxSn) {
+        RxAbort(session, RCS_ISOTP_EVENT_RX_BAD_SEQ);
+        return;
+    }
+    session->rxSn = (uint8_t)((session->rxSn + 1) & 0x0F);
+    RxAppend(session, &frame->data[1], (size_t)frame->len - 1);
+
+    if (session->rxOffset >= session->rxSize) {
+        RxFinish(session);
+        return;
+    }
+    if (session->config.blockSize != 0 && ++session->rxBlockCount >= session->config.blockSize) {
+        session->rxBlockCount = 0;
+        SendFlowControl(session, FC_CTS);
+    }
+    RcsTimerStart(session->config.wheel, &session->rxTimer, session->config.timeout);
+}
+
+static void OnFlowControl(RcsIsoTpSession_t *session, const RcsCanFrame_t *frame)
+{
+    if (session->txState != TX_WAIT_FC || frame->len < 3) {
+        return;
+    }
+    switch (frame->data[0] & 0x0F) {
+    case FC_CTS:
+        session->txWaitCount = 0;
+        session->txBlockRemain = frame->data[1];
+        session->txGapTicks = StMinToTicks(frame->data[2]);
+        session->txState = TX_SENDING;
+        RcsTimerStop(session->config.wheel, &session->txTimer);
+        TxPump(session);
+        break;
+    case FC_WAIT:
+        // 每个WAIT重新开始N_Bs计时，次数有上限，避免对端无限拖延
+        if (++session->txWaitCount > RCS_ISOTP_WFT_MAX) {
+            TxAbort(session, RCS_ISOTP_EVENT_TX_ERROR);
+            break;
+        }
+        RcsTimerStart(session->config.wheel, &session->txTimer, session->config.timeout);
+        break;
+    case FC_OVFLW:
+        TxAbort(session, RCS_ISOTP_EVENT_TX_OVERFLOW);
+        break;
+    default:
+        TxAbort(session, RCS_ISOTP_EVENT_TX_ERROR);
+        break;
+    }
+}
+
+/**
+ * @brief 初始化会话
+ * @param session 会话实例
+ * @param config 会话配置，会被拷贝
+ * @return 返回错误码
+ * @note 每个会话必须独占一个接收FIFO，多个会话共享时同时存在的申请区域会相互覆盖
+ */
+int RcsIsoTpInit(RcsIsoTpSession_t *session, const RcsIsoTpConfig_t *config)
+{
+    if (session == NULL || config == NULL || config->rxFifo == NULL || config->txQueue == NULL ||
+        config->wheel == NULL || config->timeout == 0) {
+        return RCS_ISOTP_INVALID_PARAM;
+    }
+
+    memset(session, 0, sizeof(RcsIsoTpSession_t));
+    session->config = *config;
+    RcsTimerNodeInit(&session->rxTimer, RxTimeout, session);
+    RcsTimerNodeInit(&session->txTimer, TxTimer, session);
+    return RCS_ISOTP_OK;
+}
+
+/**
+ * @brief 放弃正在进行的收发，不产生事件
+ * @param session 会话实例
+ */
+void RcsIsoTpReset(RcsIsoTpSession_t *session)
+{
+    if (session == NULL) {
+        return;
+    }
+    RxAbort(session, -1);
+    RcsTimerStop(session->config.wheel, &session->txTimer);
+    session->txState = TX_IDLE;
+    session->txData = NULL;
+}
+
+/**
+ * @brief 发送一条消息，不超过7字节时用单帧，否则发送首帧后等待流控
+ * @param session 会话实例
+ * @param data 消息数据，直到TX_DONE或发送错误事件之前必须保持有效
+ * @param size 消息长度，1~0xFFFFFFFF
+ * @return 返回错误码
+ */
+int RcsIsoTpSend(RcsIsoTpSession_t *session, const void *data, size_t size)
+{
+    if (session == NULL || data == NULL || size == 0 || size > 0xFFFFFFFFu) {
+        return RCS_ISOTP_INVALID_PARAM;
+    }
+    if (session->txState != TX_IDLE) {
+        return RCS_ISOTP_BUSY;
+    }
+
+    const uint8_t *in = (const uint8_t *)data;
+    if (size <= SF_MAX_DATA) {
+        uint8_t pci = (uint8_t)((PCI_SF << 4) | size);
+        int ret = PushFrame(session, &pci, 1, in, size);
+        if (ret == RCS_ISOTP_OK) {
+            Notify(session, RCS_ISOTP_EVENT_TX_DONE);
+        }
+        return ret;
+    }
+
+    uint8_t pci[6];
+    size_t pciSize;
+    if (size <= FF_MAX_SHORT) {
+        pci[0] = (uint8_t)((PCI_FF << 4) | (size >> 8));
+        pci[1] = (uint8_t)size;
+        pciSize = 2;
+    }
+    else {
+        pci[0] = (uint8_t)(PCI_FF << 4);
+        pci[1] = 0;
+        pci[2] = (uint8_t)(size >> 24);
+        pci[3] = (uint8_t)(size >> 16);
+        pci[4] = (uint8_t)(size >> 8);
+        pci[5] = (uint8_t)size;
+        pciSize = 6;
+    }
+    int ret = PushFrame(session, pci, pciSize, in, 8 - pciSize);
+    if (ret != RCS_ISOTP_OK) {
+        return ret;
+    }
+
+    session->txData = in;
+    session->txSize = (uint32_t)size;
+    session->txOffset = (uint32_t)(8 - pciSize);
+    session->txSn = 1;
+    session->txRetry = 0;
+    session->txWaitCount = 0;
+    session->txState = TX_WAIT_FC;
+    RcsTimerStart(session->config.wheel, &session->txTimer, session->config.timeout);
+    return RCS_ISOTP_OK;
+}
+
+/**
+ * @brief 处理一帧接收到的CAN帧，可直接在RcsCanQueueDrain的回调中调用
+ * @param session 会话实例
+ * @param frame CAN帧
+ * @return 返回错误码，ID不匹配时返回RCS_ISOTP_NOT_MINE，便于依次尝试多个会话
+ */
+int RcsIsoTpOnFrame(RcsIsoTpSession_t *session, const RcsCanFrame_t *frame)
+{
+    if (session == NULL || frame == NULL) {
+        return RCS_ISOTP_INVALID_PARAM;
+    }
+    if (frame->id != session->config.rxId || frame->len == 0 || (frame->flags & RCS_CAN_FLAG_RTR)) {
+        return RCS_ISOTP_NOT_MINE;
+    }
+
+    switch (frame->data[0] >> 4) {
+    case PCI_SF:
+        OnSingleFrame(session, frame);
+        break;
+    case PCI_FF:
+        OnFirstFrame(session, frame);
+        break;
+    case PCI_CF:
+        OnConsecutiveFrame(session, frame);
+        break;
+    case PCI_FC:
+        OnFlowControl(session, frame);
+        break;
+    default:
+        break;
+    }
+    return RCS_ISOTP_OK;
+}
+
+/**
+ * @brief 查询是否有消息正在发送
+ * @param session 会话实例
+ * @return 正在发送返回1，否则返回0
+ */
+int RcsIsoTpIsSending(const RcsIsoTpSession_t *session)
+{
+    return (session != NULL && session->txState != TX_IDLE) ? 1 : 0;
+}
+
+/**
+ * @brief 从接收FIFO取出下一条重组好的消息，负载以两段视图给出，不拷贝
+ * @param fifo 会话的接收FIFO
+ * @param payload 返回负载视图
+ * @param memAcquired 返回接收申请的内存指针，释放时传回
+ * @return 返回负载长度，没有消息时返回RCS_ISOTP_EMPTY
+ */
+int RcsIsoTpMsgAcquire(RcsFifo_t fifo, RcsFifoView_t *payload, void *memAcquired[2])
+{
+    if (fifo == NULL || payload == NULL || memAcquired == NULL) {
+        return RCS_ISOTP_INVALID_PARAM;
+    }
+
+    size_t used = RcsFifoGetUsed(fifo);
+    if (used < RCS_ISOTP_MSG_HEADER_SIZE) {
+        return RCS_ISOTP_EMPTY;
+    }
+    int first = RcsFifoRecvAcquire(fifo, used, memAcquired);
+    if (first < 0) {
+        return RCS_ISOTP_EMPTY;
+    }
+
+    RcsFifoView_t view;
+    RcsCursor_t cursor;
+    RcsFifoViewInit(&view, memAcquired, (size_t)first, used);
+    RcsCursorInitView(&cursor, &view);
+    size_t size = RcsCursorGetU32Le(&cursor);
+    if (RcsFifoViewSlice(&view, RCS_ISOTP_MSG_HEADER_SIZE, size, payload) != RCS_FIFO_OK) {
+        RcsFifoRecvCompletePartial(fifo, (const void **)memAcquired, 0);
+        return RCS_ISOTP_ERROR;
+    }
+    return (int)size;
+}
+
+/**
+ * @brief 释放由RcsIsoTpMsgAcquire取出的消息
+ * @param fifo 会话的接收FIFO
+ * @param memAcquired RcsIsoTpMsgAcquire返回的内存指针
+ * @param size RcsIsoTpMsgAcquire返回的负载长度
+ * @return 返回错误码
+ */
+int RcsIsoTpMsgRelease(RcsFifo_t fifo, void *memAcquired[2], size_t size)
+{
+    if (fifo == NULL || memAcquired == NULL) {
+        return RCS_ISOTP_INVALID_PARAM;
+    }
+    int ret = RcsFifoRecvCompletePartial(fifo, (const void **)memAcquired, RCS_ISOTP_MSG_HEADER_SIZE + size);
+    return (ret == RCS_FIFO_OK) ? RCS_ISOTP_OK : RCS_ISOTP_ERROR;
+}
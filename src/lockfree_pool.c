@@ -0,0 +1,262 @@
+/**
+ * @file lockfree_pool.c
+ * @brief 无锁固定块内存池，空闲链表为带版本号的Treiber栈，多个不同优先级的中断可同时申请而无需关中断
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "lockfree_pool.h"
+
+#define HEAD_INDEX(head) ((uint32_t)((head) & RCS_LFPOOL_NIL))
+#define HEAD_TAG(head)   ((head) >> RCS_LFPOOL_INDEX_BITS)
+#define HEAD_MAKE(tag, index) \
+    ((((RcsLfPoolHead_t)(tag)) << RCS_LFPOOL_INDEX_BITS) | (RcsLfPoolHead_t)(index))
+
+static inline uint32_t *BlockNextIndex(RcsLfPoolHandle_t *handle, uint32_t index)
+{
+    return (uint32_t *)&handle->mem[(size_t)index * handle->blockSize];
+}
+
+/**
+ * @brief 入栈，每次成功修改栈顶都递增版本号，避免ABA
+ */
+static void PushIndex(RcsLfPoolHandle_t *handle, uint32_t index)
+{
+    uint32_t *next = BlockNextIndex(handle, index);
+    RcsLfPoolHead_t old = __atomic_load_n(&handle->head, __ATOMIC_RELAXED);
+    RcsLfPoolHead_t desired;
+    do {
+        __atomic_store_n(next, HEAD_INDEX(old), __ATOMIC_RELAXED);
+        desired = HEAD_MAKE(HEAD_TAG(old) + 1, index);
+    } while (!__atomic_compare_exchange_n(&handle->head, &old, desired, 1,
+                                          __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    __atomic_fetch_add(&handle->freeCount, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 出栈；读取的next可能已被其他申请者改写，此时版本号必然变化，CAS失败后重试
+ */
+static uint32_t PopIndex(RcsLfPoolHandle_t *handle)
+{
+    RcsLfPoolHead_t old = __atomic_load_n(&handle->head, __ATOMIC_ACQUIRE);
+    RcsLfPoolHead_t desired;
+    do {
+        uint32_t index = HEAD_INDEX(old);
+        if (index == RCS_LFPOOL_NIL) {
+            return RCS_LFPOOL_NIL;
+        }
+        uint32_t next = __atomic_load_n(BlockNextIndex(handle, index), __ATOMIC_RELAXED);
+        desired = HEAD_MAKE(HEAD_TAG(old) + 1, next);
+    } while (!__atomic_compare_exchange_n(&handle->head, &old, desired, 1,
+                                          __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+    __atomic_fetch_sub(&handle->freeCount, 1, __ATOMIC_RELAXED);
+    return HEAD_INDEX(old);
+}
+
+/**
+ * @brief 使用静态申请的方式创建无锁内存池
+ * @param blockSize 块大小，会按指针大小向上对齐
+ * @param blockCount 块数量，不超过RCS_LFPOOL_MAX_BLOCKS
+ * @param staticHandle 静态的内存池句柄
+ * @param poolMemory 静态内存，大小至少为RCS_LFPOOL_MEM_SIZE(blockSize, blockCount)，按指针对齐
+ * @return 返回内存池句柄
+ */
+RcsLfPool_t RcsLfPoolCreateStatic(size_t blockSize, size_t blockCount, RcsLfPoolHandle_t *staticHandle, uint8_t *poolMemory)
+{
+    if (staticHandle == NULL || poolMemory == NULL || blockSize == 0 ||
+        blockCount == 0 || blockCount > RCS_LFPOOL_MAX_BLOCKS) {
+        return NULL;
+    }
+    if (((uintptr_t)poolMemory & (RCS_LFPOOL_ALIGN - 1)) != 0) {
+        return NULL;
+    }
+
+    staticHandle->mem = poolMemory;
+    staticHandle->blockSize = RCS_LFPOOL_BLOCK_SIZE(blockSize);
+    staticHandle->blockCount = (uint32_t)blockCount;
+    staticHandle->freeCount = (uint32_t)blockCount;
+
+    // 按下标顺序串成链表，创建阶段尚无并发
+    for (uint32_t i = 0; i < (uint32_t)blockCount; i++) {
+        *BlockNextIndex(staticHandle, i) = (i + 1 < (uint32_t)blockCount) ? i + 1 : RCS_LFPOOL_NIL;
+    }
+    __atomic_store_n(&staticHandle->head, HEAD_MAKE(0, 0), __ATOMIC_RELEASE);
+
+    return (RcsLfPool_t)staticHandle;
+}
+
+/**
+ * @brief 使用动态申请的方式创建无锁内存池
+ * @param blockSize 块大小，会按指针大小向上对齐
+ * @param blockCount 块数量
+ * @return 返回内存池句柄
+ */
+RcsLfPool_t RcsLfPoolCreate(size_t blockSize, size_t blockCount)
+{
+    if (blockSize == 0 || blockCount == 0 || blockCount > RCS_LFPOOL_MAX_BLOCKS) {
+        return NULL;
+    }
+
+    RcsLfPoolHandle_t *handle = (RcsLfPoolHandle_t *)LfPoolPortMalloc(sizeof(RcsLfPoolHandle_t));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    uint8_t *mem = (uint8_t *)LfPoolPortMalloc(RCS_LFPOOL_MEM_SIZE(blockSize, blockCount));
+    if (mem == NULL) {
+        LfPoolPortFree(handle);
+        return NULL;
+    }
+
+    return RcsLfPoolCreateStatic(blockSize, blockCount, handle, mem);
+}
+
+/**
+ * @brief 销毁无锁内存池
+ * @param pool 内存池句柄
+ * @warning 请勿传入静态内存池句柄
+ */
+void RcsLfPoolDestroy(RcsLfPool_t pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    RcsLfPoolHandle_t *handle = (RcsLfPoolHandle_t *)pool;
+    LfPoolPortFree(handle->mem);
+    LfPoolPortFree(handle);
+}
+
+/**
+ * @brief 从无锁内存池申请一个块，可在任意优先级的中断中调用
+ * @param pool 内存池句柄
+ * @return 返回块的地址，内存池耗尽时返回NULL
+ */
+void *RcsLfPoolAlloc(RcsLfPool_t pool)
+{
+    if (pool == NULL) {
+        return NULL;
+    }
+    RcsLfPoolHandle_t *handle = (RcsLfPoolHandle_t *)pool;
+
+    uint32_t index = PopIndex(handle);
+    if (index == RCS_LFPOOL_NIL) {
+        return NULL;
+    }
+    return &handle->mem[(size_t)index * handle->blockSize];
+}
+
+/**
+ * @brief 将块归还给无锁内存池，可在任意优先级的中断中调用
+ * @param pool 内存池句柄
+ * @param block 由RcsLfPoolAlloc返回的块
+ * @return 返回错误码
+ */
+int RcsLfPoolFree(RcsLfPool_t pool, void *block)
+{
+    if (pool == NULL || block == NULL) {
+        return RCS_LFPOOL_INVALID_PARAM;
+    }
+    RcsLfPoolHandle_t *handle = (RcsLfPoolHandle_t *)pool;
+
+    uintptr_t offset = (uintptr_t)block - (uintptr_t)handle->mem;
+    if ((uintptr_t)block < (uintptr_t)handle->mem ||
+        offset >= handle->blockSize * handle->blockCount ||
+        offset % handle->blockSize != 0) {
+        return RCS_LFPOOL_INVALID_PARAM;
+    }
+
+    PushIndex(handle, (uint32_t)(offset / handle->blockSize));
+    return RCS_LFPOOL_OK;
+}
+
+/**
+ * @brief 获取剩余块数，并发时仅为近似值
+ * @param pool 内存池句柄
+ * @return 返回剩余块数
+ */
+size_t RcsLfPoolGetFree(RcsLfPool_t pool)
+{
+    if (pool == NULL) {
+        return 0;
+    }
+    return __atomic_load_n(&((RcsLfPoolHandle_t *)pool)->freeCount, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 初始化线程本地缓存
+ * @param cache 缓存，只能由一个线程使用
+ * @param pool 内存池句柄
+ * @return 返回错误码
+ */
+int RcsLfPoolCacheInit(RcsLfPoolCache_t *cache, RcsLfPool_t pool)
+{
+    if (cache == NULL || pool == NULL) {
+        return RCS_LFPOOL_INVALID_PARAM;
+    }
+    cache->pool = pool;
+    cache->count = 0;
+    return RCS_LFPOOL_OK;
+}
+
+/**
+ * @brief 经由线程本地缓存申请；缓存为空时从共享栈批量取回一半容量
+ * @param cache 缓存
+ * @return 返回块的地址，内存池耗尽时返回NULL
+ */
+void *RcsLfPoolCacheAlloc(RcsLfPoolCache_t *cache)
+{
+    if (cache == NULL) {
+        return NULL;
+    }
+    if (cache->count == 0) {
+        while (cache->count < RCS_LFPOOL_CACHE_SIZE / 2) {
+            void *block = RcsLfPoolAlloc(cache->pool);
+            if (block == NULL) {
+                break;
+            }
+            cache->blocks[cache->count++] = block;
+        }
+        if (cache->count == 0) {
+            return NULL;
+        }
+    }
+    return cache->blocks[--cache->count];
+}
+
+/**
+ * @brief 经由线程本地缓存释放；缓存已满时把一半归还共享栈
+ * @param cache 缓存
+ * @param block 块的地址
+ * @return 返回错误码
+ */
+int RcsLfPoolCacheFree(RcsLfPoolCache_t *cache, void *block)
+{
+    if (cache == NULL || block == NULL) {
+        return RCS_LFPOOL_INVALID_PARAM;
+    }
+    if (cache->count == RCS_LFPOOL_CACHE_SIZE) {
+        while (cache->count > RCS_LFPOOL_CACHE_SIZE / 2) {
+            RcsLfPoolFree(cache->pool, cache->blocks[--cache->count]);
+        }
+    }
+    cache->blocks[cache->count++] = block;
+    return RCS_LFPOOL_OK;
+}
+
+/**
+ * @brief 将缓存中的块全部归还共享栈，线程退出前调用
+ * @param cache 缓存
+ */
+void RcsLfPoolCacheFlush(RcsLfPoolCache_t *cache)
+{
+    if (cache == NULL) {
+        return;
+    }
+    while (cache->count > 0) {
+        RcsLfPoolFree(cache->pool, cache->blocks[--cache->count]);
+    }
+}
@@ -0,0 +1,249 @@
+/**
+ * @file msg_queue.c
+ * @brief 指针传递的消息队列，消息块来自内存池，按引用计数在多个接收方间共享，零拷贝移交
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "msg_queue.h"
+
+static inline RcsMsgHeader_t *MsgHeader(const void *msg)
+{
+    return (RcsMsgHeader_t *)((uint8_t *)msg - RCS_MSG_HEADER_SIZE);
+}
+
+/**
+ * @brief 从内存池申请一条消息，初始引用计数为1
+ * @param pool 内存池句柄，块大小至少为RCS_MSG_BLOCK_SIZE(size)
+ * @param size 负载大小
+ * @return 返回负载地址，失败返回NULL
+ */
+void *RcsMsgAlloc(RcsPool_t pool, size_t size)
+{
+    if (pool == NULL || size == 0 || RCS_MSG_BLOCK_SIZE(size) > ((RcsPoolHandle_t *)pool)->blockSize) {
+        return NULL;
+    }
+
+    RcsMsgHeader_t *header = (RcsMsgHeader_t *)RcsPoolAlloc(pool);
+    if (header == NULL) {
+        return NULL;
+    }
+    header->pool = pool;
+    header->refCount = 1;
+    header->size = (uint32_t)size;
+
+    return (uint8_t *)header + RCS_MSG_HEADER_SIZE;
+}
+
+/**
+ * @brief 增加消息的引用计数，每个额外的持有者调用一次
+ * @param msg 消息负载地址
+ */
+void RcsMsgRetain(void *msg)
+{
+    if (msg == NULL) {
+        return;
+    }
+    RcsMsgHeader_t *header = MsgHeader(msg);
+    MsgPortEnterCriticalFromAll();
+    header->refCount++;
+    MsgPortExitCriticalFromAll();
+}
+
+/**
+ * @brief 释放一个引用，最后一个持有者释放时消息自动归还内存池
+ * @param msg 消息负载地址
+ */
+void RcsMsgRelease(void *msg)
+{
+    if (msg == NULL) {
+        return;
+    }
+    RcsMsgHeader_t *header = MsgHeader(msg);
+    MsgPortEnterCriticalFromAll();
+    uint32_t remain = --header->refCount;
+    MsgPortExitCriticalFromAll();
+
+    if (remain == 0) {
+        RcsPoolFree(header->pool, header);
+    }
+}
+
+/**
+ * @brief 获取消息的负载大小
+ * @param msg 消息负载地址
+ * @return 返回负载大小
+ */
+size_t RcsMsgGetSize(const void *msg)
+{
+    if (msg == NULL) {
+        return 0;
+    }
+    return MsgHeader(msg)->size;
+}
+
+/**
+ * @brief 使用静态申请的方式创建消息队列
+ * @param depth 队列深度，即最多可缓存的消息数
+ * @param staticHandle 静态的队列句柄
+ * @param slotMemory 静态槽数组，长度为depth
+ * @return 返回队列句柄
+ */
+RcsMsgQueue_t RcsMsgQueueCreateStatic(size_t depth, RcsMsgQueueHandle_t *staticHandle, void **slotMemory)
+{
+    if (depth == 0 || staticHandle == NULL || slotMemory == NULL) {
+        return NULL;
+    }
+
+    staticHandle->slots = slotMemory;
+    staticHandle->slotCount = depth;
+    staticHandle->indexWrite = 0;
+    staticHandle->indexRead = 0;
+    staticHandle->count = 0;
+
+    return (RcsMsgQueue_t)staticHandle;
+}
+
+/**
+ * @brief 使用动态申请的方式创建消息队列
+ * @param depth 队列深度
+ * @return 返回队列句柄
+ */
+RcsMsgQueue_t RcsMsgQueueCreate(size_t depth)
+{
+    if (depth == 0) {
+        return NULL;
+    }
+
+    RcsMsgQueueHandle_t *handle = (RcsMsgQueueHandle_t *)MsgPortMalloc(sizeof(RcsMsgQueueHandle_t));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    void **slots = (void **)MsgPortMalloc(depth * sizeof(void *));
+    if (slots == NULL) {
+        MsgPortFree(handle);
+        return NULL;
+    }
+
+    return RcsMsgQueueCreateStatic(depth, handle, slots);
+}
+
+/**
+ * @brief 销毁消息队列，队列中残留的消息会被释放
+ * @param queue 队列句柄
+ * @warning 请勿传入静态队列句柄
+ */
+void RcsMsgQueueDestroy(RcsMsgQueue_t queue)
+{
+    if (queue == NULL) {
+        return;
+    }
+    void *msg = NULL;
+    while (RcsMsgQueueRecv(queue, &msg) == RCS_MSG_OK) {
+        RcsMsgRelease(msg);
+    }
+    RcsMsgQueueHandle_t *handle = (RcsMsgQueueHandle_t *)queue;
+    MsgPortFree(handle->slots);
+    MsgPortFree(handle);
+}
+
+/**
+ * @brief 发送消息，调用者持有的引用随消息一并移交给队列
+ * @param queue 队列句柄
+ * @param msg 消息负载地址
+ * @return 返回错误码，队列满时返回RCS_MSG_FULL，此时引用仍归调用者
+ */
+int RcsMsgQueueSend(RcsMsgQueue_t queue, void *msg)
+{
+    if (queue == NULL || msg == NULL) {
+        return RCS_MSG_INVALID_PARAM;
+    }
+    RcsMsgQueueHandle_t *handle = (RcsMsgQueueHandle_t *)queue;
+    MsgPortEnterCriticalFromAll();
+
+    if (handle->count >= handle->slotCount) {
+        MsgPortExitCriticalFromAll();
+        return RCS_MSG_FULL;
+    }
+    handle->slots[handle->indexWrite] = msg;
+    handle->indexWrite = (handle->indexWrite + 1 == handle->slotCount) ? 0 : handle->indexWrite + 1;
+    handle->count++;
+
+    MsgPortExitCriticalFromAll();
+    return RCS_MSG_OK;
+}
+
+/**
+ * @brief 接收消息，接收者获得一个引用，用完后调用RcsMsgRelease
+ * @param queue 队列句柄
+ * @param msg 返回的消息负载地址
+ * @return 返回错误码，队列空时返回RCS_MSG_EMPTY
+ */
+int RcsMsgQueueRecv(RcsMsgQueue_t queue, void **msg)
+{
+    if (queue == NULL || msg == NULL) {
+        return RCS_MSG_INVALID_PARAM;
+    }
+    RcsMsgQueueHandle_t *handle = (RcsMsgQueueHandle_t *)queue;
+    MsgPortEnterCriticalFromAll();
+
+    if (handle->count == 0) {
+        MsgPortExitCriticalFromAll();
+        return RCS_MSG_EMPTY;
+    }
+    *msg = handle->slots[handle->indexRead];
+    handle->indexRead = (handle->indexRead + 1 == handle->slotCount) ? 0 : handle->indexRead + 1;
+    handle->count--;
+
+    MsgPortExitCriticalFromAll();
+    return RCS_MSG_OK;
+}
+
+/**
+ * @brief 将同一条消息分发给多个队列，每个队列各持有一个引用
+ * @param queues 队列句柄数组
+ * @param queueCount 队列个数
+ * @param msg 消息负载地址，调用者的引用在函数返回后即被消耗
+ * @return 返回成功投递的队列个数，参数错误时返回错误码
+ */
+int RcsMsgQueueBroadcast(RcsMsgQueue_t *queues, size_t queueCount, void *msg)
+{
+    if (queues == NULL || queueCount == 0 || msg == NULL) {
+        return RCS_MSG_INVALID_PARAM;
+    }
+
+    int delivered = 0;
+    for (size_t i = 0; i < queueCount; i++) {
+        RcsMsgRetain(msg);
+        if (RcsMsgQueueSend(queues[i], msg) == RCS_MSG_OK) {
+            delivered++;
+        }
+        else {
+            RcsMsgRelease(msg);
+        }
+    }
+    RcsMsgRelease(msg);
+    return delivered;
+}
+
+/**
+ * @brief 获取队列中的消息数
+ * @param queue 队列句柄
+ * @return 返回消息数
+ */
+size_t RcsMsgQueueGetCount(RcsMsgQueue_t queue)
+{
+    if (queue == NULL) {
+        return 0;
+    }
+    RcsMsgQueueHandle_t *handle = (RcsMsgQueueHandle_t *)queue;
+    MsgPortEnterCriticalFromAll();
+    size_t count = handle->count;
+    MsgPortExitCriticalFromAll();
+    return count;
+}
@@ -0,0 +1,314 @@
+/**
+ * @file shm_fifo.c
+ * @brief 位置无关的共享内存FIFO，句柄与数据位于同一映射区，可在多个进程间零拷贝传输
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "shm_fifo.h"
+
+// 数据区偏移，按缓存行对齐
+#define RCS_SHM_FIFO_DATA_OFFSET \
+    ((sizeof(RcsShmFifoHeader_t) + RCS_SHM_FIFO_CACHE_LINE - 1) & ~(size_t)(RCS_SHM_FIFO_CACHE_LINE - 1))
+
+/**
+ * @brief 按给定的起始位置和长度，把环形区域拆分为至多两段
+ * @return 返回第一段的长度
+ */
+static int SplitRegion(uint8_t *data, uint64_t capacity, uint64_t index, size_t size, void *memAcquired[2])
+{
+    size_t offset = (size_t)(index % capacity);
+    size_t right = (size_t)capacity - offset;
+
+    memAcquired[0] = &data[offset];
+    if (right >= size) {
+        memAcquired[1] = NULL;
+        return (int)size;
+    }
+    memAcquired[1] = &data[0];
+    return (int)right;
+}
+
+/**
+ * @brief 计算容纳指定容量所需的共享区大小
+ * @param capacity 数据区大小，单位为字节
+ * @return 返回共享区大小
+ */
+size_t RcsShmFifoRegionSize(size_t capacity)
+{
+    return RCS_SHM_FIFO_DATA_OFFSET + capacity;
+}
+
+/**
+ * @brief 在一块调用者提供的内存上格式化共享FIFO
+ * @param fifo 进程内视图
+ * @param region 共享区起始位置，至少按8字节对齐
+ * @param regionSize 共享区大小
+ * @return 返回错误码
+ */
+int RcsShmFifoInitRegion(RcsShmFifo_t *fifo, void *region, size_t regionSize)
+{
+    if (fifo == NULL || region == NULL || regionSize <= RCS_SHM_FIFO_DATA_OFFSET) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    RcsShmFifoHeader_t *header = (RcsShmFifoHeader_t *)region;
+    memset(header, 0, sizeof(RcsShmFifoHeader_t));
+    header->version = RCS_SHM_FIFO_VERSION;
+    header->capacity = regionSize - RCS_SHM_FIFO_DATA_OFFSET;
+    header->dataOffset = RCS_SHM_FIFO_DATA_OFFSET;
+    // 魔数最后发布，其他进程看到魔数即可认为头部已就绪
+    __atomic_store_n(&header->magic, RCS_SHM_FIFO_MAGIC, __ATOMIC_RELEASE);
+
+    return RcsShmFifoAttachRegion(fifo, region, regionSize);
+}
+
+/**
+ * @brief 挂接到一块已被格式化的共享区，各进程的映射地址可以不同
+ * @param fifo 进程内视图
+ * @param region 本进程中共享区的映射地址
+ * @param regionSize 共享区大小
+ * @return 返回错误码
+ */
+int RcsShmFifoAttachRegion(RcsShmFifo_t *fifo, void *region, size_t regionSize)
+{
+    if (fifo == NULL || region == NULL || regionSize < sizeof(RcsShmFifoHeader_t)) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    RcsShmFifoHeader_t *header = (RcsShmFifoHeader_t *)region;
+    if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != RCS_SHM_FIFO_MAGIC ||
+        header->version != RCS_SHM_FIFO_VERSION ||
+        header->capacity == 0 ||
+        header->dataOffset + header->capacity > regionSize) {
+        return RCS_FIFO_ERROR;
+    }
+
+    fifo->header = header;
+    fifo->data = (uint8_t *)region + header->dataOffset;
+    fifo->mapSize = 0;
+    fifo->sendPending = 0;
+    fifo->recvPending = 0;
+    return RCS_FIFO_OK;
+}
+
+#if defined(__unix__)
+
+/**
+ * @brief 创建命名共享内存并在其中格式化共享FIFO
+ * @param fifo 进程内视图
+ * @param name 共享内存名字，以'/'开头
+ * @param capacity 数据区大小，单位为字节
+ * @return 返回错误码，同名共享内存已存在时返回RCS_FIFO_NOT_ALLOWED
+ */
+int RcsShmFifoCreate(RcsShmFifo_t *fifo, const char *name, size_t capacity)
+{
+    if (fifo == NULL || name == NULL || capacity == 0) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        return RCS_FIFO_NOT_ALLOWED;
+    }
+
+    size_t mapSize = RcsShmFifoRegionSize(capacity);
+    if (ftruncate(fd, (off_t)mapSize) != 0) {
+        close(fd);
+        shm_unlink(name);
+        return RCS_FIFO_ERROR;
+    }
+
+    void *region = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED) {
+        shm_unlink(name);
+        return RCS_FIFO_ERROR;
+    }
+
+    int ret = RcsShmFifoInitRegion(fifo, region, mapSize);
+    if (ret != RCS_FIFO_OK) {
+        munmap(region, mapSize);
+        shm_unlink(name);
+        return ret;
+    }
+    fifo->mapSize = mapSize;
+    return RCS_FIFO_OK;
+}
+
+/**
+ * @brief 挂接到由其他进程创建的命名共享FIFO
+ * @param fifo 进程内视图
+ * @param name 共享内存名字
+ * @return 返回错误码
+ */
+int RcsShmFifoAttach(RcsShmFifo_t *fifo, const char *name)
+{
+    if (fifo == NULL || name == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    int fd = shm_open(name, O_RDWR, 0600);
+    if (fd < 0) {
+        return RCS_FIFO_ERROR;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(RcsShmFifoHeader_t)) {
+        close(fd);
+        return RCS_FIFO_ERROR;
+    }
+
+    size_t mapSize = (size_t)st.st_size;
+    void *region = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED) {
+        return RCS_FIFO_ERROR;
+    }
+
+    int ret = RcsShmFifoAttachRegion(fifo, region, mapSize);
+    if (ret != RCS_FIFO_OK) {
+        munmap(region, mapSize);
+        return ret;
+    }
+    fifo->mapSize = mapSize;
+    return RCS_FIFO_OK;
+}
+
+/**
+ * @brief 解除本进程的映射，不影响其他进程
+ * @param fifo 进程内视图
+ */
+void RcsShmFifoDetach(RcsShmFifo_t *fifo)
+{
+    if (fifo == NULL || fifo->header == NULL) {
+        return;
+    }
+    if (fifo->mapSize != 0) {
+        munmap(fifo->header, fifo->mapSize);
+    }
+    fifo->header = NULL;
+    fifo->data = NULL;
+    fifo->mapSize = 0;
+}
+
+/**
+ * @brief 删除命名共享内存，已挂接的进程仍可继续使用直到解除映射
+ * @param name 共享内存名字
+ * @return 返回错误码
+ */
+int RcsShmFifoUnlink(const char *name)
+{
+    if (name == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    return shm_unlink(name) == 0 ? RCS_FIFO_OK : RCS_FIFO_ERROR;
+}
+
+#endif /* __unix__ */
+
+/**
+ * @brief 向共享FIFO申请发送数据（仅限唯一的生产者调用）
+ * @param fifo 进程内视图
+ * @param size 需要发送的数据大小
+ * @param memAcquired 返回的内存指针
+ * @return 返回第一段的数据大小
+ */
+int RcsShmFifoSendAcquire(RcsShmFifo_t *fifo, size_t size, void *memAcquired[2])
+{
+    if (fifo == NULL || fifo->header == NULL || memAcquired == NULL || size == 0) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    if (fifo->sendPending != 0) {
+        return RCS_FIFO_NOT_ALLOWED;
+    }
+
+    RcsShmFifoHeader_t *header = fifo->header;
+    uint64_t write = header->writeIndex;
+    uint64_t read = __atomic_load_n(&header->readIndex, __ATOMIC_ACQUIRE);
+    if (size > header->capacity - (write - read)) {
+        return RCS_FIFO_NO_SPACE;
+    }
+
+    fifo->sendPending = size;
+    return SplitRegion(fifo->data, header->capacity, write, size, memAcquired);
+}
+
+/**
+ * @brief 向共享FIFO声明数据发送完成，数据对消费者可见
+ * @param fifo 进程内视图
+ * @return 返回错误码，没有进行中的发送申请时返回RCS_FIFO_NOT_ALLOWED
+ */
+int RcsShmFifoSendComplete(RcsShmFifo_t *fifo)
+{
+    if (fifo == NULL || fifo->header == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    if (fifo->sendPending == 0) {
+        return RCS_FIFO_NOT_ALLOWED;
+    }
+
+    RcsShmFifoHeader_t *header = fifo->header;
+    __atomic_store_n(&header->writeIndex, header->writeIndex + fifo->sendPending, __ATOMIC_RELEASE);
+    fifo->sendPending = 0;
+    return RCS_FIFO_OK;
+}
+
+/**
+ * @brief 向共享FIFO申请接收数据（仅限唯一的消费者调用）
+ * @param fifo 进程内视图
+ * @param size 需要接收的数据大小
+ * @param memAcquired 返回的内存指针
+ * @return 返回第一段的数据大小
+ */
+int RcsShmFifoRecvAcquire(RcsShmFifo_t *fifo, size_t size, void *memAcquired[2])
+{
+    if (fifo == NULL || fifo->header == NULL || memAcquired == NULL || size == 0) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    if (fifo->recvPending != 0) {
+        return RCS_FIFO_NOT_ALLOWED;
+    }
+
+    RcsShmFifoHeader_t *header = fifo->header;
+    uint64_t read = header->readIndex;
+    uint64_t write = __atomic_load_n(&header->writeIndex, __ATOMIC_ACQUIRE);
+    if (size > write - read) {
+        return RCS_FIFO_NO_DATA;
+    }
+
+    fifo->recvPending = size;
+    return SplitRegion(fifo->data, header->capacity, read, size, memAcquired);
+}
+
+/**
+ * @brief 向共享FIFO声明数据接收完成，空间归还给生产者
+ * @param fifo 进程内视图
+ * @return 返回错误码，没有进行中的接收申请时返回RCS_FIFO_NOT_ALLOWED
+ */
+int RcsShmFifoRecvComplete(RcsShmFifo_t *fifo)
+{
+    if (fifo == NULL || fifo->header == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    if (fifo->recvPending == 0) {
+        return RCS_FIFO_NOT_ALLOWED;
+    }
+
+    RcsShmFifoHeader_t *header = fifo->header;
+    __atomic_store_n(&header->readIndex, header->readIndex + fifo->recvPending, __ATOMIC_RELEASE);
+    fifo->recvPending = 0;
+    return RCS_FIFO_OK;
+}
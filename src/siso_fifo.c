@@ -9,6 +9,10 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <string.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 #include "siso_fifo.h"
 
@@ -36,6 +40,95 @@
      (fifo)->indexWriteTail - (fifo)->indexReadHead : \
      (fifo)->memSize - (fifo)->indexReadHead)
 
+/**
+ * @brief 从外部位置源读取写位置并推进写指针，调用者须已进入临界区
+ * @return 返回新写入的字节数，写入量超过空闲空间或接收申请期间的覆盖尚未处理时返回RCS_FIFO_OVERRUN
+ * @note 两次同步之间外部写入者不得前进一整圈，循环DMA在半满与全满中断中调用RcsFifoPosUpdate即可保证
+ */
+static int FifoPosSync(RcsFifoHandle_t *handle)
+{
+    size_t pos = handle->posSource(handle->posArg) % handle->memSize;
+    size_t delta = (pos + handle->memSize - handle->indexWriteTail) % handle->memSize;
+    if (delta == 0) {
+        return 0;
+    }
+
+    int ret = (int)delta;
+    if (handle->overrun) {
+        // 接收申请期间的覆盖尚未处理，未读数据届时会全部丢弃，不再检查空间也不重复计数
+        ret = RCS_FIFO_OVERRUN;
+    }
+    else if (delta > RCS_FIFO_FREE_SPACE(handle)) {
+        handle->overrun = 1;
+        handle->overrunCount++;
+        ret = RCS_FIFO_OVERRUN;
+    }
+    handle->indexWriteHead = pos;
+    handle->indexWriteTail = pos;
+
+    // 未读数据已不可信，没有接收申请时立即丢弃一次，否则等接收方完成时丢弃
+    if (handle->overrun && handle->indexReadHead == handle->indexReadTail) {
+        handle->indexReadHead = pos;
+        handle->indexReadTail = pos;
+        handle->overrun = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief 取得事件钩子的副本，主机端同时登记一次进行中的调用，调用者须已进入临界区
+ * @param arg 返回钩子的参数
+ * @return 返回钩子，未注册时返回NULL
+ * @note 钩子可能在临界区外被注销，只能调用临界区内取得的副本
+ */
+static RcsFifoEventHook_t FifoHookHold(RcsFifoHandle_t *handle, void **arg)
+{
+    *arg = handle->eventArg;
+#if defined(__linux__)
+    if (handle->eventHook != NULL) {
+        handle->hookCalls++;
+    }
+#endif
+    return handle->eventHook;
+}
+
+/**
+ * @brief 在临界区外调用FifoHookHold取得的钩子，并撤销登记
+ */
+static void FifoHookCall(RcsFifoHandle_t *handle, RcsFifoEventHook_t hook, int event, void *arg)
+{
+    if (hook == NULL) {
+        return;
+    }
+    hook((RcsFifo_t)handle, event, arg);
+#if defined(__linux__)
+    FifoPortEnterCriticalFromAll(handle);
+    handle->hookCalls--;
+    FifoPortExitCriticalFromAll(handle);
+#endif
+}
+
+/**
+ * @brief 主机端等待其他线程中已取得副本的钩子调用全部返回，之后钩子的参数才可以释放
+ * @note 不得在钩子内部注销钩子，否则会一直等待自己
+ */
+static void FifoHookWaitIdle(RcsFifoHandle_t *handle)
+{
+#if defined(__linux__)
+    for (;;) {
+        FifoPortEnterCriticalFromAll(handle);
+        uint32_t calls = handle->hookCalls;
+        FifoPortExitCriticalFromAll(handle);
+        if (calls == 0) {
+            return;
+        }
+        sched_yield();
+    }
+#else
+    (void)handle;
+#endif
+}
+
 /**
  * @brief 使用静态申请的方式创建FIFO
  * @param fifoSize FIFO的大小，单位为字节，实际可用大小尾fifosize-1
@@ -55,6 +148,17 @@ RcsFifo_t RcsFifoCreateStatic(size_t fifoSize,RcsFifoHandle_t *staticHandle,uint
     staticHandle->indexWriteTail = 0;
     staticHandle->indexReadHead = 0;
     staticHandle->indexReadTail = 0;
+    staticHandle->eventHook = NULL;
+    staticHandle->eventArg = NULL;
+    staticHandle->allocator = NULL;
+    staticHandle->posSource = NULL;
+    staticHandle->posArg = NULL;
+    staticHandle->overrunCount = 0;
+    staticHandle->overrun = 0;
+#if defined(__linux__)
+    pthread_mutex_init(&staticHandle->hostLock, NULL);
+    staticHandle->hookCalls = 0;
+#endif
     
     return (RcsFifo_t)staticHandle;
 }
@@ -81,13 +185,29 @@ RcsFifo_t RcsFifoCreate(size_t fifoSize)
         return NULL;
     }
     
-    handle->mem = mem;
-    handle->memSize = fifoSize;
-    handle->indexWriteHead = 0;
-    handle->indexWriteTail = 0;
-    handle->indexReadHead = 0;
-    handle->indexReadTail = 0;
-    
+    return RcsFifoCreateStatic(fifoSize, handle, mem);
+}
+
+/**
+ * @brief 使用指定的分配器创建FIFO，句柄与缓冲区只申请一次
+ * @param fifoSize FIFO的大小，单位为字节，实际可用大小尾fifosize-1
+ * @param allocator 分配器，其生命周期必须长于FIFO
+ * @return 返回FIFO句柄
+ */
+RcsFifo_t RcsFifoCreateWithAllocator(size_t fifoSize, const RcsAllocator_t *allocator)
+{
+    if (fifoSize == 0 || allocator == NULL || allocator->alloc == NULL) {
+        return NULL;
+    }
+
+    RcsFifoHandle_t *handle = (RcsFifoHandle_t *)allocator->alloc(allocator->ctx, sizeof(RcsFifoHandle_t) + fifoSize);
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    RcsFifoCreateStatic(fifoSize, handle, (uint8_t *)(handle + 1));
+    handle->allocator = allocator;
+
     return (RcsFifo_t)handle;
 }
 
@@ -102,6 +222,15 @@ void RcsFifoDestroy(RcsFifo_t fifo)
         return;
     }
     RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+#if defined(__linux__)
+    pthread_mutex_destroy(&handle->hostLock);
+#endif
+    if (handle->allocator != NULL) {
+        if (handle->allocator->free != NULL) {
+            handle->allocator->free(handle->allocator->ctx, handle);
+        }
+        return;
+    }
     FifoPortFree(handle->mem);
     FifoPortFree(handle);
 }
@@ -118,17 +247,17 @@ int RcsFifoSendAcquire(RcsFifo_t fifo, size_t size, void *memAcquired[2])
     if (fifo == NULL || memAcquired == NULL || size == 0) {
         return RCS_FIFO_INVALID_PARAM;
     }
-    FifoPortEnterCriticalFromAll();
     RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
 
-    // 不允许其他人同时写入
-    if (handle->indexWriteHead != handle->indexWriteTail) {
-        FifoPortExitCriticalFromAll();
+    // 不允许其他人同时写入，写指针由外部位置源给出时也不允许
+    if (handle->indexWriteHead != handle->indexWriteTail || handle->posSource != NULL) {
+        FifoPortExitCriticalFromAll(handle);
         return RCS_FIFO_NOT_ALLOWED;
     }   
     // 空间不足
     if (size > RCS_FIFO_FREE_SPACE(handle)) {
-        FifoPortExitCriticalFromAll();
+        FifoPortExitCriticalFromAll(handle);
         return RCS_FIFO_NO_SPACE;
     }
     
@@ -159,7 +288,7 @@ int RcsFifoSendAcquire(RcsFifo_t fifo, size_t size, void *memAcquired[2])
 
     handle->indexWriteHead = (head + size) % capacity;
 
-    FifoPortExitCriticalFromAll();
+    FifoPortExitCriticalFromAll(handle);
     return (int)first_chunk;
 }
 
@@ -175,17 +304,17 @@ int RcsFifoSendAcquireNoSplit(RcsFifo_t fifo, size_t size, void *memAcquired[2])
     if (fifo == NULL || memAcquired == NULL || size == 0) {
         return RCS_FIFO_INVALID_PARAM;
     }
-    FifoPortEnterCriticalFromAll();
     RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
 
-    // 不允许其他人同时写入
-    if (handle->indexWriteHead != handle->indexWriteTail) {
-        FifoPortExitCriticalFromAll();
+    // 不允许其他人同时写入，写指针由外部位置源给出时也不允许
+    if (handle->indexWriteHead != handle->indexWriteTail || handle->posSource != NULL) {
+        FifoPortExitCriticalFromAll(handle);
         return RCS_FIFO_NOT_ALLOWED;
     }
     // 空间不足
     if (size > RCS_FIFO_FREE_NOSPLIT_SPACE(handle)) {
-        FifoPortExitCriticalFromAll();
+        FifoPortExitCriticalFromAll(handle);
         return RCS_FIFO_NO_SPACE;
     }
     
@@ -207,7 +336,7 @@ int RcsFifoSendAcquireNoSplit(RcsFifo_t fifo, size_t size, void *memAcquired[2])
             first_chunk = size;
         } 
         else {
-            FifoPortExitCriticalFromAll();
+            FifoPortExitCriticalFromAll(handle);
             return RCS_FIFO_NOT_ALLOWED;
         }
     } 
@@ -217,7 +346,7 @@ int RcsFifoSendAcquireNoSplit(RcsFifo_t fifo, size_t size, void *memAcquired[2])
             first_chunk = size;
         } 
         else {
-            FifoPortExitCriticalFromAll();
+            FifoPortExitCriticalFromAll(handle);
             return RCS_FIFO_NOT_ALLOWED;
         }
     }
@@ -225,7 +354,7 @@ int RcsFifoSendAcquireNoSplit(RcsFifo_t fifo, size_t size, void *memAcquired[2])
     memAcquired[1] = NULL;
     handle->indexWriteHead = (head + size) % capacity;
 
-    FifoPortExitCriticalFromAll();
+    FifoPortExitCriticalFromAll(handle);
     return (int)first_chunk;
 }
 
@@ -240,14 +369,17 @@ int RcsFifoSendComplete(RcsFifo_t fifo, const void *memAcquired[2])
     if (fifo == NULL || memAcquired == NULL || memAcquired[0] == NULL) {
         return RCS_FIFO_INVALID_PARAM;
     }
-    FifoPortEnterCriticalFromAll();
     RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
 
     if (handle->indexWriteTail != handle->indexWriteHead) {
         handle->indexWriteTail = handle->indexWriteHead;
     }
 
-    FifoPortExitCriticalFromAll();
+    void *hookArg = NULL;
+    RcsFifoEventHook_t hook = FifoHookHold(handle, &hookArg);
+    FifoPortExitCriticalFromAll(handle);
+    FifoHookCall(handle, hook, RCS_FIFO_EVENT_SEND_COMPLETE, hookArg);
     return 0;
 }
 
@@ -263,17 +395,21 @@ int RcsFifoRecvAcquire(RcsFifo_t fifo, size_t size, void *memAcquired[2])
     if (fifo == NULL || memAcquired == NULL || size == 0) {
         return RCS_FIFO_INVALID_PARAM;
     }
-    FifoPortEnterCriticalFromAll();
     RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
 
     // 不允许其他人同时读取
     if (handle->indexReadHead != handle->indexReadTail) {
-        FifoPortExitCriticalFromAll();
+        FifoPortExitCriticalFromAll(handle);
         return RCS_FIFO_NOT_ALLOWED;
     }
+    // 外部写入者模式下先取得最新的写位置，没有接收申请时覆盖已在同步中处理
+    if (handle->posSource != NULL) {
+        FifoPosSync(handle);
+    }
     // 空间不足
     if (size > RCS_FIFO_USED_SPACE(handle)) {
-        FifoPortExitCriticalFromAll();
+        FifoPortExitCriticalFromAll(handle);
         return RCS_FIFO_NO_DATA;
     }
     
@@ -302,7 +438,7 @@ int RcsFifoRecvAcquire(RcsFifo_t fifo, size_t size, void *memAcquired[2])
     }
     handle->indexReadHead = (head + size) % capacity;
     
-    FifoPortExitCriticalFromAll();
+    FifoPortExitCriticalFromAll(handle);
     return (int)first_chunk;
 }
 
@@ -318,17 +454,21 @@ int RcsFifoRecvAcquireNoSplit(RcsFifo_t fifo, size_t size, void *memAcquired[2])
     if (fifo == NULL || memAcquired == NULL || size == 0) {
         return RCS_FIFO_INVALID_PARAM;
     }
-    FifoPortEnterCriticalFromAll();
     RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
 
     // 不允许其他人同时读取
     if (handle->indexReadHead != handle->indexReadTail) {
-        FifoPortExitCriticalFromAll();
+        FifoPortExitCriticalFromAll(handle);
         return RCS_FIFO_NOT_ALLOWED;
     }
+    // 外部写入者模式下先取得最新的写位置，没有接收申请时覆盖已在同步中处理
+    if (handle->posSource != NULL) {
+        FifoPosSync(handle);
+    }
     // 空间不足
     if (size > RCS_FIFO_USED_NOSPLIT_SPACE(handle)) {
-        FifoPortExitCriticalFromAll();
+        FifoPortExitCriticalFromAll(handle);
         return RCS_FIFO_NO_DATA;
     }
     
@@ -349,14 +489,16 @@ int RcsFifoRecvAcquireNoSplit(RcsFifo_t fifo, size_t size, void *memAcquired[2])
             first_chunk = size;
         } 
         else {
+            FifoPortExitCriticalFromAll(handle);
             return RCS_FIFO_NOT_ALLOWED;
         }
     } 
     else {
-        if ((tail - head) >= handle->memSize) {
+        if ((tail - head) >= size) {
             memAcquired[0] = &handle->mem[head];
             first_chunk = size;
         } else {
+            FifoPortExitCriticalFromAll(handle);
             return RCS_FIFO_NOT_ALLOWED;
         }
     }
@@ -364,7 +506,7 @@ int RcsFifoRecvAcquireNoSplit(RcsFifo_t fifo, size_t size, void *memAcquired[2])
     memAcquired[1] = NULL;
     handle->indexReadHead = (head + size) % capacity;
     
-    FifoPortExitCriticalFromAll();
+    FifoPortExitCriticalFromAll(handle);
     return (int)first_chunk;
 }
 
@@ -380,13 +522,376 @@ int RcsFifoRecvComplete(RcsFifo_t fifo, const void *memAcquired[2])
         return RCS_FIFO_INVALID_PARAM;
     }
     RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
-    FifoPortEnterCriticalFromAll();
+    FifoPortEnterCriticalFromAll(handle);
     
+    // 接收申请期间数据被覆盖，丢弃全部未读数据
+    if (handle->overrun) {
+        handle->overrun = 0;
+        handle->indexReadHead = handle->indexWriteTail;
+        handle->indexReadTail = handle->indexWriteTail;
+        FifoPortExitCriticalFromAll(handle);
+        return RCS_FIFO_OVERRUN;
+    }
     if (handle->indexReadTail != handle->indexReadHead) {
         handle->indexReadTail = handle->indexReadHead;
     }
     
-    FifoPortExitCriticalFromAll();
+    void *hookArg = NULL;
+    RcsFifoEventHook_t hook = FifoHookHold(handle, &hookArg);
+    FifoPortExitCriticalFromAll(handle);
+    FifoHookCall(handle, hook, RCS_FIFO_EVENT_RECV_COMPLETE, hookArg);
     return 0;
 }
 
+/**
+ * @brief 向FIFO声明只完成了申请区域中的前size字节，其余部分归还给FIFO
+ * @param fifo FIFO句柄
+ * @param memAcquired 申请时返回的内存指针
+ * @param size 实际写入的数据大小，0表示放弃本次申请
+ * @return 返回错误码，没有进行中的发送申请时返回RCS_FIFO_NOT_ALLOWED
+ */
+int RcsFifoSendCompletePartial(RcsFifo_t fifo, const void *memAcquired[2], size_t size)
+{
+    if (fifo == NULL || memAcquired == NULL || memAcquired[0] == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
+
+    // 没有进行中的申请时memAcquired[0]已失效，无法得出申请区域
+    if (handle->indexWriteHead == handle->indexWriteTail) {
+        FifoPortExitCriticalFromAll(handle);
+        return RCS_FIFO_NOT_ALLOWED;
+    }
+
+    // 申请的起点可能因不拆分申请而回绕到0，因此从memAcquired[0]反推
+    size_t start = (size_t)((const uint8_t *)memAcquired[0] - handle->mem);
+    size_t reserved = (handle->indexWriteHead + handle->memSize - start) % handle->memSize;
+    if (start >= handle->memSize || size > reserved) {
+        FifoPortExitCriticalFromAll(handle);
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    if (size == 0) {
+        handle->indexWriteHead = handle->indexWriteTail;
+    }
+    else {
+        handle->indexWriteHead = (start + size) % handle->memSize;
+        handle->indexWriteTail = handle->indexWriteHead;
+    }
+
+    void *hookArg = NULL;
+    RcsFifoEventHook_t hook = (size != 0) ? FifoHookHold(handle, &hookArg) : NULL;
+    FifoPortExitCriticalFromAll(handle);
+    FifoHookCall(handle, hook, RCS_FIFO_EVENT_SEND_COMPLETE, hookArg);
+    return RCS_FIFO_OK;
+}
+
+/**
+ * @brief 向FIFO声明只消费了申请区域中的前size字节，其余数据留待下次接收
+ * @param fifo FIFO句柄
+ * @param memAcquired 申请时返回的内存指针
+ * @param size 实际消费的数据大小，0表示放弃本次申请
+ * @return 返回错误码，没有进行中的接收申请时返回RCS_FIFO_NOT_ALLOWED
+ */
+int RcsFifoRecvCompletePartial(RcsFifo_t fifo, const void *memAcquired[2], size_t size)
+{
+    if (fifo == NULL || memAcquired == NULL || memAcquired[0] == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
+
+    if (handle->overrun) {
+        handle->overrun = 0;
+        handle->indexReadHead = handle->indexWriteTail;
+        handle->indexReadTail = handle->indexWriteTail;
+        FifoPortExitCriticalFromAll(handle);
+        return RCS_FIFO_OVERRUN;
+    }
+    if (handle->indexReadHead == handle->indexReadTail) {
+        FifoPortExitCriticalFromAll(handle);
+        return RCS_FIFO_NOT_ALLOWED;
+    }
+
+    size_t start = (size_t)((const uint8_t *)memAcquired[0] - handle->mem);
+    size_t reserved = (handle->indexReadHead + handle->memSize - start) % handle->memSize;
+    if (start >= handle->memSize || size > reserved) {
+        FifoPortExitCriticalFromAll(handle);
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    if (size == 0) {
+        handle->indexReadHead = handle->indexReadTail;
+    }
+    else {
+        handle->indexReadHead = (start + size) % handle->memSize;
+        handle->indexReadTail = handle->indexReadHead;
+    }
+
+    void *hookArg = NULL;
+    RcsFifoEventHook_t hook = (size != 0) ? FifoHookHold(handle, &hookArg) : NULL;
+    FifoPortExitCriticalFromAll(handle);
+    FifoHookCall(handle, hook, RCS_FIFO_EVENT_RECV_COMPLETE, hookArg);
+    return RCS_FIFO_OK;
+}
+
+/**
+ * @brief 注册FIFO的事件钩子，每个FIFO同时只能注册一个
+ * @param fifo FIFO句柄
+ * @param hook 事件钩子，传入NULL表示无条件注销，注销时等待进行中的钩子调用返回
+ * @param arg 传递给钩子的参数
+ * @return 返回错误码，已注册了其他钩子时返回RCS_FIFO_NOT_ALLOWED
+ */
+int RcsFifoSetEventHook(RcsFifo_t fifo, RcsFifoEventHook_t hook, void *arg)
+{
+    if (fifo == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
+
+    if (hook != NULL && handle->eventHook != NULL &&
+        (handle->eventHook != hook || handle->eventArg != arg)) {
+        FifoPortExitCriticalFromAll(handle);
+        return RCS_FIFO_NOT_ALLOWED;
+    }
+    handle->eventHook = hook;
+    handle->eventArg = arg;
+
+    FifoPortExitCriticalFromAll(handle);
+    if (hook == NULL) {
+        FifoHookWaitIdle(handle);
+    }
+    return RCS_FIFO_OK;
+}
+
+/**
+ * @brief 注销自己注册的事件钩子
+ * @param fifo FIFO句柄
+ * @param hook 注册时的事件钩子
+ * @param arg 注册时的参数
+ * @return 返回错误码，当前钩子不是hook与arg时不做修改并返回RCS_FIFO_NOT_ALLOWED
+ * @note 返回时其他线程中进行中的钩子调用都已返回，arg可以立即释放；不得在钩子内部调用
+ */
+int RcsFifoClearEventHook(RcsFifo_t fifo, RcsFifoEventHook_t hook, void *arg)
+{
+    if (fifo == NULL || hook == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
+
+    if (handle->eventHook != hook || handle->eventArg != arg) {
+        FifoPortExitCriticalFromAll(handle);
+        return RCS_FIFO_NOT_ALLOWED;
+    }
+    handle->eventHook = NULL;
+    handle->eventArg = NULL;
+
+    FifoPortExitCriticalFromAll(handle);
+    FifoHookWaitIdle(handle);
+    return RCS_FIFO_OK;
+}
+
+
+/**
+ * @brief 设置外部位置源，此后写指针只由位置源推进，接收方可直接在DMA环形缓冲区上原地读取
+ * @param fifo FIFO句柄，其缓冲区即DMA的目标缓冲区，大小与DMA传输长度相同
+ * @param source 位置源，传入NULL表示恢复为普通的发送接口
+ * @param arg 传递给位置源的参数
+ * @return 返回错误码
+ * @note 设置时FIFO被清空，读写指针都对齐到位置源的当前位置
+ */
+int RcsFifoSetPosSource(RcsFifo_t fifo, RcsFifoPosSource_t source, void *arg)
+{
+    if (fifo == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
+
+    if (handle->indexWriteHead != handle->indexWriteTail || handle->indexReadHead != handle->indexReadTail) {
+        FifoPortExitCriticalFromAll(handle);
+        return RCS_FIFO_NOT_ALLOWED;
+    }
+    size_t pos = (source != NULL) ? source(arg) % handle->memSize : 0;
+    handle->posSource = source;
+    handle->posArg = arg;
+    handle->indexWriteHead = pos;
+    handle->indexWriteTail = pos;
+    handle->indexReadHead = pos;
+    handle->indexReadTail = pos;
+    handle->overrun = 0;
+
+    FifoPortExitCriticalFromAll(handle);
+    return RCS_FIFO_OK;
+}
+
+/**
+ * @brief 从位置源同步写指针，在DMA半满、全满与串口空闲中断中调用
+ * @param fifo FIFO句柄
+ * @return 返回新到达的字节数，未读数据被覆盖时返回RCS_FIFO_OVERRUN
+ * @note 有新数据时触发RCS_FIFO_EVENT_SEND_COMPLETE事件
+ */
+int RcsFifoPosUpdate(RcsFifo_t fifo)
+{
+    if (fifo == NULL || ((RcsFifoHandle_t *)fifo)->posSource == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
+
+    int ret = FifoPosSync(handle);
+
+    void *hookArg = NULL;
+    RcsFifoEventHook_t hook = (ret != 0) ? FifoHookHold(handle, &hookArg) : NULL;
+    FifoPortExitCriticalFromAll(handle);
+    FifoHookCall(handle, hook, RCS_FIFO_EVENT_SEND_COMPLETE, hookArg);
+    return ret;
+}
+
+/**
+ * @brief 获取外部写入者覆盖未读数据的累计次数
+ * @param fifo FIFO句柄
+ * @return 返回覆盖次数
+ */
+uint32_t RcsFifoGetOverrunCount(RcsFifo_t fifo)
+{
+    if (fifo == NULL) {
+        return 0;
+    }
+    return ((RcsFifoHandle_t *)fifo)->overrunCount;
+}
+
+/**
+ * @brief 获取FIFO中已完成发送、可供接收的数据量
+ * @param fifo FIFO句柄
+ * @return 返回可接收的数据大小，句柄无效时返回0
+ */
+size_t RcsFifoGetUsed(RcsFifo_t fifo)
+{
+    if (fifo == NULL) {
+        return 0;
+    }
+    RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
+
+    if (handle->posSource != NULL) {
+        FifoPosSync(handle);
+    }
+    size_t used = RCS_FIFO_USED_SPACE(handle);
+
+    FifoPortExitCriticalFromAll(handle);
+    return used;
+}
+
+/**
+ * @brief 获取FIFO中已完成接收、可供发送的空间
+ * @param fifo FIFO句柄
+ * @return 返回可发送的空间大小，句柄无效时返回0
+ */
+size_t RcsFifoGetFree(RcsFifo_t fifo)
+{
+    if (fifo == NULL) {
+        return 0;
+    }
+    RcsFifoHandle_t *handle = (RcsFifoHandle_t *)fifo;
+    FifoPortEnterCriticalFromAll(handle);
+
+    if (handle->posSource != NULL) {
+        FifoPosSync(handle);
+    }
+    size_t freeSpace = RCS_FIFO_FREE_SPACE(handle);
+
+    FifoPortExitCriticalFromAll(handle);
+    return freeSpace;
+}
+
+/**
+ * @brief 由申请结果构造只读视图
+ * @param view 返回的视图
+ * @param memAcquired 申请时返回的内存指针
+ * @param firstSize 申请函数的返回值，即第一段的长度
+ * @param size 申请的总大小
+ * @return 返回错误码
+ */
+int RcsFifoViewInit(RcsFifoView_t *view, void *memAcquired[2], size_t firstSize, size_t size)
+{
+    if (view == NULL || memAcquired == NULL || firstSize > size) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    if (firstSize < size && memAcquired[1] == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    view->seg[0] = (const uint8_t *)memAcquired[0];
+    view->len[0] = firstSize;
+    view->seg[1] = (firstSize < size) ? (const uint8_t *)memAcquired[1] : NULL;
+    view->len[1] = size - firstSize;
+    return RCS_FIFO_OK;
+}
+
+/**
+ * @brief 截取视图中的一段，不拷贝数据
+ * @param view 原视图
+ * @param offset 起始偏移
+ * @param size 长度
+ * @param slice 返回的子视图，可能仍跨两段
+ * @return 返回错误码
+ */
+int RcsFifoViewSlice(const RcsFifoView_t *view, size_t offset, size_t size, RcsFifoView_t *slice)
+{
+    if (view == NULL || slice == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    size_t total = view->len[0] + view->len[1];
+    if (offset > total || size > total - offset) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    if (offset >= view->len[0]) {
+        slice->seg[0] = view->seg[1] + (offset - view->len[0]);
+        slice->len[0] = size;
+        slice->seg[1] = NULL;
+        slice->len[1] = 0;
+    }
+    else {
+        size_t first = view->len[0] - offset;
+        slice->seg[0] = view->seg[0] + offset;
+        slice->len[0] = (size < first) ? size : first;
+        slice->seg[1] = (size > first) ? view->seg[1] : NULL;
+        slice->len[1] = size - slice->len[0];
+    }
+    return RCS_FIFO_OK;
+}
+
+/**
+ * @brief 从视图拷出数据到线性缓冲区
+ * @param view 视图
+ * @param offset 起始偏移
+ * @param dst 目标缓冲区
+ * @param size 期望拷贝的长度
+ * @return 返回实际拷贝的长度
+ */
+size_t RcsFifoViewCopy(const RcsFifoView_t *view, size_t offset, void *dst, size_t size)
+{
+    RcsFifoView_t slice;
+    if (view == NULL || dst == NULL) {
+        return 0;
+    }
+    size_t total = view->len[0] + view->len[1];
+    if (offset > total) {
+        return 0;
+    }
+    if (size > total - offset) {
+        size = total - offset;
+    }
+
+    RcsFifoViewSlice(view, offset, size, &slice);
+    memcpy(dst, slice.seg[0], slice.len[0]);
+    if (slice.len[1] != 0) {
+        memcpy((uint8_t *)dst + slice.len[0], slice.seg[1], slice.len[1]);
+    }
+    return size;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file siso_fifo_dma.c
+ * @brief 将FIFO的接收申请区域导出为链式DMA描述符，回绕的数据作为一次链式传输发出，传输完成中断中完成接收并启动下一次
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "siso_fifo_dma.h"
+
+/**
+ * @brief 由申请结果构造描述符链，数据回绕时为两个节点
+ * @param memAcquired 申请时返回的内存指针
+ * @param firstSize 申请函数的返回值，即第一段的长度
+ * @param size 申请的总大小
+ * @param desc 描述符存储，至少2个
+ * @return 返回描述符个数
+ */
+int RcsFifoDmaDescBuild(void *memAcquired[2], size_t firstSize, size_t size, RcsDmaDesc_t desc[2])
+{
+    if (memAcquired == NULL || desc == NULL || memAcquired[0] == NULL || firstSize == 0 || firstSize > size) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    desc[0].addr = memAcquired[0];
+    desc[0].len = firstSize;
+    desc[0].next = NULL;
+    if (firstSize == size) {
+        return 1;
+    }
+    if (memAcquired[1] == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    desc[1].addr = memAcquired[1];
+    desc[1].len = size - firstSize;
+    desc[1].next = NULL;
+    desc[0].next = &desc[1];
+    return 2;
+}
+
+/**
+ * @brief 初始化DMA发送通道
+ * @param tx 发送通道
+ * @param fifo 发送FIFO
+ * @param start 适配层的启动函数
+ * @param arg 传递给启动函数的参数
+ * @param maxTransfer 单次传输的最大字节数，0表示不限制
+ * @return 返回错误码
+ */
+int RcsFifoDmaTxInit(RcsFifoDmaTx_t *tx, RcsFifo_t fifo, RcsDmaStart_t start, void *arg, size_t maxTransfer)
+{
+    if (tx == NULL || fifo == NULL || start == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    memset(tx, 0, sizeof(RcsFifoDmaTx_t));
+    tx->fifo = fifo;
+    tx->start = start;
+    tx->arg = arg;
+    tx->maxTransfer = maxTransfer;
+    return RCS_FIFO_OK;
+}
+
+/**
+ * @brief 若DMA空闲且FIFO中有数据，申请全部数据并作为一条描述符链启动传输
+ * @param tx 发送通道
+ * @return 返回本次启动的字节数，传输进行中或没有数据时返回0
+ * @note 写入FIFO后在任务中调用；传输完成后由RcsFifoDmaTxComplete自动续传
+ */
+int RcsFifoDmaTxKick(RcsFifoDmaTx_t *tx)
+{
+    if (tx == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    size_t size = RcsFifoGetUsed(tx->fifo);
+    if (size == 0) {
+        return 0;
+    }
+    if (tx->maxTransfer != 0 && size > tx->maxTransfer) {
+        size = tx->maxTransfer;
+    }
+
+    void *memAcquired[2] = {NULL, NULL};
+    int first = RcsFifoRecvAcquire(tx->fifo, size, memAcquired);
+    if (first < 0) {
+        // 上一次传输的申请尚未完成
+        return (first == RCS_FIFO_NOT_ALLOWED || first == RCS_FIFO_NO_DATA) ? 0 : first;
+    }
+
+    tx->memAcquired[0] = memAcquired[0];
+    tx->memAcquired[1] = memAcquired[1];
+    tx->size = size;
+    RcsFifoDmaDescBuild(tx->memAcquired, (size_t)first, size, tx->desc);
+
+    if (tx->start(&tx->desc[0], tx->arg) != RCS_FIFO_OK) {
+        RcsFifoRecvCompletePartial(tx->fifo, (const void **)tx->memAcquired, 0);
+        return RCS_FIFO_ERROR;
+    }
+    tx->transferCount++;
+    return (int)size;
+}
+
+/**
+ * @brief 在DMA传输完成中断中调用，完成接收以释放空间，并立即启动剩余数据的传输
+ * @param tx 发送通道
+ * @return 返回续传的字节数，没有剩余数据时返回0
+ */
+int RcsFifoDmaTxComplete(RcsFifoDmaTx_t *tx)
+{
+    if (tx == NULL || tx->size == 0) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    tx->size = 0;
+    RcsFifoRecvComplete(tx->fifo, (const void **)tx->memAcquired);
+    return RcsFifoDmaTxKick(tx);
+}
@@ -0,0 +1,160 @@
+/**
+ * @file siso_fifo_eventfd.c
+ * @brief 将FIFO的就绪状态映射到eventfd，以便与其他文件描述符一同用epoll等待（Linux主机端）
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#if defined(__linux__)
+
+#include <stdint.h>
+#include <stddef.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include "siso_fifo_eventfd.h"
+
+static void EventFdSignal(int fd)
+{
+    uint64_t one = 1;
+    ssize_t ret = write(fd, &one, sizeof(one));
+    (void)ret;
+}
+
+static void EventFdDrain(int fd)
+{
+    uint64_t count;
+    ssize_t ret = read(fd, &count, sizeof(count));
+    (void)ret;
+}
+
+/**
+ * @brief 只有在对方已确认需要等待、且条件已满足时，才摘除标志并写一次eventfd
+ */
+static void EventFdTrySignal(uint32_t *armed, int fd)
+{
+    if (__atomic_exchange_n(armed, 0, __ATOMIC_SEQ_CST) != 0) {
+        EventFdSignal(fd);
+    }
+}
+
+static void EventFdHook(RcsFifo_t fifo, int event, void *arg)
+{
+    RcsFifoEventFd_t *notifier = (RcsFifoEventFd_t *)arg;
+
+    if (event == RCS_FIFO_EVENT_SEND_COMPLETE) {
+        if (__atomic_load_n(&notifier->recvArmed, __ATOMIC_SEQ_CST) != 0 &&
+            RcsFifoGetUsed(fifo) >= notifier->recvNeed) {
+            EventFdTrySignal(&notifier->recvArmed, notifier->recvFd);
+        }
+    }
+    else {
+        if (__atomic_load_n(&notifier->sendArmed, __ATOMIC_SEQ_CST) != 0 &&
+            RcsFifoGetFree(fifo) >= notifier->sendNeed) {
+            EventFdTrySignal(&notifier->sendArmed, notifier->sendFd);
+        }
+    }
+}
+
+/**
+ * @brief 创建一对非阻塞eventfd，并挂接到FIFO的事件钩子上
+ * @param notifier 通知器
+ * @param fifo FIFO句柄
+ * @return 返回错误码
+ * @note 初始时接收方已布防，FIFO非空则recvFd立即可读
+ */
+int RcsFifoEventFdInit(RcsFifoEventFd_t *notifier, RcsFifo_t fifo)
+{
+    if (notifier == NULL || fifo == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    notifier->fifo = NULL;
+    notifier->recvFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (notifier->recvFd < 0) {
+        return RCS_FIFO_ERROR;
+    }
+    notifier->sendFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (notifier->sendFd < 0) {
+        close(notifier->recvFd);
+        return RCS_FIFO_ERROR;
+    }
+
+    notifier->fifo = fifo;
+    notifier->recvArmed = 0;
+    notifier->sendArmed = 0;
+    notifier->recvNeed = 1;
+    notifier->sendNeed = 1;
+
+    int ret = RcsFifoSetEventHook(fifo, EventFdHook, notifier);
+    if (ret != RCS_FIFO_OK) {
+        close(notifier->recvFd);
+        close(notifier->sendFd);
+        notifier->fifo = NULL;
+        return ret;
+    }
+    return RcsFifoEventFdRearmRecv(notifier, 1);
+}
+
+/**
+ * @brief 解除挂接并关闭eventfd
+ * @param notifier 通知器
+ */
+void RcsFifoEventFdDeinit(RcsFifoEventFd_t *notifier)
+{
+    if (notifier == NULL || notifier->fifo == NULL) {
+        return;
+    }
+    RcsFifoClearEventHook(notifier->fifo, EventFdHook, notifier);
+    close(notifier->recvFd);
+    close(notifier->sendFd);
+    notifier->fifo = NULL;
+}
+
+/**
+ * @brief 接收方在FIFO数据不足时调用，清除recvFd并等待下一次由空到非空的转变
+ * @param notifier 通知器
+ * @param size 需要等待的数据量
+ * @return 返回错误码
+ * @note 若布防期间数据已经到达，recvFd会被立即置为可读，不会丢失通知
+ */
+int RcsFifoEventFdRearmRecv(RcsFifoEventFd_t *notifier, size_t size)
+{
+    if (notifier == NULL || notifier->fifo == NULL || size == 0) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    EventFdDrain(notifier->recvFd);
+    notifier->recvNeed = size;
+    __atomic_store_n(&notifier->recvArmed, 1, __ATOMIC_SEQ_CST);
+
+    if (RcsFifoGetUsed(notifier->fifo) >= size) {
+        EventFdTrySignal(&notifier->recvArmed, notifier->recvFd);
+    }
+    return RCS_FIFO_OK;
+}
+
+/**
+ * @brief 发送方在FIFO空间不足时调用，清除sendFd并等待下一次由满到不满的转变
+ * @param notifier 通知器
+ * @param size 需要等待的空间大小
+ * @return 返回错误码
+ */
+int RcsFifoEventFdRearmSend(RcsFifoEventFd_t *notifier, size_t size)
+{
+    if (notifier == NULL || notifier->fifo == NULL || size == 0) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    EventFdDrain(notifier->sendFd);
+    notifier->sendNeed = size;
+    __atomic_store_n(&notifier->sendArmed, 1, __ATOMIC_SEQ_CST);
+
+    if (RcsFifoGetFree(notifier->fifo) >= size) {
+        EventFdTrySignal(&notifier->sendArmed, notifier->sendFd);
+    }
+    return RCS_FIFO_OK;
+}
+
+#endif /* __linux__ */
@@ -0,0 +1,202 @@
+/**
+ * @file siso_fifo_wait.c
+ * @brief 为FIFO提供先自旋、后休眠的阻塞式申请（Linux主机端，基于futex）
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#if defined(__linux__)
+
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "siso_fifo_wait.h"
+
+#define RCS_FIFO_WAIT_RECV 0x01u
+#define RCS_FIFO_WAIT_SEND 0x02u
+
+typedef int (*RcsFifoAcquireFunc_t)(RcsFifo_t fifo, size_t size, void *memAcquired[2]);
+
+static void FutexWake(uint32_t *word)
+{
+    syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+static void FutexWait(uint32_t *word, uint32_t expected, const struct timespec *timeout)
+{
+    syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, expected, timeout, NULL, 0);
+}
+
+static int64_t MonotonicNowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * @brief FIFO事件钩子：递增对应的序号，仅当有等待者时才发起系统调用
+ */
+static void WaiterEventHook(RcsFifo_t fifo, int event, void *arg)
+{
+    (void)fifo;
+    RcsFifoWaiter_t *waiter = (RcsFifoWaiter_t *)arg;
+    uint32_t *seq = NULL;
+    uint32_t flag = 0;
+
+    if (event == RCS_FIFO_EVENT_SEND_COMPLETE) {
+        seq = &waiter->dataSeq;
+        flag = RCS_FIFO_WAIT_RECV;
+    }
+    else {
+        seq = &waiter->spaceSeq;
+        flag = RCS_FIFO_WAIT_SEND;
+    }
+
+    // 先发布序号再检查标志，与等待方“先置标志再读序号”配对，保证不丢唤醒
+    __atomic_fetch_add(seq, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&waiter->waitFlags, __ATOMIC_SEQ_CST) & flag) {
+        FutexWake(seq);
+    }
+}
+
+/**
+ * @brief 自旋-休眠的通用等待流程
+ * @param noResource 申请函数在资源不足时返回的错误码
+ */
+static int AcquireWait(RcsFifoWaiter_t *waiter, RcsFifoAcquireFunc_t acquire, int noResource,
+                       uint32_t *seq, uint32_t flag, size_t size, void *memAcquired[2], int32_t timeoutMs)
+{
+    int64_t deadline = 0;
+    if (timeoutMs >= 0) {
+        deadline = MonotonicNowNs() + (int64_t)timeoutMs * 1000000;
+    }
+
+    // 阶段一：自旋，流量持续时不进入内核
+    for (uint32_t spin = 0; ; spin++) {
+        int ret = acquire(waiter->fifo, size, memAcquired);
+        if (ret != noResource) {
+            return ret;
+        }
+        if (spin >= waiter->spinCount) {
+            break;
+        }
+        FifoPortCpuRelax();
+    }
+
+    // 阶段二：在序号上休眠，直到对方完成操作
+    for (;;) {
+        __atomic_fetch_or(&waiter->waitFlags, flag, __ATOMIC_SEQ_CST);
+        uint32_t expected = __atomic_load_n(seq, __ATOMIC_SEQ_CST);
+
+        int ret = acquire(waiter->fifo, size, memAcquired);
+        if (ret != noResource) {
+            __atomic_fetch_and(&waiter->waitFlags, ~flag, __ATOMIC_SEQ_CST);
+            return ret;
+        }
+
+        if (timeoutMs < 0) {
+            FutexWait(seq, expected, NULL);
+        }
+        else {
+            int64_t remain = deadline - MonotonicNowNs();
+            if (remain <= 0) {
+                __atomic_fetch_and(&waiter->waitFlags, ~flag, __ATOMIC_SEQ_CST);
+                return RCS_FIFO_TIMEOUT;
+            }
+            struct timespec ts;
+            ts.tv_sec = (time_t)(remain / 1000000000);
+            ts.tv_nsec = (long)(remain % 1000000000);
+            FutexWait(seq, expected, &ts);
+        }
+    }
+}
+
+/**
+ * @brief 初始化等待器，并将其挂接到FIFO的事件钩子上
+ * @param waiter 等待器
+ * @param fifo FIFO句柄
+ * @param spinCount 休眠前的自旋次数，0表示直接休眠
+ * @return 返回错误码，FIFO已挂接了其他钩子时返回RCS_FIFO_NOT_ALLOWED
+ */
+int RcsFifoWaiterInit(RcsFifoWaiter_t *waiter, RcsFifo_t fifo, uint32_t spinCount)
+{
+    if (waiter == NULL || fifo == NULL) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+
+    waiter->fifo = fifo;
+    waiter->dataSeq = 0;
+    waiter->spaceSeq = 0;
+    waiter->waitFlags = 0;
+    waiter->spinCount = spinCount;
+
+    int ret = RcsFifoSetEventHook(fifo, WaiterEventHook, waiter);
+    if (ret != RCS_FIFO_OK) {
+        waiter->fifo = NULL;
+    }
+    return ret;
+}
+
+/**
+ * @brief 解除等待器与FIFO的挂接，返回时其他线程不会再进入该等待器的钩子，等待器可以释放
+ * @param waiter 等待器
+ * @warning 调用时不得有线程阻塞在该等待器上
+ */
+void RcsFifoWaiterDeinit(RcsFifoWaiter_t *waiter)
+{
+    if (waiter == NULL || waiter->fifo == NULL) {
+        return;
+    }
+    RcsFifoClearEventHook(waiter->fifo, WaiterEventHook, waiter);
+    waiter->fifo = NULL;
+}
+
+/**
+ * @brief 向FIFO申请发送数据，空间不足时先自旋、后休眠等待
+ * @param waiter 等待器
+ * @param size 需要发送的数据大小，必须小于FIFO大小
+ * @param memAcquired 返回的内存指针
+ * @param timeoutMs 超时时间，RCS_FIFO_WAIT_FOREVER表示一直等待
+ * @return 返回第一段的数据大小，超时返回RCS_FIFO_TIMEOUT
+ */
+int RcsFifoSendAcquireWait(RcsFifoWaiter_t *waiter, size_t size, void *memAcquired[2], int32_t timeoutMs)
+{
+    if (waiter == NULL || waiter->fifo == NULL || memAcquired == NULL || size == 0) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    // 永远无法满足的请求不允许休眠
+    if (size >= ((RcsFifoHandle_t *)waiter->fifo)->memSize) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    return AcquireWait(waiter, RcsFifoSendAcquire, RCS_FIFO_NO_SPACE,
+                       &waiter->spaceSeq, RCS_FIFO_WAIT_SEND, size, memAcquired, timeoutMs);
+}
+
+/**
+ * @brief 向FIFO申请接收数据，数据不足时先自旋、后休眠等待
+ * @param waiter 等待器
+ * @param size 需要接收的数据大小，必须小于FIFO大小
+ * @param memAcquired 返回的内存指针
+ * @param timeoutMs 超时时间，RCS_FIFO_WAIT_FOREVER表示一直等待
+ * @return 返回第一段的数据大小，超时返回RCS_FIFO_TIMEOUT
+ */
+int RcsFifoRecvAcquireWait(RcsFifoWaiter_t *waiter, size_t size, void *memAcquired[2], int32_t timeoutMs)
+{
+    if (waiter == NULL || waiter->fifo == NULL || memAcquired == NULL || size == 0) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    if (size >= ((RcsFifoHandle_t *)waiter->fifo)->memSize) {
+        return RCS_FIFO_INVALID_PARAM;
+    }
+    return AcquireWait(waiter, RcsFifoRecvAcquire, RCS_FIFO_NO_DATA,
+                       &waiter->dataSeq, RCS_FIFO_WAIT_RECV, size, memAcquired, timeoutMs);
+}
+
+#endif /* __linux__ */
@@ -0,0 +1,271 @@
+/**
+ * @file slot_map.c
+ * @brief 带版本号句柄的槽表，对象紧密存放便于遍历，删除后旧句柄自动失效，避免悬空指针
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "slot_map.h"
+
+static inline RcsSlotHandle_t MakeHandle(uint16_t generation, uint16_t index)
+{
+    return ((RcsSlotHandle_t)generation << 16) | index;
+}
+
+static inline uint16_t NextGeneration(uint16_t generation)
+{
+    // 跳过0，保证RCS_SLOTMAP_INVALID_HANDLE永不出现
+    return (generation == 0xFFFFu) ? 1 : (uint16_t)(generation + 1);
+}
+
+/**
+ * @brief 将全部槽按下标顺序串成空闲链表
+ */
+static void ResetFreeList(RcsSlotMapHandle_t *handle)
+{
+    for (uint16_t i = 0; i < handle->capacity; i++) {
+        handle->slots[i].denseIndex = (i + 1 < handle->capacity) ? (uint16_t)(i + 1) : RCS_SLOTMAP_NIL;
+    }
+    handle->freeHead = 0;
+    handle->count = 0;
+}
+
+/**
+ * @brief 查找句柄对应的槽，版本号不符或下标越界时返回NULL
+ */
+static RcsSlotMapSlot_t *FindSlot(RcsSlotMapHandle_t *handle, RcsSlotHandle_t slotHandle)
+{
+    uint16_t index = RCS_SLOTMAP_HANDLE_INDEX(slotHandle);
+    if (index >= handle->capacity) {
+        return NULL;
+    }
+    RcsSlotMapSlot_t *slot = &handle->slots[index];
+    if (slot->generation != RCS_SLOTMAP_HANDLE_GENERATION(slotHandle)) {
+        return NULL;
+    }
+    // 空闲槽的denseIndex存的是链表下一项，需反查确认该槽确实被占用
+    if (slot->denseIndex >= handle->count || handle->denseToSlot[slot->denseIndex] != index) {
+        return NULL;
+    }
+    return slot;
+}
+
+/**
+ * @brief 使用静态申请的方式创建槽表
+ * @param elemSize 对象大小，会按指针向上对齐
+ * @param capacity 最大对象数，不超过RCS_SLOTMAP_MAX_CAPACITY
+ * @param staticHandle 静态的槽表句柄
+ * @param mapMemory 静态内存，大小至少为RCS_SLOTMAP_MEM_SIZE(elemSize, capacity)，按指针对齐
+ * @return 返回槽表句柄
+ */
+RcsSlotMap_t RcsSlotMapCreateStatic(size_t elemSize, size_t capacity, RcsSlotMapHandle_t *staticHandle, uint8_t *mapMemory)
+{
+    if (staticHandle == NULL || mapMemory == NULL || elemSize == 0 ||
+        capacity == 0 || capacity > RCS_SLOTMAP_MAX_CAPACITY) {
+        return NULL;
+    }
+    if (((uintptr_t)mapMemory & (RCS_SLOTMAP_ALIGN - 1)) != 0) {
+        return NULL;
+    }
+
+    staticHandle->elemSize = RCS_SLOTMAP_ELEM_SIZE(elemSize);
+    staticHandle->capacity = (uint16_t)capacity;
+    staticHandle->dense = mapMemory;
+    staticHandle->slots = (RcsSlotMapSlot_t *)(mapMemory + staticHandle->elemSize * capacity);
+    staticHandle->denseToSlot = (uint16_t *)(staticHandle->slots + capacity);
+
+    for (size_t i = 0; i < capacity; i++) {
+        staticHandle->slots[i].generation = 1;
+    }
+    ResetFreeList(staticHandle);
+
+    return (RcsSlotMap_t)staticHandle;
+}
+
+/**
+ * @brief 使用动态申请的方式创建槽表
+ * @param elemSize 对象大小
+ * @param capacity 最大对象数
+ * @return 返回槽表句柄
+ */
+RcsSlotMap_t RcsSlotMapCreate(size_t elemSize, size_t capacity)
+{
+    if (elemSize == 0 || capacity == 0 || capacity > RCS_SLOTMAP_MAX_CAPACITY) {
+        return NULL;
+    }
+
+    RcsSlotMapHandle_t *handle = (RcsSlotMapHandle_t *)SlotMapPortMalloc(sizeof(RcsSlotMapHandle_t));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    uint8_t *mem = (uint8_t *)SlotMapPortMalloc(RCS_SLOTMAP_MEM_SIZE(elemSize, capacity));
+    if (mem == NULL) {
+        SlotMapPortFree(handle);
+        return NULL;
+    }
+
+    return RcsSlotMapCreateStatic(elemSize, capacity, handle, mem);
+}
+
+/**
+ * @brief 销毁槽表
+ * @param map 槽表句柄
+ * @warning 请勿传入静态槽表句柄
+ */
+void RcsSlotMapDestroy(RcsSlotMap_t map)
+{
+    if (map == NULL) {
+        return;
+    }
+    RcsSlotMapHandle_t *handle = (RcsSlotMapHandle_t *)map;
+    SlotMapPortFree(handle->dense);
+    SlotMapPortFree(handle);
+}
+
+/**
+ * @brief 插入一个对象，由调用者填写返回的存储区
+ * @param map 槽表句柄
+ * @param handle 返回新对象的句柄
+ * @return 返回对象存储区（未初始化），槽表已满时返回NULL
+ */
+void *RcsSlotMapInsert(RcsSlotMap_t map, RcsSlotHandle_t *handle)
+{
+    if (map == NULL || handle == NULL) {
+        return NULL;
+    }
+    RcsSlotMapHandle_t *mapHandle = (RcsSlotMapHandle_t *)map;
+
+    uint16_t index = mapHandle->freeHead;
+    if (index == RCS_SLOTMAP_NIL) {
+        return NULL;
+    }
+    RcsSlotMapSlot_t *slot = &mapHandle->slots[index];
+    mapHandle->freeHead = slot->denseIndex;
+
+    uint16_t denseIndex = mapHandle->count++;
+    slot->denseIndex = denseIndex;
+    mapHandle->denseToSlot[denseIndex] = index;
+
+    *handle = MakeHandle(slot->generation, index);
+    return &mapHandle->dense[(size_t)denseIndex * mapHandle->elemSize];
+}
+
+/**
+ * @brief 删除对象，末尾对象被搬到空洞处以保持紧密；该句柄此后查找均失败
+ * @param map 槽表句柄
+ * @param handle 对象句柄
+ * @return 返回错误码，句柄已失效时返回RCS_SLOTMAP_STALE
+ */
+int RcsSlotMapRemove(RcsSlotMap_t map, RcsSlotHandle_t handle)
+{
+    if (map == NULL) {
+        return RCS_SLOTMAP_INVALID_PARAM;
+    }
+    RcsSlotMapHandle_t *mapHandle = (RcsSlotMapHandle_t *)map;
+
+    RcsSlotMapSlot_t *slot = FindSlot(mapHandle, handle);
+    if (slot == NULL) {
+        return RCS_SLOTMAP_STALE;
+    }
+
+    uint16_t hole = slot->denseIndex;
+    uint16_t last = --mapHandle->count;
+    if (hole != last) {
+        memcpy(&mapHandle->dense[(size_t)hole * mapHandle->elemSize],
+               &mapHandle->dense[(size_t)last * mapHandle->elemSize], mapHandle->elemSize);
+        uint16_t movedSlot = mapHandle->denseToSlot[last];
+        mapHandle->denseToSlot[hole] = movedSlot;
+        mapHandle->slots[movedSlot].denseIndex = hole;
+    }
+
+    slot->generation = NextGeneration(slot->generation);
+    slot->denseIndex = mapHandle->freeHead;
+    mapHandle->freeHead = RCS_SLOTMAP_HANDLE_INDEX(handle);
+    return RCS_SLOTMAP_OK;
+}
+
+/**
+ * @brief 按句柄查找对象
+ * @param map 槽表句柄
+ * @param handle 对象句柄
+ * @return 返回对象地址，句柄已失效时返回NULL
+ */
+void *RcsSlotMapGet(RcsSlotMap_t map, RcsSlotHandle_t handle)
+{
+    if (map == NULL) {
+        return NULL;
+    }
+    RcsSlotMapHandle_t *mapHandle = (RcsSlotMapHandle_t *)map;
+
+    RcsSlotMapSlot_t *slot = FindSlot(mapHandle, handle);
+    if (slot == NULL) {
+        return NULL;
+    }
+    return &mapHandle->dense[(size_t)slot->denseIndex * mapHandle->elemSize];
+}
+
+/**
+ * @brief 删除全部对象，已发出的句柄全部失效
+ * @param map 槽表句柄
+ */
+void RcsSlotMapClear(RcsSlotMap_t map)
+{
+    if (map == NULL) {
+        return;
+    }
+    RcsSlotMapHandle_t *mapHandle = (RcsSlotMapHandle_t *)map;
+
+    for (uint16_t i = 0; i < mapHandle->count; i++) {
+        RcsSlotMapSlot_t *slot = &mapHandle->slots[mapHandle->denseToSlot[i]];
+        slot->generation = NextGeneration(slot->generation);
+    }
+    ResetFreeList(mapHandle);
+}
+
+/**
+ * @brief 获取对象个数
+ * @param map 槽表句柄
+ * @return 返回对象个数
+ */
+size_t RcsSlotMapGetCount(RcsSlotMap_t map)
+{
+    if (map == NULL) {
+        return 0;
+    }
+    return ((RcsSlotMapHandle_t *)map)->count;
+}
+
+/**
+ * @brief 获取紧密对象数组，前RcsSlotMapGetCount个对象均有效，可直接顺序遍历
+ * @param map 槽表句柄
+ * @return 返回数组首地址，相邻对象间隔为对齐后的elemSize
+ */
+void *RcsSlotMapGetData(RcsSlotMap_t map)
+{
+    if (map == NULL) {
+        return NULL;
+    }
+    return ((RcsSlotMapHandle_t *)map)->dense;
+}
+
+/**
+ * @brief 获取紧密数组中第denseIndex个对象的句柄，用于遍历时取得可长期保存的引用
+ * @param map 槽表句柄
+ * @param denseIndex 紧密数组下标
+ * @return 返回句柄，越界时返回RCS_SLOTMAP_INVALID_HANDLE
+ */
+RcsSlotHandle_t RcsSlotMapHandleAt(RcsSlotMap_t map, size_t denseIndex)
+{
+    if (map == NULL || denseIndex >= ((RcsSlotMapHandle_t *)map)->count) {
+        return RCS_SLOTMAP_INVALID_HANDLE;
+    }
+    RcsSlotMapHandle_t *mapHandle = (RcsSlotMapHandle_t *)map;
+    uint16_t index = mapHandle->denseToSlot[denseIndex];
+    return MakeHandle(mapHandle->slots[index].generation, index);
+}
@@ -0,0 +1,261 @@
+/**
+ * @file timer_wheel.c
+ * @brief 分层时间轮，为协议会话的重传与超时提供O(1)的启动/停止/到期处理
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "timer_wheel.h"
+
+#define LEVEL_MASK (RCS_TIMER_LEVEL_SLOTS - 1)
+
+static inline void NodeLink(RcsTimerNode_t **head, RcsTimerNode_t *node)
+{
+    node->next = *head;
+    if (node->next != NULL) {
+        node->next->pprev = &node->next;
+    }
+    *head = node;
+    node->pprev = head;
+}
+
+static inline void NodeUnlink(RcsTimerNode_t *node)
+{
+    *node->pprev = node->next;
+    if (node->next != NULL) {
+        node->next->pprev = node->pprev;
+    }
+    node->next = NULL;
+    node->pprev = NULL;
+}
+
+/**
+ * @brief 按剩余节拍数选择层级与槽；剩余为0时放入当前槽，由本节拍随后处理
+ */
+static void NodeInsert(RcsTimerWheelHandle_t *handle, RcsTimerNode_t *node)
+{
+    uint32_t diff = node->expire - handle->now;
+    uint32_t slotTick = node->expire;
+    int level;
+
+    if (diff > RCS_TIMER_MAX_DELAY) {
+        diff = RCS_TIMER_MAX_DELAY;
+        slotTick = handle->now + RCS_TIMER_MAX_DELAY;
+    }
+    for (level = 0; level < RCS_TIMER_LEVELS - 1; level++) {
+        if (diff < (1u << (RCS_TIMER_LEVEL_BITS * (level + 1)))) {
+            break;
+        }
+    }
+
+    uint32_t slot = (slotTick >> (RCS_TIMER_LEVEL_BITS * level)) & LEVEL_MASK;
+    NodeLink(&handle->slots[level][slot], node);
+}
+
+/**
+ * @brief 将高层某个槽的定时器按剩余时间重新分配到低层
+ */
+static void Cascade(RcsTimerWheelHandle_t *handle, int level)
+{
+    uint32_t slot = (handle->now >> (RCS_TIMER_LEVEL_BITS * level)) & LEVEL_MASK;
+    RcsTimerNode_t *node = handle->slots[level][slot];
+    handle->slots[level][slot] = NULL;
+
+    while (node != NULL) {
+        RcsTimerNode_t *next = node->next;
+        NodeInsert(handle, node);
+        node = next;
+    }
+}
+
+/**
+ * @brief 前进一个节拍：先自顶向下级联，再整槽取出到期批次逐个回调
+ */
+static size_t AdvanceOneTick(RcsTimerWheelHandle_t *handle)
+{
+    handle->now++;
+
+    int top = 0;
+    while (top < RCS_TIMER_LEVELS - 1 &&
+           (handle->now & ((1u << (RCS_TIMER_LEVEL_BITS * (top + 1))) - 1)) == 0) {
+        top++;
+    }
+    for (int level = top; level >= 1; level--) {
+        Cascade(handle, level);
+    }
+
+    RcsTimerNode_t **slot = &handle->slots[0][handle->now & LEVEL_MASK];
+    handle->expired = *slot;
+    if (handle->expired != NULL) {
+        handle->expired->pprev = &handle->expired;
+    }
+    *slot = NULL;
+
+    size_t fired = 0;
+    while (handle->expired != NULL) {
+        RcsTimerNode_t *node = handle->expired;
+        NodeUnlink(node);
+        node->callback(node, node->arg);
+        fired++;
+    }
+    return fired;
+}
+
+/**
+ * @brief 使用静态申请的方式创建时间轮
+ * @param staticHandle 静态的时间轮句柄
+ * @return 返回时间轮句柄
+ */
+RcsTimerWheel_t RcsTimerWheelCreateStatic(RcsTimerWheelHandle_t *staticHandle)
+{
+    if (staticHandle == NULL) {
+        return NULL;
+    }
+    memset(staticHandle, 0, sizeof(RcsTimerWheelHandle_t));
+    return (RcsTimerWheel_t)staticHandle;
+}
+
+/**
+ * @brief 使用动态申请的方式创建时间轮
+ * @return 返回时间轮句柄
+ */
+RcsTimerWheel_t RcsTimerWheelCreate(void)
+{
+    RcsTimerWheelHandle_t *handle = (RcsTimerWheelHandle_t *)TimerPortMalloc(sizeof(RcsTimerWheelHandle_t));
+    if (handle == NULL) {
+        return NULL;
+    }
+    return RcsTimerWheelCreateStatic(handle);
+}
+
+/**
+ * @brief 销毁时间轮，仍在运行的定时器节点由用户自行处理
+ * @param wheel 时间轮句柄
+ * @warning 请勿传入静态时间轮句柄
+ */
+void RcsTimerWheelDestroy(RcsTimerWheel_t wheel)
+{
+    if (wheel == NULL) {
+        return;
+    }
+    TimerPortFree(wheel);
+}
+
+/**
+ * @brief 初始化定时器节点
+ * @param node 定时器节点
+ * @param callback 到期回调
+ * @param arg 回调参数
+ * @return 返回错误码
+ */
+int RcsTimerNodeInit(RcsTimerNode_t *node, RcsTimerCallback_t callback, void *arg)
+{
+    if (node == NULL || callback == NULL) {
+        return RCS_TIMER_INVALID_PARAM;
+    }
+    node->next = NULL;
+    node->pprev = NULL;
+    node->expire = 0;
+    node->callback = callback;
+    node->arg = arg;
+    return RCS_TIMER_OK;
+}
+
+/**
+ * @brief 启动定时器，已在运行的定时器会被重新计时
+ * @param wheel 时间轮句柄
+ * @param node 已初始化的定时器节点
+ * @param delay 延时节拍数，为0时按1处理
+ * @return 返回错误码
+ */
+int RcsTimerStart(RcsTimerWheel_t wheel, RcsTimerNode_t *node, uint32_t delay)
+{
+    if (wheel == NULL || node == NULL || node->callback == NULL) {
+        return RCS_TIMER_INVALID_PARAM;
+    }
+    RcsTimerWheelHandle_t *handle = (RcsTimerWheelHandle_t *)wheel;
+
+    if (node->pprev != NULL) {
+        NodeUnlink(node);
+    }
+    node->expire = handle->now + (delay == 0 ? 1 : delay);
+    NodeInsert(handle, node);
+    return RCS_TIMER_OK;
+}
+
+/**
+ * @brief 停止定时器，对未启动或已到期的定时器调用无副作用
+ * @param wheel 时间轮句柄
+ * @param node 定时器节点
+ * @return 返回错误码
+ */
+int RcsTimerStop(RcsTimerWheel_t wheel, RcsTimerNode_t *node)
+{
+    if (wheel == NULL || node == NULL) {
+        return RCS_TIMER_INVALID_PARAM;
+    }
+    if (node->pprev != NULL) {
+        NodeUnlink(node);
+    }
+    return RCS_TIMER_OK;
+}
+
+/**
+ * @brief 查询定时器是否在运行
+ * @param node 定时器节点
+ * @return 运行中返回1，否则返回0
+ */
+int RcsTimerIsActive(const RcsTimerNode_t *node)
+{
+    return (node != NULL && node->pprev != NULL) ? 1 : 0;
+}
+
+/**
+ * @brief 累加一个节拍，可在中断中调用，实际处理推迟到RcsTimerWheelProcess
+ * @param wheel 时间轮句柄
+ */
+void RcsTimerWheelTick(RcsTimerWheel_t wheel)
+{
+    if (wheel == NULL) {
+        return;
+    }
+    __atomic_fetch_add(&((RcsTimerWheelHandle_t *)wheel)->pendingTicks, 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief 处理累积的节拍，到期回调在此按节拍成批执行
+ * @param wheel 时间轮句柄
+ * @return 返回本次执行的回调个数
+ */
+size_t RcsTimerWheelProcess(RcsTimerWheel_t wheel)
+{
+    if (wheel == NULL) {
+        return 0;
+    }
+    RcsTimerWheelHandle_t *handle = (RcsTimerWheelHandle_t *)wheel;
+
+    uint32_t ticks = __atomic_exchange_n(&handle->pendingTicks, 0, __ATOMIC_ACQUIRE);
+    size_t fired = 0;
+    while (ticks-- > 0) {
+        fired += AdvanceOneTick(handle);
+    }
+    return fired;
+}
+
+/**
+ * @brief 获取时间轮已处理到的节拍
+ * @param wheel 时间轮句柄
+ * @return 返回当前节拍
+ */
+uint32_t RcsTimerWheelGetNow(RcsTimerWheel_t wheel)
+{
+    if (wheel == NULL) {
+        return 0;
+    }
+    return ((RcsTimerWheelHandle_t *)wheel)->now;
+}
@@ -0,0 +1,368 @@
+/**
+ * @file tlsf_heap.c
+ * @brief 两级分离适配（TLSF）实时堆，O(1)申请与释放，可作为FIFO的分配器
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "tlsf_heap.h"
+
+#define TLSF_HEADER_SIZE   sizeof(RcsTlsfBlock_t)
+#define TLSF_MIN_PAYLOAD   sizeof(TlsfFreeLink_t)
+#define TLSF_SMALL_BLOCK   ((size_t)1 << RCS_TLSF_FL_SHIFT)
+#define TLSF_MAX_BLOCK     ((size_t)1 << RCS_TLSF_FL_MAX)
+#define TLSF_FREE_BIT      ((size_t)1)
+
+#define TLSF_ALIGN_UP(x)   (((x) + RCS_TLSF_ALIGN - 1) & ~(size_t)(RCS_TLSF_ALIGN - 1))
+#define TLSF_ALIGN_DOWN(x) ((x) & ~(size_t)(RCS_TLSF_ALIGN - 1))
+
+// 空闲块负载区开头的双向链表
+typedef struct
+{
+    RcsTlsfBlock_t *next;
+    RcsTlsfBlock_t *prev;
+}TlsfFreeLink_t;
+
+static inline size_t BlockSize(const RcsTlsfBlock_t *block)
+{
+    return block->size & ~TLSF_FREE_BIT;
+}
+
+static inline int BlockIsFree(const RcsTlsfBlock_t *block)
+{
+    return (block->size & TLSF_FREE_BIT) != 0;
+}
+
+static inline void *BlockPayload(RcsTlsfBlock_t *block)
+{
+    return (uint8_t *)block + TLSF_HEADER_SIZE;
+}
+
+static inline RcsTlsfBlock_t *BlockFromPayload(void *ptr)
+{
+    return (RcsTlsfBlock_t *)((uint8_t *)ptr - TLSF_HEADER_SIZE);
+}
+
+static inline TlsfFreeLink_t *BlockLink(RcsTlsfBlock_t *block)
+{
+    return (TlsfFreeLink_t *)BlockPayload(block);
+}
+
+static inline RcsTlsfBlock_t *BlockNext(RcsTlsfBlock_t *block)
+{
+    return (RcsTlsfBlock_t *)((uint8_t *)BlockPayload(block) + BlockSize(block));
+}
+
+static inline int Fls(size_t size)
+{
+    return 31 - TlsfPortClz32((uint32_t)size);
+}
+
+/**
+ * @brief 计算大小所属的一级、二级下标
+ */
+static void MappingInsert(size_t size, int *fl, int *sl)
+{
+    if (size < TLSF_SMALL_BLOCK) {
+        *fl = 0;
+        *sl = (int)(size / (TLSF_SMALL_BLOCK / RCS_TLSF_SL_COUNT));
+    }
+    else {
+        int f = Fls(size);
+        *sl = (int)(size >> (f - RCS_TLSF_SL_COUNT_LOG2)) ^ (int)RCS_TLSF_SL_COUNT;
+        *fl = f - (RCS_TLSF_FL_SHIFT - 1);
+    }
+}
+
+/**
+ * @brief 将申请大小向上取整到下一个区间的起点，使区间内任意块都能满足申请
+ */
+static void MappingSearch(size_t size, int *fl, int *sl)
+{
+    if (size >= TLSF_SMALL_BLOCK) {
+        size += ((size_t)1 << (Fls(size) - RCS_TLSF_SL_COUNT_LOG2)) - 1;
+    }
+    MappingInsert(size, fl, sl);
+}
+
+static void InsertFree(RcsTlsfHandle_t *handle, RcsTlsfBlock_t *block)
+{
+    int fl, sl;
+    MappingInsert(BlockSize(block), &fl, &sl);
+
+    TlsfFreeLink_t *link = BlockLink(block);
+    RcsTlsfBlock_t *head = handle->freeHeads[fl][sl];
+    link->next = head;
+    link->prev = NULL;
+    if (head != NULL) {
+        BlockLink(head)->prev = block;
+    }
+    handle->freeHeads[fl][sl] = block;
+    handle->flBitmap |= 1u << fl;
+    handle->slBitmap[fl] |= 1u << sl;
+
+    block->size |= TLSF_FREE_BIT;
+    handle->freeSize += BlockSize(block);
+}
+
+static void RemoveFree(RcsTlsfHandle_t *handle, RcsTlsfBlock_t *block)
+{
+    int fl, sl;
+    MappingInsert(BlockSize(block), &fl, &sl);
+
+    TlsfFreeLink_t *link = BlockLink(block);
+    if (link->next != NULL) {
+        BlockLink(link->next)->prev = link->prev;
+    }
+    if (link->prev != NULL) {
+        BlockLink(link->prev)->next = link->next;
+    }
+    else {
+        handle->freeHeads[fl][sl] = link->next;
+        if (link->next == NULL) {
+            handle->slBitmap[fl] &= ~(1u << sl);
+            if (handle->slBitmap[fl] == 0) {
+                handle->flBitmap &= ~(1u << fl);
+            }
+        }
+    }
+
+    block->size &= ~TLSF_FREE_BIT;
+    handle->freeSize -= BlockSize(block);
+}
+
+/**
+ * @brief 用两次位图查找定位第一个足够大的空闲链表
+ */
+static RcsTlsfBlock_t *FindSuitable(RcsTlsfHandle_t *handle, int fl, int sl)
+{
+    uint32_t slMap = handle->slBitmap[fl] & (~0u << sl);
+    if (slMap == 0) {
+        uint32_t flMap = (fl + 1 < 32) ? handle->flBitmap & (~0u << (fl + 1)) : 0;
+        if (flMap == 0) {
+            return NULL;
+        }
+        fl = TlsfPortCtz32(flMap);
+        slMap = handle->slBitmap[fl];
+    }
+    sl = TlsfPortCtz32(slMap);
+    return handle->freeHeads[fl][sl];
+}
+
+static void *TlsfAllocatorAlloc(void *ctx, size_t size)
+{
+    return RcsTlsfMalloc(ctx, size);
+}
+
+static void TlsfAllocatorFree(void *ctx, void *ptr)
+{
+    RcsTlsfFree(ctx, ptr);
+}
+
+/**
+ * @brief 在调用者提供的内存区上创建TLSF堆
+ * @param staticHandle 静态的TLSF句柄
+ * @param arena 内存区起始位置
+ * @param arenaSize 内存区大小，单位为字节，需小于1GB
+ * @return 返回TLSF句柄
+ */
+RcsTlsf_t RcsTlsfCreateStatic(RcsTlsfHandle_t *staticHandle, void *arena, size_t arenaSize)
+{
+    if (staticHandle == NULL || arena == NULL) {
+        return NULL;
+    }
+
+    uintptr_t begin = TLSF_ALIGN_UP((uintptr_t)arena);
+    uintptr_t end = TLSF_ALIGN_DOWN((uintptr_t)arena + arenaSize);
+    if (end <= begin || end - begin < 2 * TLSF_HEADER_SIZE + TLSF_MIN_PAYLOAD) {
+        return NULL;
+    }
+    size_t firstSize = (size_t)(end - begin) - 2 * TLSF_HEADER_SIZE;
+    if (firstSize >= TLSF_MAX_BLOCK) {
+        return NULL;
+    }
+
+    uint8_t *bytes = (uint8_t *)staticHandle;
+    for (size_t i = 0; i < sizeof(RcsTlsfHandle_t); i++) {
+        bytes[i] = 0;
+    }
+    staticHandle->arena = (uint8_t *)begin;
+    staticHandle->arenaSize = (size_t)(end - begin);
+
+    // 整个内存区作为一个空闲块，末尾放置一个大小为0的已用哨兵块，合并时无需判断边界
+    RcsTlsfBlock_t *first = (RcsTlsfBlock_t *)begin;
+    first->prevPhys = NULL;
+    first->size = firstSize;
+
+    RcsTlsfBlock_t *sentinel = BlockNext(first);
+    sentinel->prevPhys = first;
+    sentinel->size = 0;
+
+    InsertFree(staticHandle, first);
+    return (RcsTlsf_t)staticHandle;
+}
+
+/**
+ * @brief 使用动态申请的方式创建TLSF堆
+ * @param arenaSize 内存区大小，单位为字节
+ * @return 返回TLSF句柄
+ */
+RcsTlsf_t RcsTlsfCreate(size_t arenaSize)
+{
+    RcsTlsfHandle_t *handle = (RcsTlsfHandle_t *)TlsfPortMalloc(sizeof(RcsTlsfHandle_t));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    void *arena = TlsfPortMalloc(arenaSize);
+    if (arena == NULL) {
+        TlsfPortFree(handle);
+        return NULL;
+    }
+
+    if (RcsTlsfCreateStatic(handle, arena, arenaSize) == NULL) {
+        TlsfPortFree(arena);
+        TlsfPortFree(handle);
+        return NULL;
+    }
+    return (RcsTlsf_t)handle;
+}
+
+/**
+ * @brief 销毁TLSF堆
+ * @param tlsf TLSF句柄
+ * @warning 请勿传入静态TLSF句柄
+ */
+void RcsTlsfDestroy(RcsTlsf_t tlsf)
+{
+    if (tlsf == NULL) {
+        return;
+    }
+    RcsTlsfHandle_t *handle = (RcsTlsfHandle_t *)tlsf;
+    TlsfPortFree(handle->arena);
+    TlsfPortFree(handle);
+}
+
+/**
+ * @brief 从TLSF堆申请内存，最坏执行时间与堆大小、已分配块数无关
+ * @param tlsf TLSF句柄
+ * @param size 申请大小，单位为字节
+ * @return 返回按指针大小对齐的地址，失败返回NULL
+ */
+void *RcsTlsfMalloc(RcsTlsf_t tlsf, size_t size)
+{
+    if (tlsf == NULL || size == 0 || size >= TLSF_MAX_BLOCK) {
+        return NULL;
+    }
+    RcsTlsfHandle_t *handle = (RcsTlsfHandle_t *)tlsf;
+
+    size_t adjust = TLSF_ALIGN_UP(size < TLSF_MIN_PAYLOAD ? TLSF_MIN_PAYLOAD : size);
+    int fl, sl;
+    MappingSearch(adjust, &fl, &sl);
+    if (fl >= (int)RCS_TLSF_FL_COUNT) {
+        return NULL;
+    }
+
+    TlsfPortEnterCriticalFromAll();
+
+    RcsTlsfBlock_t *block = FindSuitable(handle, fl, sl);
+    if (block == NULL) {
+        TlsfPortExitCriticalFromAll();
+        return NULL;
+    }
+    RemoveFree(handle, block);
+
+    // 剩余部分足以成为一个新块时切分
+    size_t blockSize = BlockSize(block);
+    if (blockSize >= adjust + TLSF_HEADER_SIZE + TLSF_MIN_PAYLOAD) {
+        RcsTlsfBlock_t *remain = (RcsTlsfBlock_t *)((uint8_t *)BlockPayload(block) + adjust);
+        remain->prevPhys = block;
+        remain->size = blockSize - adjust - TLSF_HEADER_SIZE;
+        BlockNext(remain)->prevPhys = remain;
+        block->size = adjust;
+        InsertFree(handle, remain);
+    }
+
+    TlsfPortExitCriticalFromAll();
+    return BlockPayload(block);
+}
+
+/**
+ * @brief 将内存归还给TLSF堆，并立即与物理相邻的空闲块合并
+ * @param tlsf TLSF句柄
+ * @param ptr 由RcsTlsfMalloc返回的地址
+ * @return 返回错误码，重复释放或地址不属于该堆时返回RCS_TLSF_INVALID_PARAM
+ */
+int RcsTlsfFree(RcsTlsf_t tlsf, void *ptr)
+{
+    if (tlsf == NULL || ptr == NULL) {
+        return RCS_TLSF_INVALID_PARAM;
+    }
+    RcsTlsfHandle_t *handle = (RcsTlsfHandle_t *)tlsf;
+    if ((uint8_t *)ptr < handle->arena + TLSF_HEADER_SIZE ||
+        (uint8_t *)ptr >= handle->arena + handle->arenaSize ||
+        ((uintptr_t)ptr & (RCS_TLSF_ALIGN - 1)) != 0) {
+        return RCS_TLSF_INVALID_PARAM;
+    }
+
+    RcsTlsfBlock_t *block = BlockFromPayload(ptr);
+    TlsfPortEnterCriticalFromAll();
+
+    if (BlockIsFree(block)) {
+        TlsfPortExitCriticalFromAll();
+        return RCS_TLSF_INVALID_PARAM;
+    }
+
+    RcsTlsfBlock_t *prev = block->prevPhys;
+    if (prev != NULL && BlockIsFree(prev)) {
+        RemoveFree(handle, prev);
+        prev->size += TLSF_HEADER_SIZE + BlockSize(block);
+        block = prev;
+    }
+
+    RcsTlsfBlock_t *next = BlockNext(block);
+    if (BlockIsFree(next)) {
+        RemoveFree(handle, next);
+        block->size += TLSF_HEADER_SIZE + BlockSize(next);
+    }
+    BlockNext(block)->prevPhys = block;
+
+    InsertFree(handle, block);
+
+    TlsfPortExitCriticalFromAll();
+    return RCS_TLSF_OK;
+}
+
+/**
+ * @brief 获取TLSF堆中空闲块负载之和
+ * @param tlsf TLSF句柄
+ * @return 返回空闲字节数
+ */
+size_t RcsTlsfGetFree(RcsTlsf_t tlsf)
+{
+    if (tlsf == NULL) {
+        return 0;
+    }
+    return ((RcsTlsfHandle_t *)tlsf)->freeSize;
+}
+
+/**
+ * @brief 获取以该TLSF堆为后端的分配器，可按实例替换FifoPortMalloc/FifoPortFree
+ * @param tlsf TLSF句柄
+ * @param allocator 返回的分配器
+ * @return 返回错误码
+ */
+int RcsTlsfGetAllocator(RcsTlsf_t tlsf, RcsAllocator_t *allocator)
+{
+    if (tlsf == NULL || allocator == NULL) {
+        return RCS_TLSF_INVALID_PARAM;
+    }
+    allocator->alloc = TlsfAllocatorAlloc;
+    allocator->free = TlsfAllocatorFree;
+    allocator->ctx = tlsf;
+    return RCS_TLSF_OK;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file view_cursor.c
+ * @brief 两段FIFO区域上的顺序游标，按小端/大端读写u8/u16/u32/f32字段，
+ *        字段连续时为一次非对齐访问，只有跨越回绕的字段才逐段拼接
+ * @author CYK-Dot
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "view_cursor.h"
+
+/**
+ * @brief 当前段用完时切换到第二段
+ */
+static inline void CursorNextSegment(RcsCursor_t *cursor)
+{
+    if (cursor->avail == 0 && cursor->nextLen != 0) {
+        cursor->ptr = cursor->next;
+        cursor->avail = cursor->nextLen;
+        cursor->next = NULL;
+        cursor->nextLen = 0;
+    }
+}
+
+/**
+ * @brief 在申请区域上初始化游标，发送申请与接收申请均可
+ * @param cursor 游标
+ * @param memAcquired 申请时返回的内存指针
+ * @param firstSize 申请函数的返回值，即第一段的长度
+ * @param size 申请的总大小
+ * @return 返回错误码
+ */
+int RcsCursorInit(RcsCursor_t *cursor, void *memAcquired[2], size_t firstSize, size_t size)
+{
+    if (cursor == NULL || memAcquired == NULL || firstSize > size) {
+        return RCS_CURSOR_INVALID_PARAM;
+    }
+    if ((firstSize != 0 && memAcquired[0] == NULL) || (firstSize < size && memAcquired[1] == NULL)) {
+        return RCS_CURSOR_INVALID_PARAM;
+    }
+
+    cursor->ptr = (uint8_t *)memAcquired[0];
+    cursor->avail = firstSize;
+    cursor->next = (firstSize < size) ? (uint8_t *)memAcquired[1] : NULL;
+    cursor->nextLen = size - firstSize;
+    cursor->size = size;
+    cursor->error = RCS_CURSOR_OK;
+    return RCS_CURSOR_OK;
+}
+
+/**
+ * @brief 在只读视图上初始化游标
+ * @param cursor 游标
+ * @param view 视图
+ * @return 返回错误码
+ * @note 视图指向的是接收区域，只能使用Get系列函数
+ */
+int RcsCursorInitView(RcsCursor_t *cursor, const RcsFifoView_t *view)
+{
+    if (cursor == NULL || view == NULL) {
+        return RCS_CURSOR_INVALID_PARAM;
+    }
+
+    cursor->ptr = (uint8_t *)view->seg[0];
+    cursor->avail = view->len[0];
+    cursor->next = (uint8_t *)view->seg[1];
+    cursor->nextLen = view->len[1];
+    cursor->size = view->len[0] + view->len[1];
+    cursor->error = RCS_CURSOR_OK;
+    return RCS_CURSOR_OK;
+}
+
+/**
+ * @brief RcsCursorRead的慢路径：字段跨越两段或越界
+ * @param cursor 游标
+ * @param dst 目标，越界时清零
+ * @param size 字节数
+ */
+void RcsCursorReadSlow(RcsCursor_t *cursor, void *dst, size_t size)
+{
+    if (size > cursor->avail + cursor->nextLen) {
+        cursor->error = RCS_CURSOR_OVERFLOW;
+        memset(dst, 0, size);
+        return;
+    }
+
+    uint8_t *out = (uint8_t *)dst;
+    size_t first = cursor->avail;
+    if (first != 0) {
+        memcpy(out, cursor->ptr, first);
+    }
+    cursor->ptr += first;
+    cursor->avail = 0;
+    CursorNextSegment(cursor);
+
+    memcpy(out + first, cursor->ptr, size - first);
+    cursor->ptr += size - first;
+    cursor->avail -= size - first;
+}
+
+/**
+ * @brief RcsCursorWrite的慢路径：字段跨越两段或越界
+ * @param cursor 游标
+ * @param src 数据，越界时不写入任何字节
+ * @param size 字节数
+ */
+void RcsCursorWriteSlow(RcsCursor_t *cursor, const void *src, size_t size)
+{
+    if (size > cursor->avail + cursor->nextLen) {
+        cursor->error = RCS_CURSOR_OVERFLOW;
+        return;
+    }
+
+    const uint8_t *in = (const uint8_t *)src;
+    size_t first = cursor->avail;
+    if (first != 0) {
+        memcpy(cursor->ptr, in, first);
+    }
+    cursor->ptr += first;
+    cursor->avail = 0;
+    CursorNextSegment(cursor);
+
+    memcpy(cursor->ptr, in + first, size - first);
+    cursor->ptr += size - first;
+    cursor->avail -= size - first;
+}
+
+/**
+ * @brief 跳过size字节
+ * @param cursor 游标
+ * @param size 字节数
+ * @return 返回错误码，越界时位置不变
+ */
+int RcsCursorSkip(RcsCursor_t *cursor, size_t size)
+{
+    if (cursor == NULL) {
+        return RCS_CURSOR_INVALID_PARAM;
+    }
+    if (size > cursor->avail + cursor->nextLen) {
+        cursor->error = RCS_CURSOR_OVERFLOW;
+        return RCS_CURSOR_OVERFLOW;
+    }
+
+    if (size > cursor->avail) {
+        size -= cursor->avail;
+        cursor->avail = 0;
+        CursorNextSegment(cursor);
+    }
+    cursor->ptr += size;
+    cursor->avail -= size;
+    return RCS_CURSOR_OK;
+}
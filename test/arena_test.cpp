@@ -0,0 +1,97 @@
+/**
+ * @file arena_test.cpp
+ * @brief 线性分配器的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "arena.h"
+#include "siso_fifo.h"
+
+// 测试夹具
+class RcsArenaTest : public ::testing::Test {
+protected:
+    static constexpr size_t arenaSize = 256;
+    RcsArenaHandle_t handle;
+    alignas(16) uint8_t memory[arenaSize];
+    RcsArena_t arena;
+
+    void SetUp() override {
+        arena = RcsArenaCreateStatic(arenaSize, &handle, memory);
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsArenaTest, InvalidParam)
+{
+    RcsArenaHandle_t other;
+    EXPECT_EQ(RcsArenaCreateStatic(0, &other, memory), nullptr);
+    EXPECT_EQ(RcsArenaCreateStatic(arenaSize, NULL, memory), nullptr);
+    EXPECT_EQ(RcsArenaCreate(0), nullptr);
+    EXPECT_EQ(RcsArenaRewind(NULL, 0), RCS_ARENA_INVALID_PARAM);
+    EXPECT_EQ(RcsArenaRewind(arena, 1), RCS_ARENA_INVALID_PARAM);
+    EXPECT_EQ(RcsArenaAlloc(arena, arenaSize + 1, 1), nullptr);
+    EXPECT_EQ(RcsArenaAlloc(arena, SIZE_MAX, 1), nullptr);
+}
+
+// 对齐与顺序分配
+TEST_F(RcsArenaTest, AlignedBump)
+{
+    uint8_t* a = (uint8_t*)RcsArenaAlloc(arena, 3, 1);
+    uint32_t* b = (uint32_t*)RcsArenaAlloc(arena, sizeof(uint32_t), alignof(uint32_t));
+    double* c = (double*)RcsArenaAlloc(arena, sizeof(double), 16);
+    ASSERT_EQ(a, memory);
+    ASSERT_EQ((uint8_t*)b, memory + 4);
+    ASSERT_EQ((uint8_t*)c, memory + 16);
+    EXPECT_EQ(RcsArenaGetUsed(arena), 24u);
+
+    // 用尽后失败，且不改变当前位置
+    EXPECT_EQ(RcsArenaAlloc(arena, arenaSize, 1), nullptr);
+    EXPECT_EQ(RcsArenaGetUsed(arena), 24u);
+}
+
+// 检查点回退与周期复位
+TEST_F(RcsArenaTest, CheckpointAndReset)
+{
+    RcsArenaAlloc(arena, 10, 1);
+    RcsArenaMark_t mark = RcsArenaCheckpoint(arena);
+    void* scratch = RcsArenaAlloc(arena, 100, 8);
+    ASSERT_NE(scratch, nullptr);
+    EXPECT_EQ(RcsArenaRewind(arena, mark), RCS_ARENA_OK);
+    EXPECT_EQ(RcsArenaGetUsed(arena), 10u);
+    EXPECT_EQ(RcsArenaAlloc(arena, 100, 8), scratch);
+
+    RcsArenaReset(arena);
+    EXPECT_EQ(RcsArenaGetUsed(arena), 0u);
+    EXPECT_EQ(RcsArenaGetPeak(arena), 116u);
+
+    // 模拟多个周期，每个周期的内存都从起点开始
+    for (int cycle = 0; cycle < 1000; cycle++) {
+        void* frame = RcsArenaAlloc(arena, 64, 8);
+        ASSERT_EQ(frame, memory);
+        RcsArenaReset(arena);
+    }
+}
+
+// 作为短生命周期工具的FIFO分配器，销毁FIFO不需要逐个释放
+TEST_F(RcsArenaTest, FifoAllocator)
+{
+    RcsArena_t dynamic = RcsArenaCreate(1024);
+    RcsAllocator_t allocator;
+    ASSERT_EQ(RcsArenaGetAllocator(dynamic, &allocator), RCS_ARENA_OK);
+    EXPECT_EQ(allocator.free, nullptr);
+
+    RcsFifo_t fifo = RcsFifoCreateWithAllocator(64, &allocator);
+    ASSERT_NE(fifo, nullptr);
+    EXPECT_EQ((uintptr_t)fifo % sizeof(void*), 0u);
+
+    void* memAcquired[2] = {nullptr};
+    ASSERT_EQ(RcsFifoSendAcquire(fifo, 10, memAcquired), 10);
+    RcsFifoSendComplete(fifo, (const void**)memAcquired);
+    RcsFifoDestroy(fifo);
+
+    RcsArenaReset(dynamic);
+    EXPECT_EQ(RcsArenaGetUsed(dynamic), 0u);
+    RcsArenaDestroy(dynamic);
+}
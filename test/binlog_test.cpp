@@ -0,0 +1,226 @@
+/**
+ * @file binlog_test.cpp
+ * @brief 二进制日志与主机端解码的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "binlog_decode.h"
+
+// 测试夹具
+class RcsLogTest : public ::testing::Test {
+protected:
+    static constexpr size_t fifoSize = 256;
+    RcsFifo_t fifo;
+    RcsLog_t log;
+    RcsLogDict_t dict;
+
+    void SetUp() override {
+        fifo = RcsFifoCreate(fifoSize);
+        ASSERT_EQ(RcsLogInit(&log, fifo), RCS_LOG_OK);
+        ASSERT_EQ(RcsLogDictLoadElf(&dict, "/proc/self/exe"), RCS_LOG_OK);
+    }
+
+    void TearDown() override {
+        RcsLogDictFree(&dict);
+        RcsFifoDestroy(fifo);
+    }
+
+    // 取出FIFO中的全部记录并逐条格式化
+    std::vector<std::string> Drain(std::vector<RcsLogRecord_t> *records = nullptr) {
+        std::vector<std::string> lines;
+        size_t used = RcsFifoGetUsed(fifo);
+        if (used == 0) {
+            return lines;
+        }
+        void *mem[2] = {nullptr, nullptr};
+        int first = RcsFifoRecvAcquire(fifo, used, mem);
+        EXPECT_GE(first, 0);
+        RcsFifoView_t view;
+        RcsFifoViewInit(&view, mem, (size_t)first, used);
+        std::vector<uint8_t> raw(used);
+        RcsFifoViewCopy(&view, 0, raw.data(), used);
+        RcsFifoRecvComplete(fifo, (const void **)mem);
+
+        size_t pos = 0;
+        while (pos < raw.size()) {
+            RcsLogRecord_t record;
+            int ret = RcsLogParse(raw.data() + pos, raw.size() - pos, &record);
+            EXPECT_GT(ret, 0);
+            if (ret <= 0) {
+                break;
+            }
+            pos += (size_t)ret;
+            char text[128];
+            EXPECT_GE(RcsLogFormat(&dict, &record, text, sizeof(text)), 0);
+            lines.push_back(text);
+            if (records != nullptr) {
+                records->push_back(record);
+            }
+        }
+        return lines;
+    }
+};
+
+// 格式串编号经ELF字典还原，参数按原类型格式化
+TEST_F(RcsLogTest, RoundTrip)
+{
+    int16_t delta = -42;
+    float temp = 36.5f;
+    double volt = 3.3;
+    RCS_LOGI(&log, "boot");
+    RCS_LOGW(&log, "delta=%d temp=%.1f volt=%.2f", delta, temp, volt);
+    RCS_LOGE(&log, "reg 0x%08X bit %u '%c' 100%%", 0xDEADBEEFu, 7u, 'A');
+    RCS_LOGD(&log, "%u%u%u%u%u%u%u%u", 1, 2, 3, 4, 5, 6, 7, 8);
+
+    std::vector<RcsLogRecord_t> records;
+    std::vector<std::string> lines = Drain(&records);
+    ASSERT_EQ(lines.size(), 4u);
+    EXPECT_EQ(lines[0], "boot");
+    EXPECT_EQ(lines[1], "delta=-42 temp=36.5 volt=3.30");
+    EXPECT_EQ(lines[2], "reg 0xDEADBEEF bit 7 'A' 100%");
+    EXPECT_EQ(lines[3], "12345678");
+    EXPECT_EQ(records[0].level, RCS_LOG_LEVEL_INFO);
+    EXPECT_EQ(records[1].level, RCS_LOG_LEVEL_WARN);
+    EXPECT_EQ(records[1].count, 3);
+    EXPECT_EQ(records[3].count, 8);
+}
+
+// 空间不足时丢弃并计数，恢复后先写入丢弃标记
+TEST_F(RcsLogTest, DropMarker)
+{
+    int written = 0;
+    for (int i = 0; i < 40; i++) {
+        uint32_t value = (uint32_t)i;
+        RCS_LOGI(&log, "seq %u", value);
+        written++;
+    }
+    // 每条12字节，255字节的容量可容纳21条
+    EXPECT_EQ(RcsLogGetDropCount(&log), (uint32_t)(written - 21));
+    std::vector<std::string> lines = Drain();
+    ASSERT_EQ(lines.size(), 21u);
+    EXPECT_EQ(lines[20], "seq 20");
+
+    RCS_LOGI(&log, "after");
+    lines = Drain();
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "<19 records dropped>");
+    EXPECT_EQ(lines[1], "after");
+
+    RCS_LOGI(&log, "again");
+    lines = Drain();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(RcsLogGetDropCount(&log), 19u);
+}
+
+// 打断正在进行的写入时丢弃而不破坏记录
+TEST_F(RcsLogTest, NestedWriteDropped)
+{
+    void *mem[2] = {nullptr, nullptr};
+    ASSERT_GE(RcsFifoSendAcquire(fifo, 8, mem), 0);
+    const uint32_t args[1] = {1};
+    EXPECT_EQ(RcsLogWrite(&log, RCS_LOG_HEADER(RCS_LOG_LEVEL_INFO, 0, 1), args, 1), RCS_LOG_DROPPED);
+    RcsFifoSendCompletePartial(fifo, (const void **)mem, 0);
+    EXPECT_EQ(RcsLogGetDropCount(&log), 1u);
+    EXPECT_EQ(RcsLogWrite(&log, RCS_LOG_HEADER(RCS_LOG_LEVEL_INFO, 0, 9), args, 9), RCS_LOG_INVALID_PARAM);
+}
+
+// 解析与字典的边界情况
+TEST_F(RcsLogTest, DecodeErrors)
+{
+    uint8_t raw[12] = {0x00, 0x00, 0x00, 0x01, 0, 0, 0, 0, 5, 0, 0, 0};
+    RcsLogRecord_t record;
+    EXPECT_EQ(RcsLogParse(raw, 4, &record), RCS_LOG_NEED_MORE);
+    EXPECT_EQ(RcsLogParse(raw, 11, &record), RCS_LOG_NEED_MORE);
+    EXPECT_EQ(RcsLogParse(raw, 12, &record), 12);
+    EXPECT_EQ(record.count, 1);
+    EXPECT_EQ(record.args[0], 5u);
+
+    char text[8];
+    record.id = (uint32_t)dict.size + 10;
+    EXPECT_EQ(RcsLogFormat(&dict, &record, text, sizeof(text)), RCS_LOG_UNKNOWN_ID);
+    EXPECT_EQ(RcsLogDictLookup(&dict, 1), nullptr);
+
+    // 输出截断时返回完整长度
+    RCS_LOGI(&log, "a long message %u", 12345u);
+    std::vector<RcsLogRecord_t> records;
+    Drain(&records);
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(RcsLogFormat(&dict, &records[0], text, sizeof(text)), 20);
+    EXPECT_STREQ(text, "a long ");
+
+    RcsLogDict_t missing;
+    EXPECT_EQ(RcsLogDictLoadElf(&missing, "/nonexistent"), RCS_LOG_NOT_FOUND);
+    EXPECT_EQ(RcsLogDictLoadRaw(&missing, "/nonexistent"), RCS_LOG_NOT_FOUND);
+}
+
+// 并发写入与接收，每条记录完整且按顺序，丢弃的条数都能在记录流中找回
+TEST_F(RcsLogTest, ConcurrentProducer)
+{
+    const uint32_t total = 20000;
+    std::atomic<bool> done{false};
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < total; i++) {
+            RCS_LOGD(&log, "n=%u sq=%u", i, i * i);
+        }
+        done = true;
+    });
+
+    uint32_t expect = 0;
+    uint32_t seen = 0;
+    for (;;) {
+        bool finished = done.load();
+        std::vector<RcsLogRecord_t> records;
+        Drain(&records);
+        for (const auto &record : records) {
+            if (record.id == RCS_LOG_ID_DROPPED) {
+                expect += record.args[0];
+                continue;
+            }
+            ASSERT_EQ(record.args[0], expect);
+            ASSERT_EQ(record.args[1], expect * expect);
+            expect++;
+            seen++;
+        }
+        if (finished && RcsFifoGetUsed(fifo) == 0) {
+            break;
+        }
+        if (records.empty()) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_EQ(seen + RcsLogGetDropCount(&log), total);
+}
+
+// 吞吐量测试，仅在make bench时运行
+TEST_F(RcsLogTest, DISABLED_Throughput)
+{
+    RcsFifoDestroy(fifo);
+    fifo = RcsFifoCreate(1 << 20);
+    RcsLogInit(&log, fifo);
+
+    const uint32_t rounds = 50000;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < rounds; i++) {
+        RCS_LOGI(&log, "adc=%u temp=%f", i, 25.0f);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(RcsLogGetDropCount(&log), 0u);
+    printf("binlog: %.1f ns per call\n", seconds / rounds * 1e9);
+
+    char text[64];
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < rounds; i++) {
+        snprintf(text, sizeof(text), "adc=%u temp=%f", i, 25.0f);
+    }
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("snprintf: %.1f ns per call\n", seconds / rounds * 1e9);
+}
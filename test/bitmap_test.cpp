@@ -0,0 +1,122 @@
+/**
+ * @file bitmap_test.cpp
+ * @brief 多级摘要位图的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <random>
+#include <vector>
+
+#include "bitmap.h"
+
+// 测试夹具
+class RcsBitmapTest : public ::testing::Test {
+protected:
+    static constexpr size_t bitCount = 65536;
+    RcsBitmapHandle_t handle;
+    uint32_t memory[RCS_BITMAP_MEM_WORDS(bitCount)];
+    RcsBitmap_t bitmap;
+
+    void SetUp() override {
+        bitmap = RcsBitmapCreateStatic(bitCount, &handle, memory);
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsBitmapTest, InvalidParam)
+{
+    RcsBitmapHandle_t other;
+    EXPECT_EQ(RcsBitmapCreateStatic(0, &other, memory), nullptr);
+    EXPECT_EQ(RcsBitmapCreateStatic(RCS_BITMAP_MAX_BITS + 1, &other, memory), nullptr);
+    EXPECT_EQ(RcsBitmapCreate(0), nullptr);
+    EXPECT_EQ(RcsBitmapSet(bitmap, bitCount), RCS_BITMAP_INVALID_PARAM);
+    EXPECT_EQ(RcsBitmapIsSet(bitmap, bitCount), RCS_BITMAP_INVALID_PARAM);
+    EXPECT_EQ(RcsBitmapSetRange(bitmap, bitCount - 1, 2), RCS_BITMAP_INVALID_PARAM);
+    EXPECT_EQ(RcsBitmapFindFirstSet(NULL), RCS_BITMAP_INVALID_PARAM);
+}
+
+// 单个位的置位/清零与查找
+TEST_F(RcsBitmapTest, SingleBits)
+{
+    EXPECT_EQ(RcsBitmapFindFirstSet(bitmap), RCS_BITMAP_NOT_FOUND);
+    EXPECT_EQ(RcsBitmapFindFirstClear(bitmap), 0);
+
+    RcsBitmapSet(bitmap, 40000);
+    RcsBitmapSet(bitmap, 12345);
+    EXPECT_EQ(RcsBitmapFindFirstSet(bitmap), 12345);
+    EXPECT_EQ(RcsBitmapIsSet(bitmap, 12345), 1);
+    RcsBitmapClear(bitmap, 12345);
+    EXPECT_EQ(RcsBitmapFindFirstSet(bitmap), 40000);
+    EXPECT_EQ(RcsBitmapGetSetCount(bitmap), 1u);
+}
+
+// 编号分配：每次取最小的空闲编号，释放后优先复用
+TEST_F(RcsBitmapTest, IdAllocation)
+{
+    for (int id = 0; id < (int)bitCount; id++) {
+        ASSERT_EQ(RcsBitmapAlloc(bitmap), id);
+    }
+    EXPECT_EQ(RcsBitmapAlloc(bitmap), RCS_BITMAP_NOT_FOUND);
+    EXPECT_EQ(RcsBitmapFindFirstClear(bitmap), RCS_BITMAP_NOT_FOUND);
+
+    RcsBitmapClear(bitmap, 50000);
+    RcsBitmapClear(bitmap, 777);
+    EXPECT_EQ(RcsBitmapAlloc(bitmap), 777);
+    EXPECT_EQ(RcsBitmapAlloc(bitmap), 50000);
+}
+
+// 位数不是32的倍数时，末字的多余位不会被分配
+TEST_F(RcsBitmapTest, TailBitsIgnored)
+{
+    RcsBitmap_t small = RcsBitmapCreate(37);
+    ASSERT_NE(small, nullptr);
+    for (int id = 0; id < 37; id++) {
+        ASSERT_EQ(RcsBitmapAlloc(small), id);
+    }
+    EXPECT_EQ(RcsBitmapAlloc(small), RCS_BITMAP_NOT_FOUND);
+    RcsBitmapDestroy(small);
+}
+
+// 区间操作与朴素实现对照
+TEST_F(RcsBitmapTest, RangesAgainstReference)
+{
+    std::vector<bool> reference(bitCount, false);
+    std::mt19937 rng(40);
+
+    for (int step = 0; step < 2000; step++) {
+        size_t start = rng() % bitCount;
+        size_t count = rng() % std::min<size_t>(bitCount - start + 1, 3000);
+        bool set = rng() % 2 == 0;
+        ASSERT_EQ(set ? RcsBitmapSetRange(bitmap, start, count) : RcsBitmapClearRange(bitmap, start, count),
+                  RCS_BITMAP_OK);
+        for (size_t i = start; i < start + count; i++) {
+            reference[i] = set;
+        }
+
+        if (step % 50 == 0) {
+            int firstSet = -1;
+            int firstClear = -1;
+            size_t setCount = 0;
+            for (size_t i = 0; i < bitCount; i++) {
+                if (reference[i]) {
+                    setCount++;
+                    if (firstSet < 0) firstSet = (int)i;
+                }
+                else if (firstClear < 0) {
+                    firstClear = (int)i;
+                }
+            }
+            EXPECT_EQ(RcsBitmapFindFirstSet(bitmap), firstSet < 0 ? RCS_BITMAP_NOT_FOUND : firstSet);
+            EXPECT_EQ(RcsBitmapFindFirstClear(bitmap), firstClear < 0 ? RCS_BITMAP_NOT_FOUND : firstClear);
+            EXPECT_EQ(RcsBitmapGetSetCount(bitmap), setCount);
+        }
+    }
+
+    RcsBitmapSetRange(bitmap, 0, bitCount);
+    EXPECT_EQ(RcsBitmapFindFirstClear(bitmap), RCS_BITMAP_NOT_FOUND);
+    RcsBitmapClearRange(bitmap, 0, bitCount);
+    EXPECT_EQ(RcsBitmapFindFirstSet(bitmap), RCS_BITMAP_NOT_FOUND);
+    EXPECT_EQ(RcsBitmapGetSetCount(bitmap), 0u);
+}
@@ -0,0 +1,170 @@
+/**
+ * @file block_pool_test.cpp
+ * @brief 固定块内存池的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <cstring>
+#include <set>
+#include <thread>
+
+#include "block_pool.h"
+#include "siso_fifo.h"
+
+// 测试夹具
+class RcsPoolTest : public ::testing::Test {
+protected:
+    static constexpr size_t blockSize = 20;
+    static constexpr size_t blockCount = 4;
+    RcsPoolHandle_t handle;
+    alignas(void*) uint8_t memory[RCS_POOL_MEM_SIZE(blockSize, blockCount)];
+    RcsPool_t pool;
+
+    void SetUp() override {
+        pool = RcsPoolCreateStatic(blockSize, blockCount, &handle, memory);
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsPoolTest, InvalidParam)
+{
+    RcsPoolHandle_t other;
+    EXPECT_EQ(RcsPoolCreateStatic(0, blockCount, &other, memory), nullptr);
+    EXPECT_EQ(RcsPoolCreateStatic(blockSize, 0, &other, memory), nullptr);
+    EXPECT_EQ(RcsPoolCreateStatic(blockSize, blockCount, &other, memory + 1), nullptr);
+    EXPECT_EQ(RcsPoolCreate(0, 1), nullptr);
+    EXPECT_EQ(RcsPoolAlloc(NULL), nullptr);
+    EXPECT_EQ(RcsPoolFree(pool, NULL), RCS_POOL_INVALID_PARAM);
+    EXPECT_EQ(RcsPoolFree(pool, memory + 1), RCS_POOL_INVALID_PARAM);
+    EXPECT_EQ(RcsPoolFree(pool, memory + sizeof(memory)), RCS_POOL_INVALID_PARAM);
+}
+
+// 块大小对齐
+TEST_F(RcsPoolTest, BlockSizeAligned)
+{
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(handle.blockSize % sizeof(void*), 0u);
+    EXPECT_GE(handle.blockSize, blockSize);
+    EXPECT_EQ(RCS_POOL_BLOCK_SIZE(1), sizeof(void*));
+}
+
+// 申请到耗尽，释放后复用
+TEST_F(RcsPoolTest, AllocUntilExhausted)
+{
+    std::set<void*> blocks;
+    for (size_t i = 0; i < blockCount; i++) {
+        void* block = RcsPoolAlloc(pool);
+        ASSERT_NE(block, nullptr);
+        memset(block, 0xA5, blockSize);
+        blocks.insert(block);
+    }
+    EXPECT_EQ(blocks.size(), blockCount);
+    EXPECT_EQ(RcsPoolGetFree(pool), 0u);
+    EXPECT_EQ(RcsPoolAlloc(pool), nullptr);
+
+    void* first = *blocks.begin();
+    EXPECT_EQ(RcsPoolFree(pool, first), RCS_POOL_OK);
+    EXPECT_EQ(RcsPoolGetFree(pool), 1u);
+    EXPECT_EQ(RcsPoolAlloc(pool), first);
+}
+
+// 尚未切出的块与重复释放的块都被拒绝，之后不会出现同一块被分出两次
+TEST_F(RcsPoolTest, RejectUnallocatedAndDoubleFree)
+{
+    void* a = RcsPoolAlloc(pool);
+    void* b = RcsPoolAlloc(pool);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(RcsPoolFree(pool, memory + 2 * handle.blockSize), RCS_POOL_INVALID_PARAM);
+    EXPECT_EQ(RcsPoolGetFree(pool), blockCount - 2);
+
+    EXPECT_EQ(RcsPoolFree(pool, a), RCS_POOL_OK);
+    EXPECT_EQ(RcsPoolFree(pool, a), RCS_POOL_INVALID_PARAM);
+    EXPECT_EQ(RcsPoolGetFree(pool), blockCount - 1);
+
+    std::set<void*> blocks = {b};
+    for (size_t i = 1; i < blockCount; i++) {
+        blocks.insert(RcsPoolAlloc(pool));
+    }
+    EXPECT_EQ(blocks.size(), blockCount);
+    EXPECT_EQ(blocks.count(nullptr), 0u);
+}
+
+// 两个线程同时申请与释放，任何时刻同一块只在一个线程手中
+TEST_F(RcsPoolTest, ConcurrentAllocFree)
+{
+    std::atomic<int> errors{0};
+    auto worker = [&](uint8_t tag) {
+        for (int i = 0; i < 100000; i++) {
+            uint8_t* block = (uint8_t*)RcsPoolAlloc(pool);
+            if (block == nullptr) {
+                continue;
+            }
+            memset(block, tag, blockSize);
+            for (size_t k = 0; k < blockSize; k++) {
+                if (block[k] != tag) {
+                    errors++;
+                    break;
+                }
+            }
+            if (RcsPoolFree(pool, block) != RCS_POOL_OK) {
+                errors++;
+            }
+        }
+    };
+    std::thread a(worker, 0x11), b(worker, 0x22);
+    a.join();
+    b.join();
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_EQ(RcsPoolGetFree(pool), blockCount);
+}
+
+// 动态创建
+TEST_F(RcsPoolTest, DynamicCreate)
+{
+    RcsPool_t dynamic = RcsPoolCreate(3, 2);
+    ASSERT_NE(dynamic, nullptr);
+    void* a = RcsPoolAlloc(dynamic);
+    void* b = RcsPoolAlloc(dynamic);
+    EXPECT_NE(a, nullptr);
+    EXPECT_NE(b, nullptr);
+    EXPECT_EQ(RcsPoolAlloc(dynamic), nullptr);
+    RcsPoolFree(dynamic, a);
+    RcsPoolFree(dynamic, b);
+    RcsPoolDestroy(dynamic);
+}
+
+// 作为FIFO的分配器，反复创建销毁不产生碎片
+TEST_F(RcsPoolTest, FifoAllocator)
+{
+    RcsPool_t fifoPool = RcsPoolCreate(sizeof(RcsFifoHandle_t) + 32, 2);
+    RcsAllocator_t allocator;
+    ASSERT_EQ(RcsPoolGetAllocator(fifoPool, &allocator), RCS_POOL_OK);
+
+    // 超过块大小的FIFO无法创建
+    EXPECT_EQ(RcsFifoCreateWithAllocator(64, &allocator), nullptr);
+
+    for (int round = 0; round < 100; round++) {
+        RcsFifo_t a = RcsFifoCreateWithAllocator(32, &allocator);
+        RcsFifo_t b = RcsFifoCreateWithAllocator(16, &allocator);
+        ASSERT_NE(a, nullptr);
+        ASSERT_NE(b, nullptr);
+        EXPECT_EQ(RcsFifoCreateWithAllocator(8, &allocator), nullptr);
+
+        void* memAcquired[2] = {nullptr};
+        ASSERT_EQ(RcsFifoSendAcquire(a, 31, memAcquired), 31);
+        memset(memAcquired[0], round, 31);
+        ASSERT_EQ(RcsFifoSendComplete(a, (const void**)memAcquired), RCS_FIFO_OK);
+        ASSERT_EQ(RcsFifoRecvAcquire(a, 31, memAcquired), 31);
+        EXPECT_EQ(((uint8_t*)memAcquired[0])[30], (uint8_t)round);
+        RcsFifoRecvComplete(a, (const void**)memAcquired);
+
+        RcsFifoDestroy(a);
+        RcsFifoDestroy(b);
+        EXPECT_EQ(RcsPoolGetFree(fifoPool), 2u);
+    }
+    RcsPoolDestroy(fifoPool);
+}
@@ -0,0 +1,356 @@
+/**
+ * @file byte_scan_test.cpp
+ * @brief 字节查找与行读取器的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "byte_scan.h"
+
+// 逐字节实现的参考模型
+static size_t RefFind(const uint8_t *data, size_t size, const uint8_t *set, size_t count)
+{
+    for (size_t i = 0; i < size; i++) {
+        for (size_t k = 0; k < count; k++) {
+            if (data[i] == set[k]) {
+                return i;
+            }
+        }
+    }
+    return size;
+}
+
+// 测试夹具
+class RcsByteScanTest : public ::testing::Test {
+protected:
+    static constexpr size_t fifoSize = 64;
+    RcsFifo_t fifo;
+    RcsLineReader_t reader;
+    std::mt19937 rng{48};
+
+    void SetUp() override {
+        fifo = RcsFifoCreate(fifoSize);
+        ASSERT_EQ(RcsLineReaderInit(&reader, fifo, '\n', 32), RCS_LINE_OK);
+    }
+
+    void TearDown() override {
+        RcsFifoDestroy(fifo);
+    }
+
+    void Write(const std::string &text) {
+        void *mem[2] = {nullptr, nullptr};
+        int first = RcsFifoSendAcquire(fifo, text.size(), mem);
+        ASSERT_GE(first, 0);
+        memcpy(mem[0], text.data(), (size_t)first);
+        if ((size_t)first < text.size()) {
+            memcpy(mem[1], text.data() + first, text.size() - first);
+        }
+        RcsFifoSendComplete(fifo, (const void **)mem);
+    }
+
+    std::string ReadLine(int *ret) {
+        RcsFifoView_t line;
+        *ret = RcsLineRead(&reader, &line);
+        if (*ret < 0) {
+            return "";
+        }
+        std::string text(line.len[0] + line.len[1], '\0');
+        RcsFifoViewCopy(&line, 0, text.data(), text.size());
+        EXPECT_EQ(RcsLineRelease(&reader), RCS_LINE_OK);
+        return text;
+    }
+};
+
+// 不同长度、起点和集合大小下与参考模型一致，覆盖向量主体、SWAR与逐字节尾部
+TEST_F(RcsByteScanTest, MatchesReference)
+{
+    std::vector<uint8_t> data(600);
+    for (int round = 0; round < 4000; round++) {
+        size_t offset = rng() % 16;
+        size_t size = rng() % (data.size() - offset);
+        size_t count = 1 + rng() % 6;
+        uint8_t set[6];
+        for (size_t k = 0; k < count; k++) {
+            set[k] = (uint8_t)rng();
+        }
+        // 稀疏放置命中，使大多数情况下会走过若干个向量块
+        for (auto &b : data) {
+            b = (uint8_t)rng();
+            while (RefFind(&b, 1, set, count) == 0) {
+                b = (uint8_t)rng();
+            }
+        }
+        if (size > 0 && rng() % 4 != 0) {
+            data[offset + rng() % size] = set[rng() % count];
+        }
+
+        RcsByteSet_t byteSet;
+        ASSERT_EQ(RcsByteSetInit(&byteSet, set, count), RCS_LINE_OK);
+        ASSERT_EQ(RcsMemFindSet(data.data() + offset, size, &byteSet), RefFind(data.data() + offset, size, set, count));
+        ASSERT_EQ(RcsMemFindByte(data.data() + offset, size, set[0]), RefFind(data.data() + offset, size, set, 1));
+    }
+}
+
+// 命中位于每个位置，包括首字节和末字节
+TEST_F(RcsByteScanTest, EveryPosition)
+{
+    std::vector<uint8_t> data(130, 'a');
+    for (size_t pos = 0; pos < data.size(); pos++) {
+        data[pos] = '\n';
+        ASSERT_EQ(RcsMemFindByte(data.data(), data.size(), '\n'), pos);
+        ASSERT_EQ(RcsMemFindByte(data.data(), pos, '\n'), pos);
+        data[pos] = 'a';
+    }
+    EXPECT_EQ(RcsMemFindByte(data.data(), data.size(), '\n'), data.size());
+    EXPECT_EQ(RcsMemFindByte(nullptr, 0, '\n'), 0u);
+
+    // 0x00与0x80这类边界值
+    data[77] = 0x80;
+    EXPECT_EQ(RcsMemFindByte(data.data(), data.size(), 0x80), 77u);
+    data[5] = 0x00;
+    EXPECT_EQ(RcsMemFindByte(data.data(), data.size(), 0x00), 5u);
+}
+
+// 字节集合去重、参数检查与多字节查找
+TEST_F(RcsByteScanTest, ByteSetInit)
+{
+    RcsByteSet_t set;
+    EXPECT_EQ(RcsByteSetInit(&set, "\r\n\r\n", 4), RCS_LINE_OK);
+    EXPECT_EQ(set.count, 2);
+    EXPECT_EQ(RcsByteSetInit(&set, "", 0), RCS_LINE_INVALID_PARAM);
+    EXPECT_EQ(RcsByteSetInit(nullptr, "a", 1), RCS_LINE_INVALID_PARAM);
+
+    const char *text = "$GPGGA,123519.00,4807.038,N*47";
+    ASSERT_EQ(RcsByteSetInit(&set, ",*", 2), RCS_LINE_OK);
+    EXPECT_EQ(RcsMemFindSet(text, strlen(text), &set), 6u);
+    EXPECT_EQ(RcsMemFindSet(text + 7, strlen(text) - 7, &set), 9u);
+}
+
+// 跨越回绕的两段视图上查找
+TEST_F(RcsByteScanTest, ViewAcrossWrap)
+{
+    uint8_t a[20], b[20];
+    memset(a, 'x', sizeof(a));
+    memset(b, 'y', sizeof(b));
+    void *mem[2] = {a, b};
+    RcsFifoView_t view;
+    RcsFifoViewInit(&view, mem, sizeof(a), sizeof(a) + sizeof(b));
+
+    EXPECT_EQ(RcsFifoViewFindByte(&view, 0, 'y'), 20u);
+    EXPECT_EQ(RcsFifoViewFindByte(&view, 25, 'y'), 25u);
+    EXPECT_EQ(RcsFifoViewFindByte(&view, 0, 'z'), 40u);
+    EXPECT_EQ(RcsFifoViewFindByte(&view, 40, 'x'), 40u);
+
+    a[19] = 'z';
+    b[3] = 'z';
+    EXPECT_EQ(RcsFifoViewFindByte(&view, 0, 'z'), 19u);
+    EXPECT_EQ(RcsFifoViewFindByte(&view, 20, 'z'), 23u);
+
+    RcsByteSet_t set;
+    RcsByteSetInit(&set, "qz", 2);
+    EXPECT_EQ(RcsFifoViewFindSet(&view, 19, &set), 19u);
+    EXPECT_EQ(RcsFifoViewFindSet(&view, 20, &set), 23u);
+}
+
+// CRLF与LF混合，行内容不含行尾
+TEST_F(RcsByteScanTest, LineReaderBasic)
+{
+    int ret;
+    Write("AT\r\nOK\n\r\n");
+    EXPECT_EQ(ReadLine(&ret), "AT");
+    EXPECT_EQ(ret, 2);
+    EXPECT_EQ(ReadLine(&ret), "OK");
+    EXPECT_EQ(ReadLine(&ret), "");
+    EXPECT_EQ(ret, 0);
+    ReadLine(&ret);
+    EXPECT_EQ(ret, RCS_LINE_NONE);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+    EXPECT_EQ(RcsLineRelease(&reader), RCS_LINE_INVALID_PARAM);
+}
+
+// 分多次到达的行，未完成部分不重复扫描
+TEST_F(RcsByteScanTest, LineReaderPartial)
+{
+    int ret;
+    Write("+CSQ: ");
+    ReadLine(&ret);
+    EXPECT_EQ(ret, RCS_LINE_NONE);
+    EXPECT_EQ(reader.scanned, 6u);
+    Write("21,99\r");
+    ReadLine(&ret);
+    EXPECT_EQ(ret, RCS_LINE_NONE);
+    Write("\nOK");
+    EXPECT_EQ(ReadLine(&ret), "+CSQ: 21,99");
+    EXPECT_EQ(reader.scanned, 0u);
+    ReadLine(&ret);
+    EXPECT_EQ(ret, RCS_LINE_NONE);
+    Write("\n");
+    EXPECT_EQ(ReadLine(&ret), "OK");
+}
+
+// 超长行被丢弃，之后的行正常读出
+TEST_F(RcsByteScanTest, LineReaderTooLong)
+{
+    int ret;
+    Write(std::string(40, 'a'));
+    ReadLine(&ret);
+    EXPECT_EQ(ret, RCS_LINE_TOO_LONG);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+    Write("aaa\n");
+
+    // 恰好为最大行长的行可以读出
+    Write(std::string(32, 'b') + "\r\n");
+    EXPECT_EQ(ReadLine(&ret), std::string(32, 'b'));
+
+    Write(std::string(33, 'c') + "\nnext\n");
+    ReadLine(&ret);
+    EXPECT_EQ(ret, RCS_LINE_TOO_LONG);
+    EXPECT_EQ(ReadLine(&ret), "next");
+
+    EXPECT_EQ(RcsLineReaderInit(&reader, fifo, '\n', fifoSize - 1), RCS_LINE_INVALID_PARAM);
+}
+
+// 超长行在分隔符到达前被丢弃时，其余部分不会被当作新的一行读出
+TEST_F(RcsByteScanTest, LineReaderTooLongTail)
+{
+    int ret;
+    ASSERT_EQ(RcsLineReaderInit(&reader, fifo, '\n', 16), RCS_LINE_OK);
+    Write(std::string(24, 'A'));
+    ReadLine(&ret);
+    EXPECT_EQ(ret, RCS_LINE_TOO_LONG);
+
+    // 剩余部分分多次到达，都被静默丢弃
+    Write(std::string(30, 'A'));
+    ReadLine(&ret);
+    EXPECT_EQ(ret, RCS_LINE_NONE);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+    Write("TAIL\nOK");
+    ReadLine(&ret);
+    EXPECT_EQ(ret, RCS_LINE_NONE);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 2u);
+    Write("\r\n");
+    EXPECT_EQ(ReadLine(&ret), "OK");
+
+    // 分隔符与下一行同时到达
+    Write(std::string(20, 'B'));
+    ReadLine(&ret);
+    EXPECT_EQ(ret, RCS_LINE_TOO_LONG);
+    Write("BB\nnext\n");
+    EXPECT_EQ(ReadLine(&ret), "next");
+}
+
+// 随机切分的数据流跨越回绕，逐行内容与写入一致
+TEST_F(RcsByteScanTest, LineReaderStreaming)
+{
+    std::vector<std::string> lines, got;
+    std::string pending;
+    for (int i = 0; i < 500; i++) {
+        std::string line;
+        size_t len = rng() % 30;
+        for (size_t k = 0; k < len; k++) {
+            line += (char)('A' + rng() % 26);
+        }
+        lines.push_back(line);
+        pending += line + ((rng() % 2) ? "\r\n" : "\n");
+    }
+
+    size_t pos = 0;
+    while (got.size() < lines.size()) {
+        size_t chunk = std::min<size_t>(1 + rng() % 20, pending.size() - pos);
+        if (chunk > 0 && RcsFifoGetFree(fifo) >= chunk) {
+            Write(pending.substr(pos, chunk));
+            pos += chunk;
+        }
+        int ret;
+        std::string text = ReadLine(&ret);
+        ASSERT_NE(ret, RCS_LINE_TOO_LONG);
+        if (ret >= 0) {
+            got.push_back(text);
+        }
+    }
+    EXPECT_EQ(got, lines);
+}
+
+// 模拟循环DMA的写位置
+static size_t LinePos(void *arg)
+{
+    return *(size_t *)arg;
+}
+
+// 未完成的行被覆盖丢弃后，不再从旧的扫描偏移继续查找
+TEST_F(RcsByteScanTest, LineReaderAfterOverrun)
+{
+    RcsFifoHandle_t handle;
+    uint8_t memory[fifoSize];
+    size_t pos = 0;
+    auto dmaWrite = [&](const std::string &text) {
+        for (char c : text) {
+            memory[pos++ % fifoSize] = (uint8_t)c;
+        }
+    };
+    RcsFifo_t dmaFifo = RcsFifoCreateStatic(fifoSize, &handle, memory);
+    ASSERT_EQ(RcsFifoSetPosSource(dmaFifo, LinePos, &pos), RCS_FIFO_OK);
+    ASSERT_EQ(RcsLineReaderInit(&reader, dmaFifo, '\n', 32), RCS_LINE_OK);
+    RcsFifoView_t line;
+    char text[32];
+
+    // 覆盖后到达的数据少于已扫描的偏移
+    dmaWrite("+CSQ: 21,99");
+    EXPECT_EQ(RcsLineRead(&reader, &line), RCS_LINE_NONE);
+    EXPECT_EQ(reader.scanned, 11u);
+    dmaWrite(std::string(60, 'x'));
+    EXPECT_EQ(RcsFifoPosUpdate(dmaFifo), RCS_FIFO_OVERRUN);
+    dmaWrite("OK\n");
+    ASSERT_EQ(RcsLineRead(&reader, &line), 2);
+    RcsFifoViewCopy(&line, 0, text, 2);
+    EXPECT_EQ(std::string(text, 2), "OK");
+    ASSERT_EQ(RcsLineRelease(&reader), RCS_LINE_OK);
+
+    // 覆盖后到达的数据多于已扫描的偏移，分隔符位于旧偏移之前
+    dmaWrite("+CREG: 0,1");
+    EXPECT_EQ(RcsLineRead(&reader, &line), RCS_LINE_NONE);
+    EXPECT_EQ(reader.scanned, 10u);
+    dmaWrite(std::string(60, 'x'));
+    EXPECT_EQ(RcsFifoPosUpdate(dmaFifo), RCS_FIFO_OVERRUN);
+    dmaWrite("RING\r\nNO CARRIER");
+    ASSERT_EQ(RcsLineRead(&reader, &line), 4);
+    RcsFifoViewCopy(&line, 0, text, 4);
+    EXPECT_EQ(std::string(text, 4), "RING");
+    ASSERT_EQ(RcsLineRelease(&reader), RCS_LINE_OK);
+    EXPECT_EQ(RcsFifoGetOverrunCount(dmaFifo), 2u);
+}
+
+// 吞吐量测试，仅在make bench时运行
+TEST_F(RcsByteScanTest, DISABLED_Throughput)
+{
+    std::vector<uint8_t> big(1 << 20, 'a');
+    big.back() = '\n';
+
+    const int rounds = 256;
+    size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        found += RcsMemFindByte(big.data(), big.size(), '\n');
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(found, rounds * (big.size() - 1));
+    printf("byte scan: %.1f MB/s\n", rounds * big.size() / seconds / 1e6);
+
+    RcsByteSet_t set;
+    RcsByteSetInit(&set, "\r\n,*", 4);
+    found = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        found += RcsMemFindSet(big.data(), big.size(), &set);
+    }
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(found, rounds * (big.size() - 1));
+    printf("byte set scan: %.1f MB/s\n", rounds * big.size() / seconds / 1e6);
+}
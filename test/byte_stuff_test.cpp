@@ -0,0 +1,185 @@
+/**
+ * @file byte_stuff_test.cpp
+ * @brief COBS与SLIP编解码的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <random>
+#include <vector>
+
+#include "byte_stuff.h"
+
+// 取出FIFO中的全部数据
+static std::vector<uint8_t> DrainFifo(RcsFifo_t fifo)
+{
+    std::vector<uint8_t> out(RcsFifoGetUsed(fifo));
+    if (out.empty()) {
+        return out;
+    }
+    void *memAcquired[2] = {nullptr};
+    int first = RcsFifoRecvAcquire(fifo, out.size(), memAcquired);
+    RcsFifoView_t view;
+    RcsFifoViewInit(&view, memAcquired, first, out.size());
+    RcsFifoViewCopy(&view, 0, out.data(), out.size());
+    RcsFifoRecvComplete(fifo, (const void **)memAcquired);
+    return out;
+}
+
+// 测试夹具
+class RcsByteStuffTest : public ::testing::Test {
+protected:
+    static constexpr size_t fifoSize = 64;
+    RcsFifoHandle_t fifoHandle;
+    uint8_t fifoMemory[fifoSize];
+    RcsFifo_t fifo;
+    RcsStuffDecoder_t decoder;
+    uint8_t decoded[300];
+
+    void SetUp() override {
+        fifo = RcsFifoCreateStatic(fifoSize, &fifoHandle, fifoMemory);
+        RcsStuffDecoderInit(&decoder, decoded, sizeof(decoded));
+    }
+
+    std::vector<uint8_t> cobs(std::vector<uint8_t> data) {
+        RcsFifo_t big = RcsFifoCreate(1024);
+        int n = RcsCobsEncodeToFifo(big, data.data(), data.size());
+        std::vector<uint8_t> out = DrainFifo(big);
+        EXPECT_EQ(n, (int)out.size());
+        RcsFifoDestroy(big);
+        return out;
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsByteStuffTest, InvalidParam)
+{
+    size_t consumed;
+    RcsFifoView_t view = {};
+    EXPECT_EQ(RcsCobsEncodeToFifo(NULL, decoded, 1), RCS_STUFF_INVALID_PARAM);
+    EXPECT_EQ(RcsSlipEncodeToFifo(fifo, NULL, 1), RCS_STUFF_INVALID_PARAM);
+    EXPECT_EQ(RcsStuffDecoderInit(&decoder, NULL, 1), RCS_STUFF_INVALID_PARAM);
+    EXPECT_EQ(RcsCobsDecode(&decoder, &view, NULL), RCS_STUFF_INVALID_PARAM);
+    EXPECT_EQ(RcsSlipDecode(&decoder, &view, &consumed), RCS_STUFF_OK);
+    // 最坏长度放不下时不写入任何数据
+    EXPECT_EQ(RcsSlipEncodeToFifo(fifo, decoded, 40), RCS_STUFF_NO_SPACE);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+}
+
+// COBS标准向量
+TEST_F(RcsByteStuffTest, CobsVectors)
+{
+    EXPECT_EQ(cobs({0x00}), std::vector<uint8_t>({0x01, 0x01, 0x00}));
+    EXPECT_EQ(cobs({0x00, 0x00}), std::vector<uint8_t>({0x01, 0x01, 0x01, 0x00}));
+    EXPECT_EQ(cobs({0x11, 0x22, 0x00, 0x33}), std::vector<uint8_t>({0x03, 0x11, 0x22, 0x02, 0x33, 0x00}));
+    EXPECT_EQ(cobs({0x11, 0x22, 0x33, 0x44}), std::vector<uint8_t>({0x05, 0x11, 0x22, 0x33, 0x44, 0x00}));
+    EXPECT_EQ(cobs({}), std::vector<uint8_t>({0x01, 0x00}));
+
+    std::vector<uint8_t> run254(254);
+    for (size_t i = 0; i < run254.size(); i++) {
+        run254[i] = (uint8_t)(i + 1);
+    }
+    std::vector<uint8_t> encoded = cobs(run254);
+    ASSERT_EQ(encoded.size(), 256u);
+    EXPECT_EQ(encoded.front(), 0xFF);
+    EXPECT_EQ(encoded.back(), 0x00);
+
+    run254.push_back(0xFF);
+    encoded = cobs(run254);
+    ASSERT_EQ(encoded.size(), 258u);
+    EXPECT_EQ(encoded[255], 0x02);
+}
+
+// SLIP转义
+TEST_F(RcsByteStuffTest, SlipVector)
+{
+    const uint8_t data[] = {RCS_SLIP_END, RCS_SLIP_ESC, 0x01};
+    ASSERT_EQ(RcsSlipEncodeToFifo(fifo, data, sizeof(data)), 7);
+    EXPECT_EQ(DrainFifo(fifo), std::vector<uint8_t>({0xC0, 0xDB, 0xDC, 0xDB, 0xDD, 0x01, 0xC0}));
+}
+
+// 编码跨越缓冲区末尾，解码从FIFO增量进行且只释放消费的字节
+TEST_F(RcsByteStuffTest, RoundTripAcrossWrap)
+{
+    std::mt19937 rng(42);
+    for (int round = 0; round < 200; round++) {
+        std::vector<uint8_t> payload(1 + rng() % 20);   // SLIP的空帧与空闲END无法区分
+        for (auto &byte : payload) {
+            byte = (rng() % 4 == 0) ? 0x00 : (uint8_t)rng();
+        }
+        bool useCobs = round % 2 == 0;
+        int n = useCobs ? RcsCobsEncodeToFifo(fifo, payload.data(), payload.size())
+                        : RcsSlipEncodeToFifo(fifo, payload.data(), payload.size());
+        ASSERT_GT(n, 0);
+        ASSERT_EQ(RcsFifoGetUsed(fifo), (size_t)n);
+
+        int ret = useCobs ? RcsCobsDecodeFromFifo(&decoder, fifo) : RcsSlipDecodeFromFifo(&decoder, fifo);
+        ASSERT_EQ(ret, RCS_STUFF_FRAME);
+        ASSERT_EQ(std::vector<uint8_t>(decoded, decoded + decoder.len), payload);
+        ASSERT_EQ(RcsFifoGetUsed(fifo), 0u);
+    }
+}
+
+// 一帧分多次到达，以及多帧连在一起
+TEST_F(RcsByteStuffTest, IncrementalDecode)
+{
+    const uint8_t a[] = {0x01, 0x00, 0x02};
+    const uint8_t b[] = {0xAA};
+    RcsCobsEncodeToFifo(fifo, a, sizeof(a));
+    RcsCobsEncodeToFifo(fifo, b, sizeof(b));
+    std::vector<uint8_t> stream = DrainFifo(fifo);
+
+    // 逐字节喂入
+    std::vector<std::vector<uint8_t>> frames;
+    for (uint8_t byte : stream) {
+        RcsFifoView_t view = {{&byte, NULL}, {1, 0}};
+        size_t consumed = 0;
+        if (RcsCobsDecode(&decoder, &view, &consumed) == RCS_STUFF_FRAME) {
+            frames.emplace_back(decoded, decoded + decoder.len);
+        }
+        EXPECT_EQ(consumed, 1u);
+    }
+    ASSERT_EQ(frames.size(), 2u);
+    EXPECT_EQ(frames[0], std::vector<uint8_t>(a, a + sizeof(a)));
+    EXPECT_EQ(frames[1], std::vector<uint8_t>(b, b + sizeof(b)));
+
+    // 两帧一起在FIFO中：第一次只消费第一帧
+    RcsCobsEncodeToFifo(fifo, a, sizeof(a));
+    RcsCobsEncodeToFifo(fifo, b, sizeof(b));
+    ASSERT_EQ(RcsCobsDecodeFromFifo(&decoder, fifo), RCS_STUFF_FRAME);
+    EXPECT_EQ(decoder.len, sizeof(a));
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 3u);
+    ASSERT_EQ(RcsCobsDecodeFromFifo(&decoder, fifo), RCS_STUFF_FRAME);
+    EXPECT_EQ(decoder.len, sizeof(b));
+    EXPECT_EQ(RcsCobsDecodeFromFifo(&decoder, fifo), RCS_STUFF_OK);
+}
+
+// 超长帧、截断帧与非法转义被丢弃，后续帧不受影响
+TEST_F(RcsByteStuffTest, BadFrames)
+{
+    uint8_t small[4];
+    RcsStuffDecoder_t smallDecoder;
+    RcsStuffDecoderInit(&smallDecoder, small, sizeof(small));
+    const uint8_t longData[] = {1, 2, 3, 4, 5};
+    const uint8_t okData[] = {7, 8};
+
+    RcsCobsEncodeToFifo(fifo, longData, sizeof(longData));
+    RcsCobsEncodeToFifo(fifo, okData, sizeof(okData));
+    EXPECT_EQ(RcsCobsDecodeFromFifo(&smallDecoder, fifo), RCS_STUFF_BAD_FRAME);
+    ASSERT_EQ(RcsCobsDecodeFromFifo(&smallDecoder, fifo), RCS_STUFF_FRAME);
+    EXPECT_EQ(smallDecoder.len, 2u);
+
+    // 编码字节声明的长度超过实际数据
+    const uint8_t truncated[] = {0x05, 0x11, 0x00};
+    RcsFifoView_t view = {{truncated, NULL}, {sizeof(truncated), 0}};
+    size_t consumed;
+    EXPECT_EQ(RcsCobsDecode(&decoder, &view, &consumed), RCS_STUFF_BAD_FRAME);
+
+    const uint8_t badEscape[] = {0xC0, 0x01, 0xDB, 0x02, 0xC0};
+    view = {{badEscape, NULL}, {sizeof(badEscape), 0}};
+    EXPECT_EQ(RcsSlipDecode(&decoder, &view, &consumed), RCS_STUFF_BAD_FRAME);
+    EXPECT_EQ(consumed, sizeof(badEscape));
+    RcsSlipEncodeToFifo(fifo, okData, sizeof(okData));
+    EXPECT_EQ(RcsSlipDecodeFromFifo(&decoder, fifo), RCS_STUFF_FRAME);
+}
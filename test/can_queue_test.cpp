@@ -0,0 +1,219 @@
+/**
+ * @file can_queue_test.cpp
+ * @brief CAN帧队列的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "can_queue.h"
+
+// 测试夹具
+class RcsCanQueueTest : public ::testing::Test {
+protected:
+    static constexpr size_t depth = 8;
+    RcsCanQueueHandle_t handle;
+    alignas(4) uint8_t memory[RCS_CAN_QUEUE_MEM_SIZE(depth, RCS_CAN_SLOT_CLASSIC)];
+    RcsCanQueue_t queue;
+
+    void SetUp() override {
+        queue = RcsCanQueueCreateStatic(depth, RCS_CAN_SLOT_CLASSIC, &handle, memory);
+    }
+
+    static RcsCanFrame_t MakeFrame(uint32_t id, uint16_t timestamp)
+    {
+        RcsCanFrame_t frame = {};
+        frame.id = id;
+        frame.timestamp = timestamp;
+        frame.len = 8;
+        for (int i = 0; i < 8; i++) {
+            frame.data[i] = (uint8_t)(id + i);
+        }
+        return frame;
+    }
+};
+
+static void CollectIds(const RcsCanFrame_t *frame, void *arg)
+{
+    ((std::vector<uint32_t> *)arg)->push_back(frame->id);
+}
+
+// 帧布局
+TEST_F(RcsCanQueueTest, FrameLayout)
+{
+    EXPECT_EQ(sizeof(RcsCanFrame_t), 16u);
+    EXPECT_EQ(sizeof(RcsCanFdFrame_t), 72u);
+    EXPECT_EQ(offsetof(RcsCanFdFrame_t, data), offsetof(RcsCanFrame_t, data));
+}
+
+// 参数不合适测试
+TEST_F(RcsCanQueueTest, InvalidParam)
+{
+    RcsCanQueueHandle_t other;
+    ASSERT_NE(queue, nullptr);
+    EXPECT_EQ(RcsCanQueueCreateStatic(0, RCS_CAN_SLOT_CLASSIC, &other, memory), nullptr);
+    EXPECT_EQ(RcsCanQueueCreateStatic(6, RCS_CAN_SLOT_CLASSIC, &other, memory), nullptr);
+    EXPECT_EQ(RcsCanQueueCreateStatic(depth, 20, &other, memory), nullptr);
+    EXPECT_EQ(RcsCanQueueCreateStatic(depth, RCS_CAN_SLOT_CLASSIC, &other, memory + 1), nullptr);
+    EXPECT_EQ(RcsCanQueueCreate(3, RCS_CAN_SLOT_FD), nullptr);
+
+    RcsCanFrame_t frame = MakeFrame(1, 0);
+    frame.len = 9;
+    EXPECT_EQ(RcsCanQueuePush(queue, &frame), RCS_CAN_INVALID_PARAM);
+    EXPECT_EQ(RcsCanQueuePush(queue, NULL), RCS_CAN_INVALID_PARAM);
+    EXPECT_EQ(RcsCanQueueDrain(queue, NULL, NULL), 0u);
+}
+
+// 满队列时丢弃新帧并计数
+TEST_F(RcsCanQueueTest, FullAndOverrun)
+{
+    for (uint32_t i = 0; i < depth; i++) {
+        RcsCanFrame_t frame = MakeFrame(i, (uint16_t)i);
+        EXPECT_EQ(RcsCanQueuePush(queue, &frame), RCS_CAN_OK);
+    }
+    EXPECT_EQ(RcsCanQueueGetCount(queue), depth);
+
+    RcsCanFrame_t frame = MakeFrame(100, 0);
+    EXPECT_EQ(RcsCanQueuePush(queue, &frame), RCS_CAN_FULL);
+    EXPECT_EQ(RcsCanQueuePushAcquire(queue), nullptr);
+    EXPECT_EQ(RcsCanQueueGetOverrun(queue), 2u);
+
+    std::vector<uint32_t> ids;
+    EXPECT_EQ(RcsCanQueueDrain(queue, CollectIds, &ids), depth);
+    EXPECT_THAT(ids, ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7));
+    EXPECT_EQ(RcsCanQueueGetCount(queue), 0u);
+}
+
+// 中断风格的原地入队
+TEST_F(RcsCanQueueTest, PushInPlace)
+{
+    RcsCanFrame_t *slot = RcsCanQueuePushAcquire(queue);
+    ASSERT_NE(slot, nullptr);
+    slot->id = 0x123 | 0x10000000;
+    slot->flags = RCS_CAN_FLAG_EXT;
+    slot->timestamp = 0xBEEF;
+    slot->len = 2;
+    slot->data[0] = 0xAA;
+    slot->data[1] = 0x55;
+    EXPECT_EQ(RcsCanQueueGetCount(queue), 0u);
+    RcsCanQueuePushCommit(queue);
+    EXPECT_EQ(RcsCanQueueGetCount(queue), 1u);
+
+    const RcsCanFrame_t *frames = NULL;
+    ASSERT_EQ(RcsCanQueueRecvAcquire(queue, &frames), 1u);
+    EXPECT_EQ(frames[0].id, 0x10000123u);
+    EXPECT_EQ(frames[0].flags, RCS_CAN_FLAG_EXT);
+    EXPECT_EQ(frames[0].timestamp, 0xBEEF);
+    EXPECT_EQ(frames[0].data[1], 0x55);
+    RcsCanQueueRecvComplete(queue, 1);
+    EXPECT_EQ(RcsCanQueueGetCount(queue), 0u);
+}
+
+// 回绕时批量取出分两次进行
+TEST_F(RcsCanQueueTest, RecvAcquireAcrossWrap)
+{
+    for (uint32_t i = 0; i < 6; i++) {
+        RcsCanFrame_t frame = MakeFrame(i, 0);
+        ASSERT_EQ(RcsCanQueuePush(queue, &frame), RCS_CAN_OK);
+    }
+    const RcsCanFrame_t *frames = NULL;
+    ASSERT_EQ(RcsCanQueueRecvAcquire(queue, &frames), 6u);
+    RcsCanQueueRecvComplete(queue, 6);
+
+    for (uint32_t i = 6; i < 12; i++) {
+        RcsCanFrame_t frame = MakeFrame(i, 0);
+        ASSERT_EQ(RcsCanQueuePush(queue, &frame), RCS_CAN_OK);
+    }
+    ASSERT_EQ(RcsCanQueueRecvAcquire(queue, &frames), 2u);
+    EXPECT_EQ(frames[0].id, 6u);
+    EXPECT_EQ(frames[1].id, 7u);
+    RcsCanQueueRecvComplete(queue, 2);
+    ASSERT_EQ(RcsCanQueueRecvAcquire(queue, &frames), 4u);
+    EXPECT_EQ(frames[0].id, 8u);
+    EXPECT_EQ(frames[3].id, 11u);
+    EXPECT_EQ(frames[3].data[7], (uint8_t)(11 + 7));
+    RcsCanQueueRecvComplete(queue, 4);
+    EXPECT_EQ(RcsCanQueueRecvAcquire(queue, &frames), 0u);
+}
+
+// CAN-FD队列与DLC换算
+TEST_F(RcsCanQueueTest, FdFrames)
+{
+    RcsCanQueue_t fdQueue = RcsCanQueueCreate(4, RCS_CAN_SLOT_FD);
+    ASSERT_NE(fdQueue, nullptr);
+
+    RcsCanFdFrame_t frame = {};
+    frame.id = 0x7FF;
+    frame.flags = RCS_CAN_FLAG_FDF | RCS_CAN_FLAG_BRS;
+    frame.len = 64;
+    for (int i = 0; i < 64; i++) {
+        frame.data[i] = (uint8_t)i;
+    }
+    EXPECT_EQ(RcsCanQueuePush(fdQueue, (const RcsCanFrame_t *)&frame), RCS_CAN_OK);
+    frame.len = 65;
+    EXPECT_EQ(RcsCanQueuePush(fdQueue, (const RcsCanFrame_t *)&frame), RCS_CAN_INVALID_PARAM);
+
+    const RcsCanFrame_t *frames = NULL;
+    ASSERT_EQ(RcsCanQueueRecvAcquire(fdQueue, &frames), 1u);
+    const RcsCanFdFrame_t *fd = (const RcsCanFdFrame_t *)frames;
+    EXPECT_EQ(fd->len, 64);
+    EXPECT_EQ(fd->data[63], 63);
+    RcsCanQueueRecvComplete(fdQueue, 1);
+    RcsCanQueueDestroy(fdQueue);
+
+    EXPECT_EQ(RcsCanDlcToLen(8), 8);
+    EXPECT_EQ(RcsCanDlcToLen(9), 12);
+    EXPECT_EQ(RcsCanDlcToLen(15), 64);
+    EXPECT_EQ(RcsCanLenToDlc(8), 8);
+    EXPECT_EQ(RcsCanLenToDlc(13), 10);
+    EXPECT_EQ(RcsCanLenToDlc(64), 15);
+}
+
+// 一个线程模拟接收中断，另一个线程批量取出，帧序与内容不得出错
+TEST_F(RcsCanQueueTest, ConcurrentSpsc)
+{
+    RcsCanQueue_t big = RcsCanQueueCreate(64, RCS_CAN_SLOT_CLASSIC);
+    ASSERT_NE(big, nullptr);
+    const uint32_t total = 50000;
+
+    std::thread producer([&] {
+        uint32_t id = 0;
+        while (id < total) {
+            RcsCanFrame_t *slot = RcsCanQueuePushAcquire(big);
+            if (slot == NULL) {
+                std::this_thread::yield();
+                continue;
+            }
+            *slot = MakeFrame(id, (uint16_t)id);
+            RcsCanQueuePushCommit(big);
+            id++;
+        }
+    });
+
+    uint32_t expect = 0;
+    bool ok = true;
+    while (expect < total) {
+        const RcsCanFrame_t *frames = NULL;
+        size_t count = RcsCanQueueRecvAcquire(big, &frames);
+        if (count == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (size_t i = 0; i < count; i++, expect++) {
+            if (frames[i].id != expect || frames[i].timestamp != (uint16_t)expect ||
+                frames[i].data[7] != (uint8_t)(expect + 7)) {
+                ok = false;
+            }
+        }
+        RcsCanQueueRecvComplete(big, count);
+    }
+    producer.join();
+
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(RcsCanQueueGetCount(big), 0u);
+    RcsCanQueueDestroy(big);
+}
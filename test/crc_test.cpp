@@ -0,0 +1,164 @@
+/**
+ * @file crc_test.cpp
+ * @brief CRC模块的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "crc.h"
+
+// 逐位实现的参考模型
+static uint32_t RefCrc32(const uint8_t *data, size_t size)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+        }
+    }
+    return ~crc;
+}
+
+// CRC16逐位实现的参考模型
+static uint16_t RefCrc16(const uint8_t *data, size_t size)
+{
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= (uint16_t)(data[i] << 8);
+        for (int b = 0; b < 8; b++) {
+            crc = (uint16_t)((crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1);
+        }
+    }
+    return crc;
+}
+
+// 测试夹具
+class RcsCrcTest : public ::testing::Test {
+protected:
+    std::vector<uint8_t> data;
+    std::mt19937 rng{20261018};
+
+    void SetUp() override {
+        data.resize(4096 + 64);
+        for (auto &b : data) {
+            b = (uint8_t)rng();
+        }
+    }
+};
+
+// 标准校验串的校验值测试
+TEST_F(RcsCrcTest, CheckValues)
+{
+    const char *check = "123456789";
+    EXPECT_EQ(RcsCrc8Update(RCS_CRC8_INIT, check, 9), 0xF4);
+    EXPECT_EQ(RcsCrc16Update(RCS_CRC16_INIT, check, 9), 0x29B1);
+    EXPECT_EQ(RcsCrc32Update(RCS_CRC32_INIT, check, 9), 0xCBF43926u);
+
+    // 空数据不改变结果
+    EXPECT_EQ(RcsCrc32Update(RCS_CRC32_INIT, nullptr, 0), 0u);
+    EXPECT_EQ(RcsCrc16Update(0x1234, nullptr, 0), 0x1234);
+}
+
+// CRC32的字节尾、slice-by-8与PCLMUL折叠在各种长度和不对齐起点下与逐位实现一致
+TEST_F(RcsCrcTest, Crc32MatchesReference)
+{
+    for (size_t size = 0; size <= 300; size++) {
+        size_t offset = rng() % 16;
+        ASSERT_EQ(RcsCrc32Update(RCS_CRC32_INIT, data.data() + offset, size),
+                  RefCrc32(data.data() + offset, size)) << "size=" << size << " offset=" << offset;
+    }
+    for (int i = 0; i < 200; i++) {
+        size_t size = rng() % 4096;
+        size_t offset = rng() % 64;
+        ASSERT_EQ(RcsCrc32Update(RCS_CRC32_INIT, data.data() + offset, size),
+                  RefCrc32(data.data() + offset, size)) << "size=" << size << " offset=" << offset;
+    }
+}
+
+// CRC16的slice-by-8主体与逐字节尾部在各种长度和不对齐起点下与逐位实现一致
+TEST_F(RcsCrcTest, Crc16MatchesReference)
+{
+    for (size_t size = 0; size <= 300; size++) {
+        size_t offset = rng() % 16;
+        ASSERT_EQ(RcsCrc16Update(RCS_CRC16_INIT, data.data() + offset, size),
+                  RefCrc16(data.data() + offset, size)) << "size=" << size << " offset=" << offset;
+    }
+}
+
+// 分段增量计算与一次性计算结果一致
+TEST_F(RcsCrcTest, IncrementalEqualsOneShot)
+{
+    for (int i = 0; i < 200; i++) {
+        size_t size = rng() % 2048;
+        size_t cut = size ? rng() % size : 0;
+        const uint8_t *p = data.data();
+
+        uint32_t c32 = RcsCrc32Update(RCS_CRC32_INIT, p, cut);
+        EXPECT_EQ(RcsCrc32Update(c32, p + cut, size - cut), RcsCrc32Update(RCS_CRC32_INIT, p, size));
+        uint16_t c16 = RcsCrc16Update(RCS_CRC16_INIT, p, cut);
+        EXPECT_EQ(RcsCrc16Update(c16, p + cut, size - cut), RcsCrc16Update(RCS_CRC16_INIT, p, size));
+        uint8_t c8 = RcsCrc8Update(RCS_CRC8_INIT, p, cut);
+        EXPECT_EQ(RcsCrc8Update(c8, p + cut, size - cut), RcsCrc8Update(RCS_CRC8_INIT, p, size));
+    }
+}
+
+// 回绕的FIFO视图与连续数据的结果一致
+TEST_F(RcsCrcTest, WrappedFifoView)
+{
+    RcsFifoHandle_t handle;
+    uint8_t mem[512];
+    RcsFifo_t fifo = RcsFifoCreateStatic(sizeof(mem), &handle, mem);
+    ASSERT_NE(fifo, nullptr);
+
+    for (int round = 0; round < 50; round++) {
+        size_t size = 1 + rng() % 400;
+        const uint8_t *src = data.data() + rng() % 1024;
+
+        void *memAcquired[2] = {nullptr, nullptr};
+        int first = RcsFifoSendAcquire(fifo, size, memAcquired);
+        ASSERT_GT(first, 0);
+        memcpy(memAcquired[0], src, first);
+        if ((size_t)first < size) {
+            memcpy(memAcquired[1], src + first, size - first);
+        }
+        RcsFifoSendComplete(fifo, (const void **)memAcquired);
+
+        first = RcsFifoRecvAcquire(fifo, size, memAcquired);
+        ASSERT_GT(first, 0);
+        RcsFifoView_t view;
+        RcsFifoViewInit(&view, memAcquired, (size_t)first, size);
+        EXPECT_EQ(RcsCrc32View(RCS_CRC32_INIT, &view), RefCrc32(src, size));
+        EXPECT_EQ(RcsCrc16View(RCS_CRC16_INIT, &view), RcsCrc16Update(RCS_CRC16_INIT, src, size));
+        EXPECT_EQ(RcsCrc8View(RCS_CRC8_INIT, &view), RcsCrc8Update(RCS_CRC8_INIT, src, size));
+        RcsFifoRecvComplete(fifo, (const void **)memAcquired);
+    }
+}
+
+// 吞吐量测试，仅在make bench时运行
+TEST_F(RcsCrcTest, DISABLED_Throughput)
+{
+    std::vector<uint8_t> big(1 << 20);
+    for (auto &b : big) {
+        b = (uint8_t)rng();
+    }
+
+    const int rounds = 64;
+    uint32_t crc = RCS_CRC32_INIT;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        crc = RcsCrc32Update(crc, big.data(), big.size());
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("crc32: %.1f MB/s (crc=%08X)\n", rounds * big.size() / seconds / 1e6, crc);
+
+    start = std::chrono::steady_clock::now();
+    uint16_t crc16 = RcsCrc16Update(RCS_CRC16_INIT, big.data(), big.size());
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("crc16: %.1f MB/s (crc=%04X)\n", big.size() / seconds / 1e6, crc16);
+}
@@ -0,0 +1,212 @@
+/**
+ * @file dary_heap_test.cpp
+ * @brief 带索引的d叉堆的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <chrono>
+#include <map>
+#include <random>
+#include <set>
+
+#include "dary_heap.h"
+#include "dary_heap.hpp"
+
+// 测试夹具，叉数作为参数
+class RcsHeapTest : public ::testing::TestWithParam<size_t> {
+protected:
+    static constexpr size_t capacity = 16;
+    RcsHeapHandle_t handle;
+    alignas(uint32_t) uint8_t memory[RCS_HEAP_MEM_SIZE(capacity)];
+    RcsHeap_t heap;
+
+    void SetUp() override {
+        heap = RcsHeapCreateStatic(GetParam(), capacity, &handle, memory);
+    }
+};
+
+// 参数不合适测试
+TEST_P(RcsHeapTest, InvalidParam)
+{
+    RcsHeapHandle_t other;
+    EXPECT_EQ(RcsHeapCreateStatic(1, capacity, &other, memory), nullptr);
+    EXPECT_EQ(RcsHeapCreateStatic(RCS_HEAP_MAX_ARITY + 1, capacity, &other, memory), nullptr);
+    EXPECT_EQ(RcsHeapCreateStatic(2, 0, &other, memory), nullptr);
+    EXPECT_EQ(RcsHeapCreateStatic(2, capacity, &other, memory + 1), nullptr);
+    EXPECT_EQ(RcsHeapPush(heap, capacity, 1), RCS_HEAP_INVALID_PARAM);
+    EXPECT_EQ(RcsHeapPop(heap, NULL, NULL), RCS_HEAP_EMPTY);
+    EXPECT_EQ(RcsHeapRemove(heap, 3), RCS_HEAP_NOT_FOUND);
+    EXPECT_EQ(RcsHeapDecreaseKey(heap, 3, 1), RCS_HEAP_NOT_FOUND);
+
+    EXPECT_EQ(RcsHeapPush(heap, 3, 10), RCS_HEAP_OK);
+    EXPECT_EQ(RcsHeapPush(heap, 3, 5), RCS_HEAP_INVALID_PARAM);
+    EXPECT_EQ(RcsHeapDecreaseKey(heap, 3, 11), RCS_HEAP_INVALID_PARAM);
+}
+
+// 按截止时间调度：降键、删除后出队顺序正确
+TEST_P(RcsHeapTest, DeadlineScheduling)
+{
+    const RcsHeapKey_t deadlines[] = {50, 20, 70, 10, 40, 60, 30};
+    for (uint32_t id = 0; id < 7; id++) {
+        ASSERT_EQ(RcsHeapPush(heap, id, deadlines[id]), RCS_HEAP_OK);
+    }
+    EXPECT_EQ(RcsHeapDecreaseKey(heap, 2, 5), RCS_HEAP_OK);
+    EXPECT_EQ(RcsHeapRemove(heap, 3), RCS_HEAP_OK);
+    EXPECT_FALSE(RcsHeapContains(heap, 3));
+    EXPECT_EQ(RcsHeapUpdate(heap, 1, 65), RCS_HEAP_OK);
+
+    const uint32_t order[] = {2, 6, 4, 0, 5, 1};
+    for (uint32_t expect : order) {
+        uint32_t id;
+        RcsHeapKey_t key;
+        ASSERT_EQ(RcsHeapPop(heap, &id, &key), RCS_HEAP_OK);
+        EXPECT_EQ(id, expect);
+    }
+    EXPECT_EQ(RcsHeapGetCount(heap), 0u);
+}
+
+// 随机操作与std::set对照
+TEST_P(RcsHeapTest, RandomAgainstReference)
+{
+    constexpr uint32_t n = 1000;
+    RcsHeap_t dynamic = RcsHeapCreate(GetParam(), n);
+    ASSERT_NE(dynamic, nullptr);
+    std::set<std::pair<RcsHeapKey_t, uint32_t>> reference;
+    std::map<uint32_t, RcsHeapKey_t> keyOf;
+    std::mt19937 rng(38);
+
+    for (int step = 0; step < 50000; step++) {
+        uint32_t id = rng() % n;
+        RcsHeapKey_t key = rng() % 100000;
+        switch (rng() % 4) {
+        case 0:
+            if (keyOf.count(id) == 0) {
+                ASSERT_EQ(RcsHeapPush(dynamic, id, key), RCS_HEAP_OK);
+                reference.insert({key, id});
+                keyOf[id] = key;
+            }
+            break;
+        case 1:
+            if (keyOf.count(id) != 0) {
+                ASSERT_EQ(RcsHeapUpdate(dynamic, id, key), RCS_HEAP_OK);
+                reference.erase({keyOf[id], id});
+                reference.insert({key, id});
+                keyOf[id] = key;
+            }
+            break;
+        case 2:
+            if (keyOf.count(id) != 0) {
+                ASSERT_EQ(RcsHeapRemove(dynamic, id), RCS_HEAP_OK);
+                reference.erase({keyOf[id], id});
+                keyOf.erase(id);
+            }
+            break;
+        default:
+            if (!reference.empty()) {
+                uint32_t popId;
+                RcsHeapKey_t popKey;
+                ASSERT_EQ(RcsHeapPop(dynamic, &popId, &popKey), RCS_HEAP_OK);
+                ASSERT_EQ(popKey, reference.begin()->first);
+                reference.erase({popKey, popId});
+                keyOf.erase(popId);
+            }
+            break;
+        }
+        ASSERT_EQ(RcsHeapGetCount(dynamic), reference.size());
+    }
+    RcsHeapDestroy(dynamic);
+}
+
+// 每组子节点从组大小的整数倍开始，不跨缓存行
+TEST_P(RcsHeapTest, ChildGroupsAligned)
+{
+    size_t groupBytes = GetParam() * sizeof(RcsHeapEntry_t);
+    for (uint32_t index = 0; index * GetParam() + 1 < capacity; index++) {
+        uintptr_t group = (uintptr_t)&handle.heap[index * GetParam() + 1];
+        EXPECT_EQ(group % groupBytes, 0u);
+        EXPECT_LE(group % RCS_HEAP_CACHE_LINE + groupBytes, (size_t)RCS_HEAP_CACHE_LINE);
+    }
+    EXPECT_LE((uint8_t*)(handle.pos + capacity), memory + sizeof(memory));
+}
+
+INSTANTIATE_TEST_SUITE_P(Arity, RcsHeapTest, ::testing::Values(2, 4));
+
+// 调度器的典型负载：先填满，再反复取出最早的截止时间并以更晚的截止时间重新插入
+// 规模从能放进L1扫到远超末级缓存，观察4叉堆较少的层数何时胜过2叉堆较少的比较
+TEST(RcsHeapThroughput, DISABLED_TwoVersusFourAry)
+{
+    constexpr uint32_t rounds = 1 << 20;
+    for (uint32_t n : {1000u, 10000u, 100000u, 1000000u}) {
+        double nsPerOp[2];
+        for (size_t arity : {2, 4}) {
+            RcsHeap_t heap = RcsHeapCreate(arity, n);
+            ASSERT_NE(heap, nullptr);
+            std::mt19937 rng(38);
+            for (uint32_t id = 0; id < n; id++) {
+                RcsHeapPush(heap, id, rng() % n);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < rounds; i++) {
+                uint32_t id;
+                RcsHeapKey_t key;
+                RcsHeapPop(heap, &id, &key);
+                RcsHeapPush(heap, id, key + 1 + rng() % n);
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            EXPECT_EQ(RcsHeapGetCount(heap), n);
+            nsPerOp[arity == 2 ? 0 : 1] = seconds / rounds * 1e9;
+            RcsHeapDestroy(heap);
+        }
+        printf("dary heap n=%-8u 2-ary %6.1f ns, 4-ary %6.1f ns per pop+push (%.2fx)\n",
+               n, nsPerOp[0], nsPerOp[1], nsPerOp[0] / nsPerOp[1]);
+    }
+}
+
+// 模板版本：最大堆比较器与降键
+TEST(RcsIndexedHeapTest, TemplateVariant)
+{
+    rcs::IndexedHeap<int, 8, 4, std::greater<int>> heap;
+    EXPECT_TRUE(heap.push(0, 10));
+    EXPECT_TRUE(heap.push(1, 30));
+    EXPECT_TRUE(heap.push(2, 20));
+    EXPECT_FALSE(heap.push(2, 5));
+    EXPECT_FALSE(heap.push(8, 5));
+    EXPECT_EQ(heap.top(), 1u);
+
+    // 最大堆中"降键"意为提前，即键变大
+    EXPECT_FALSE(heap.decreaseKey(0, 5));
+    EXPECT_TRUE(heap.decreaseKey(0, 40));
+    EXPECT_EQ(heap.top(), 0u);
+    EXPECT_TRUE(heap.remove(0));
+    EXPECT_TRUE(heap.update(1, 15));
+
+    uint32_t id;
+    int key;
+    ASSERT_TRUE(heap.pop(id, key));
+    EXPECT_EQ(id, 2u);
+    EXPECT_EQ(key, 20);
+    ASSERT_TRUE(heap.pop(id, key));
+    EXPECT_EQ(id, 1u);
+    EXPECT_FALSE(heap.pop(id, key));
+}
+
+// 模板版本的堆排序
+TEST(RcsIndexedHeapTest, TemplateSorts)
+{
+    static rcs::IndexedHeap<uint32_t, 4096, 2> heap;
+    std::mt19937 rng(380);
+    for (uint32_t id = 0; id < 4096; id++) {
+        ASSERT_TRUE(heap.push(id, rng()));
+    }
+    uint32_t prev = 0;
+    uint32_t id;
+    uint32_t key;
+    while (heap.pop(id, key)) {
+        ASSERT_GE(key, prev);
+        prev = key;
+    }
+    EXPECT_TRUE(heap.empty());
+}
@@ -0,0 +1,167 @@
+/**
+ * @file fifo_coro_test.cpp
+ * @brief 环形队列协程等待体的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstring>
+#include <vector>
+
+#include "siso_fifo_coro.hpp"
+
+// 测试夹具
+class RcsFifoCoroTest : public ::testing::Test {
+protected:
+    RcsFifo_t fifo;
+    rcs::FifoRunQueue queue;
+    static constexpr size_t fifoSize = 8;
+
+    void SetUp() override {
+        fifo = RcsFifoCreate(fifoSize);
+    }
+
+    void TearDown() override {
+        RcsFifoDestroy(fifo);
+    }
+};
+
+static void CopyIn(const rcs::FifoBlock &block, const uint8_t *src)
+{
+    size_t first = (size_t)block.first;
+    memcpy(block.mem[0], src, first);
+    if (block.mem[1] != nullptr) {
+        memcpy(block.mem[1], src + first, block.size - first);
+    }
+}
+
+static void CopyOut(const rcs::FifoBlock &block, uint8_t *dst)
+{
+    size_t first = (size_t)block.first;
+    memcpy(dst, block.mem[0], first);
+    if (block.mem[1] != nullptr) {
+        memcpy(dst + first, block.mem[1], block.size - first);
+    }
+}
+
+static rcs::FifoTask Consumer(rcs::CoFifo &fifo, size_t count, std::vector<uint8_t> &out, bool &done)
+{
+    for (size_t i = 0; i < count; i++) {
+        rcs::FifoBlock block = co_await fifo.recv(4);
+        if (!block.ok()) {
+            break;
+        }
+        uint8_t buf[4];
+        CopyOut(block, buf);
+        out.insert(out.end(), buf, buf + 4);
+        fifo.recvComplete(block);
+    }
+    done = true;
+}
+
+static rcs::FifoTask Producer(rcs::CoFifo &fifo, size_t count, bool &done)
+{
+    uint8_t value = 0;
+    for (size_t i = 0; i < count; i++) {
+        rcs::FifoBlock block = co_await fifo.send(3);
+        if (!block.ok()) {
+            break;
+        }
+        uint8_t buf[3] = {value, (uint8_t)(value + 1), (uint8_t)(value + 2)};
+        value += 3;
+        CopyIn(block, buf);
+        fifo.sendComplete(block);
+    }
+    done = true;
+}
+
+// 数据已就绪时不挂起
+TEST_F(RcsFifoCoroTest, ReadyWithoutSuspend)
+{
+    rcs::CoFifo coFifo(fifo, queue);
+    void* memAcquired[2] = {nullptr};
+    ASSERT_EQ(RcsFifoSendAcquire(fifo, 4, memAcquired), 4);
+    memcpy(memAcquired[0], "\x00\x01\x02\x03", 4);
+    ASSERT_EQ(RcsFifoSendComplete(fifo, (const void**)memAcquired), RCS_FIFO_OK);
+
+    std::vector<uint8_t> out;
+    bool done = false;
+    Consumer(coFifo, 1, out, done);
+
+    EXPECT_TRUE(done);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(out, (std::vector<uint8_t>{0, 1, 2, 3}));
+}
+
+// 数据不足时挂起，直到发送完成后由执行器恢复
+TEST_F(RcsFifoCoroTest, SuspendUntilEnoughData)
+{
+    rcs::CoFifo coFifo(fifo, queue);
+    std::vector<uint8_t> out;
+    bool done = false;
+    Consumer(coFifo, 1, out, done);
+    EXPECT_FALSE(done);
+
+    // 只有2字节，不足以唤醒
+    void* memAcquired[2] = {nullptr};
+    ASSERT_EQ(RcsFifoSendAcquire(fifo, 2, memAcquired), 2);
+    RcsFifoSendComplete(fifo, (const void**)memAcquired);
+    EXPECT_TRUE(queue.empty());
+
+    ASSERT_EQ(RcsFifoSendAcquire(fifo, 2, memAcquired), 2);
+    RcsFifoSendComplete(fifo, (const void**)memAcquired);
+    EXPECT_FALSE(queue.empty());
+    EXPECT_FALSE(done);
+
+    EXPECT_EQ(queue.run(), 1u);
+    EXPECT_TRUE(done);
+    EXPECT_EQ(out.size(), 4u);
+}
+
+// 同一FIFO上的第二个CoFifo无法挂接，需要挂起的等待立即失败，析构时也不会注销第一个的钩子
+TEST_F(RcsFifoCoroTest, HookOwnership)
+{
+    rcs::CoFifo coFifo(fifo, queue);
+    EXPECT_TRUE(coFifo.attached());
+    {
+        rcs::CoFifo second(fifo, queue);
+        EXPECT_FALSE(second.attached());
+
+        std::vector<uint8_t> out;
+        bool done = false;
+        Consumer(second, 1, out, done);
+        EXPECT_TRUE(done);
+        EXPECT_TRUE(out.empty());
+        EXPECT_TRUE(queue.empty());
+    }
+
+    std::vector<uint8_t> out;
+    bool done = false;
+    Consumer(coFifo, 1, out, done);
+    void* memAcquired[2] = {nullptr};
+    ASSERT_EQ(RcsFifoSendAcquire(fifo, 4, memAcquired), 4);
+    RcsFifoSendComplete(fifo, (const void**)memAcquired);
+    EXPECT_EQ(queue.run(), 1u);
+    EXPECT_TRUE(done);
+}
+
+// 单线程内生产者与消费者协程交替挂起
+TEST_F(RcsFifoCoroTest, PingPongOnOneThread)
+{
+    rcs::CoFifo coFifo(fifo, queue);
+    std::vector<uint8_t> out;
+    bool consumerDone = false, producerDone = false;
+
+    Consumer(coFifo, 300, out, consumerDone);
+    Producer(coFifo, 400, producerDone);
+    while (queue.run() != 0) {
+    }
+
+    ASSERT_TRUE(consumerDone);
+    ASSERT_TRUE(producerDone);
+    ASSERT_EQ(out.size(), 1200u);
+    for (size_t i = 0; i < out.size(); i++) {
+        ASSERT_EQ(out[i], (uint8_t)i);
+    }
+}
@@ -0,0 +1,232 @@
+/**
+ * @file fifo_dma_test.cpp
+ * @brief 环形队列外部位置源（循环DMA接收）模式的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstring>
+#include <vector>
+
+#include "siso_fifo.h"
+#include "byte_scan.h"
+
+// 模拟循环模式DMA：硬件按顺序写入缓冲区，NDTR从fifoSize递减到1后重装
+typedef struct
+{
+    uint8_t *mem;
+    size_t   size;
+    size_t   ndtr;
+}MockDma_t;
+
+static size_t MockDmaPos(void *arg)
+{
+    MockDma_t *dma = (MockDma_t *)arg;
+    return dma->size - dma->ndtr;
+}
+
+static void CountEvent(RcsFifo_t fifo, int event, void *arg)
+{
+    (void)fifo;
+    if (event == RCS_FIFO_EVENT_SEND_COMPLETE) {
+        (*(int *)arg)++;
+    }
+}
+
+// 测试夹具
+class RcsFifoDmaTest : public ::testing::Test {
+protected:
+    static constexpr size_t fifoSize = 64;
+    RcsFifoHandle_t handle;
+    uint8_t memory[fifoSize];
+    RcsFifo_t fifo;
+    MockDma_t dma;
+    uint8_t next = 0;
+
+    void SetUp() override {
+        fifo = RcsFifoCreateStatic(fifoSize, &handle, memory);
+        dma = {memory, fifoSize, fifoSize};
+        ASSERT_EQ(RcsFifoSetPosSource(fifo, MockDmaPos, &dma), RCS_FIFO_OK);
+    }
+
+    // 硬件收到size个字节，内容为递增序列
+    void DmaReceive(size_t size)
+    {
+        for (size_t i = 0; i < size; i++) {
+            dma.mem[dma.size - dma.ndtr] = next++;
+            dma.ndtr = (dma.ndtr == 1) ? dma.size : dma.ndtr - 1;
+        }
+    }
+
+    // 硬件收到一段文本
+    void DmaReceiveText(const char *text)
+    {
+        for (size_t i = 0; text[i] != '\0'; i++) {
+            dma.mem[dma.size - dma.ndtr] = (uint8_t)text[i];
+            dma.ndtr = (dma.ndtr == 1) ? dma.size : dma.ndtr - 1;
+        }
+    }
+
+    // 原地读取全部数据并释放
+    std::vector<uint8_t> ReadAll()
+    {
+        size_t used = RcsFifoGetUsed(fifo);
+        if (used == 0) {
+            return {};
+        }
+        void *mem[2] = {nullptr, nullptr};
+        int first = RcsFifoRecvAcquire(fifo, used, mem);
+        EXPECT_GT(first, 0);
+        if (first <= 0) {
+            return {};
+        }
+        RcsFifoView_t view;
+        RcsFifoViewInit(&view, mem, (size_t)first, used);
+        std::vector<uint8_t> data(used);
+        RcsFifoViewCopy(&view, 0, data.data(), used);
+        EXPECT_EQ(RcsFifoRecvComplete(fifo, (const void **)mem), RCS_FIFO_OK);
+        return data;
+    }
+};
+
+// 外部位置源模式下不允许通过发送接口写入
+TEST_F(RcsFifoDmaTest, SendNotAllowed)
+{
+    void *mem[2] = {nullptr, nullptr};
+    EXPECT_EQ(RcsFifoSendAcquire(fifo, 4, mem), RCS_FIFO_NOT_ALLOWED);
+    EXPECT_EQ(RcsFifoSendAcquireNoSplit(fifo, 4, mem), RCS_FIFO_NOT_ALLOWED);
+    EXPECT_EQ(RcsFifoPosUpdate(NULL), RCS_FIFO_INVALID_PARAM);
+
+    // 恢复普通模式后可以写入
+    ASSERT_EQ(RcsFifoSetPosSource(fifo, NULL, NULL), RCS_FIFO_OK);
+    EXPECT_EQ(RcsFifoPosUpdate(fifo), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoSendAcquire(fifo, 4, mem), 4);
+    EXPECT_EQ(RcsFifoSendComplete(fifo, (const void **)mem), RCS_FIFO_OK);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 4u);
+}
+
+// 中断中同步位置，接收方在DMA缓冲区上原地读取，跨越回绕
+TEST_F(RcsFifoDmaTest, ReceiveInPlace)
+{
+    int events = 0;
+    RcsFifoSetEventHook(fifo, CountEvent, &events);
+
+    uint8_t expect = 0;
+    for (int round = 0; round < 20; round++) {
+        DmaReceive(fifoSize / 2 - 5);
+        EXPECT_EQ(RcsFifoPosUpdate(fifo), (int)(fifoSize / 2 - 5));
+        std::vector<uint8_t> data = ReadAll();
+        ASSERT_EQ(data.size(), fifoSize / 2 - 5);
+        for (uint8_t byte : data) {
+            ASSERT_EQ(byte, expect++);
+        }
+    }
+    EXPECT_EQ(events, 20);
+    EXPECT_EQ(RcsFifoPosUpdate(fifo), 0);
+    EXPECT_EQ(RcsFifoGetOverrunCount(fifo), 0u);
+}
+
+// 没有中断时接收方也能从位置源取得最新数据
+TEST_F(RcsFifoDmaTest, ConsumerPolls)
+{
+    DmaReceive(10);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 10u);
+    DmaReceive(5);
+
+    void *mem[2] = {nullptr, nullptr};
+    EXPECT_EQ(RcsFifoRecvAcquire(fifo, 15, mem), 15);
+    EXPECT_EQ(((uint8_t *)mem[0])[14], 14);
+    EXPECT_EQ(RcsFifoRecvCompletePartial(fifo, (const void **)mem, 12), RCS_FIFO_OK);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 3u);
+}
+
+// 接收方来不及读取时检测到覆盖，丢弃未读数据后继续
+TEST_F(RcsFifoDmaTest, OverrunWithoutReservation)
+{
+    DmaReceive(40);
+    EXPECT_EQ(RcsFifoPosUpdate(fifo), 40);
+    DmaReceive(30);
+    EXPECT_EQ(RcsFifoPosUpdate(fifo), RCS_FIFO_OVERRUN);
+    EXPECT_EQ(RcsFifoGetOverrunCount(fifo), 1u);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+
+    void *mem[2] = {nullptr, nullptr};
+    EXPECT_EQ(RcsFifoRecvAcquire(fifo, 1, mem), RCS_FIFO_NO_DATA);
+
+    // 重新同步后的新数据正常接收
+    DmaReceive(8);
+    EXPECT_EQ(RcsFifoPosUpdate(fifo), 8);
+    std::vector<uint8_t> data = ReadAll();
+    ASSERT_EQ(data.size(), 8u);
+    EXPECT_EQ(data[0], 70);
+}
+
+// 接收申请期间被覆盖时，完成接收返回覆盖错误
+TEST_F(RcsFifoDmaTest, OverrunDuringReservation)
+{
+    DmaReceive(20);
+    void *mem[2] = {nullptr, nullptr};
+    ASSERT_EQ(RcsFifoRecvAcquire(fifo, 20, mem), 20);
+
+    DmaReceive(50);
+    EXPECT_EQ(RcsFifoPosUpdate(fifo), RCS_FIFO_OVERRUN);
+
+    // 报告之前继续写入，越过接收申请也只计一次覆盖
+    DmaReceive(60);
+    EXPECT_EQ(RcsFifoPosUpdate(fifo), RCS_FIFO_OVERRUN);
+    EXPECT_EQ(RcsFifoGetOverrunCount(fifo), 1u);
+    EXPECT_EQ(RcsFifoRecvComplete(fifo, (const void **)mem), RCS_FIFO_OVERRUN);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+
+    DmaReceive(3);
+    std::vector<uint8_t> data = ReadAll();
+    EXPECT_THAT(data, ::testing::ElementsAre(130, 131, 132));
+}
+
+// 没有中断时发送方向的空闲空间也反映位置源的最新进度
+TEST_F(RcsFifoDmaTest, GetFreePolls)
+{
+    EXPECT_EQ(RcsFifoGetFree(fifo), fifoSize - 1);
+    DmaReceive(10);
+    EXPECT_EQ(RcsFifoGetFree(fifo), fifoSize - 11);
+    EXPECT_EQ(RcsFifoPosUpdate(fifo), 0);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 10u);
+}
+
+// 空间恰好用满不算覆盖
+TEST_F(RcsFifoDmaTest, ExactlyFull)
+{
+    DmaReceive(fifoSize - 1);
+    EXPECT_EQ(RcsFifoPosUpdate(fifo), (int)(fifoSize - 1));
+    EXPECT_EQ(RcsFifoGetFree(fifo), 0u);
+    std::vector<uint8_t> data = ReadAll();
+    ASSERT_EQ(data.size(), fifoSize - 1);
+    EXPECT_EQ(data.back(), fifoSize - 2);
+    EXPECT_EQ(RcsFifoGetOverrunCount(fifo), 0u);
+}
+
+// 覆盖后只丢弃一次，之后到达的行可由行读取器正常取出
+TEST_F(RcsFifoDmaTest, LineReaderAfterOverrun)
+{
+    RcsLineReader_t reader;
+    RcsFifoView_t line;
+    ASSERT_EQ(RcsLineReaderInit(&reader, fifo, '\n', 16), RCS_LINE_OK);
+
+    DmaReceive(30);
+    EXPECT_EQ(RcsFifoPosUpdate(fifo), 30);
+    DmaReceive(40);
+    EXPECT_EQ(RcsFifoPosUpdate(fifo), RCS_FIFO_OVERRUN);
+    EXPECT_EQ(RcsLineRead(&reader, &line), RCS_LINE_NONE);
+
+    for (int round = 0; round < 3; round++) {
+        DmaReceiveText("hello\r\n");
+        EXPECT_EQ(RcsFifoGetUsed(fifo), 7u);
+        ASSERT_EQ(RcsLineRead(&reader, &line), 5);
+        char text[8] = {0};
+        RcsFifoViewCopy(&line, 0, text, 5);
+        EXPECT_STREQ(text, "hello");
+        ASSERT_EQ(RcsLineRelease(&reader), RCS_LINE_OK);
+    }
+    EXPECT_EQ(RcsFifoGetOverrunCount(fifo), 1u);
+}
@@ -0,0 +1,208 @@
+/**
+ * @file fifo_dma_tx_test.cpp
+ * @brief 环形队列DMA描述符导出与链式发送的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <random>
+#include <vector>
+
+#include "siso_fifo_dma.h"
+#include "mock_dma.hpp"
+
+// 模拟控制器的适配层：通用描述符转换为控制器的链表节点
+typedef struct
+{
+    MockDmaNode_t nodes[2];
+    int failNext;
+}MockDmaAdapter_t;
+
+static int MockDmaStartChain(const RcsDmaDesc_t *chain, void *arg)
+{
+    MockDmaAdapter_t *adapter = (MockDmaAdapter_t *)arg;
+    if (adapter->failNext) {
+        adapter->failNext = 0;
+        return RCS_FIFO_ERROR;
+    }
+
+    int count = 0;
+    for (const RcsDmaDesc_t *desc = chain; desc != NULL; desc = desc->next) {
+        if (count >= 2 || desc->len > 0xFFFF) {
+            return RCS_FIFO_INVALID_PARAM;
+        }
+        adapter->nodes[count].src = (const uint8_t *)desc->addr;
+        adapter->nodes[count].count = (uint16_t)desc->len;
+        adapter->nodes[count].next = NULL;
+        if (count > 0) {
+            adapter->nodes[count - 1].next = &adapter->nodes[count];
+        }
+        count++;
+    }
+    return (mock_dma_start(&adapter->nodes[0]) == 0) ? RCS_FIFO_OK : RCS_FIFO_ERROR;
+}
+
+// 传输完成中断
+static void MockDmaTcHandler(void *arg)
+{
+    RcsFifoDmaTxComplete((RcsFifoDmaTx_t *)arg);
+}
+
+// 测试夹具
+class RcsFifoDmaTxTest : public ::testing::Test {
+protected:
+    static constexpr size_t fifoSize = 100;
+    RcsFifo_t fifo;
+    RcsFifoDmaTx_t tx;
+    MockDmaAdapter_t adapter = {};
+    std::vector<uint8_t> sent;
+    std::mt19937 rng{47};
+
+    void SetUp() override {
+        mock_dma::reset();
+        fifo = RcsFifoCreate(fifoSize);
+        ASSERT_EQ(RcsFifoDmaTxInit(&tx, fifo, MockDmaStartChain, &adapter, 0), RCS_FIFO_OK);
+        mock_dma_set_tc_handler(MockDmaTcHandler, &tx);
+    }
+
+    void TearDown() override {
+        RcsFifoDestroy(fifo);
+        mock_dma::reset();
+    }
+
+    bool Write(size_t size)
+    {
+        void *mem[2] = {nullptr, nullptr};
+        int first = RcsFifoSendAcquire(fifo, size, mem);
+        if (first < 0) {
+            return false;
+        }
+        for (size_t i = 0; i < size; i++) {
+            uint8_t byte = (uint8_t)rng();
+            if (i < (size_t)first) {
+                ((uint8_t *)mem[0])[i] = byte;
+            }
+            else {
+                ((uint8_t *)mem[1])[i - first] = byte;
+            }
+            sent.push_back(byte);
+        }
+        RcsFifoSendComplete(fifo, (const void **)mem);
+        return true;
+    }
+};
+
+// 描述符构造
+TEST_F(RcsFifoDmaTxTest, DescBuild)
+{
+    uint8_t a[8], b[8];
+    void *mem[2] = {a, nullptr};
+    RcsDmaDesc_t desc[2];
+
+    EXPECT_EQ(RcsFifoDmaDescBuild(mem, 8, 8, desc), 1);
+    EXPECT_EQ(desc[0].addr, a);
+    EXPECT_EQ(desc[0].len, 8u);
+    EXPECT_EQ(desc[0].next, nullptr);
+
+    EXPECT_EQ(RcsFifoDmaDescBuild(mem, 5, 8, desc), RCS_FIFO_INVALID_PARAM);
+    mem[1] = b;
+    EXPECT_EQ(RcsFifoDmaDescBuild(mem, 5, 8, desc), 2);
+    EXPECT_EQ(desc[0].next, &desc[1]);
+    EXPECT_EQ(desc[1].addr, b);
+    EXPECT_EQ(desc[1].len, 3u);
+    EXPECT_EQ(desc[1].next, nullptr);
+
+    EXPECT_EQ(RcsFifoDmaDescBuild(mem, 0, 8, desc), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoDmaDescBuild(mem, 9, 8, desc), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoDmaTxInit(&tx, fifo, NULL, NULL, 0), RCS_FIFO_INVALID_PARAM);
+}
+
+// 回绕的数据作为一条链发出，只产生一次中断
+TEST_F(RcsFifoDmaTxTest, WrappedRegionSingleInterrupt)
+{
+    ASSERT_TRUE(Write(70));
+    EXPECT_EQ(RcsFifoDmaTxKick(&tx), 70);
+    EXPECT_EQ(mock_dma_run(), 70u);
+
+    ASSERT_TRUE(Write(60));
+    EXPECT_EQ(RcsFifoDmaTxKick(&tx), 60);
+    EXPECT_NE(adapter.nodes[0].next, nullptr);
+    EXPECT_EQ(adapter.nodes[0].count, 30);
+    EXPECT_EQ(adapter.nodes[1].count, 30);
+    EXPECT_EQ(mock_dma_run(), 60u);
+
+    EXPECT_EQ(mock_dma::irqCount, 2);
+    EXPECT_EQ(mock_dma::sink, sent);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+}
+
+// 传输进行中再次启动不会重复申请，完成中断中自动续传新写入的数据
+TEST_F(RcsFifoDmaTxTest, ChainedContinuation)
+{
+    ASSERT_TRUE(Write(20));
+    EXPECT_EQ(RcsFifoDmaTxKick(&tx), 20);
+    ASSERT_TRUE(Write(30));
+    EXPECT_EQ(RcsFifoDmaTxKick(&tx), 0);
+
+    EXPECT_EQ(mock_dma_run(), 20u);
+    EXPECT_TRUE(mock_dma_busy());
+    EXPECT_EQ(mock_dma_run(), 30u);
+    EXPECT_FALSE(mock_dma_busy());
+    EXPECT_EQ(mock_dma_run(), 0u);
+
+    EXPECT_EQ(mock_dma::sink, sent);
+    EXPECT_EQ(tx.transferCount, 2u);
+}
+
+// 单次传输长度受限时分多次发出
+TEST_F(RcsFifoDmaTxTest, MaxTransfer)
+{
+    ASSERT_EQ(RcsFifoDmaTxInit(&tx, fifo, MockDmaStartChain, &adapter, 16), RCS_FIFO_OK);
+    ASSERT_TRUE(Write(90));
+    EXPECT_EQ(RcsFifoDmaTxKick(&tx), 16);
+    while (mock_dma_run() != 0) {
+    }
+    EXPECT_EQ(mock_dma::sink, sent);
+    EXPECT_EQ(mock_dma::irqCount, 6);
+}
+
+// 启动失败时放弃申请，数据留在FIFO中
+TEST_F(RcsFifoDmaTxTest, StartFailure)
+{
+    ASSERT_TRUE(Write(10));
+    adapter.failNext = 1;
+    EXPECT_EQ(RcsFifoDmaTxKick(&tx), RCS_FIFO_ERROR);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 10u);
+    EXPECT_EQ(RcsFifoDmaTxKick(&tx), 10);
+    mock_dma_run();
+    EXPECT_EQ(mock_dma::sink, sent);
+}
+
+// 随机写入与随机完成，内容与顺序不变，每次传输只有一次中断
+TEST_F(RcsFifoDmaTxTest, Streaming)
+{
+    int wrapped = 0;
+    for (int i = 0; i < 2000; i++) {
+        size_t size = 1 + rng() % 40;
+        if (RcsFifoGetFree(fifo) >= size) {
+            ASSERT_TRUE(Write(size));
+        }
+        RcsFifoDmaTxKick(&tx);
+        if (mock_dma_busy() && adapter.nodes[0].next != NULL) {
+            wrapped++;
+        }
+        if (rng() % 3 == 0) {
+            mock_dma_run();
+        }
+    }
+    while (mock_dma_run() != 0) {
+    }
+    RcsFifoDmaTxKick(&tx);
+    while (mock_dma_run() != 0) {
+    }
+
+    EXPECT_EQ(mock_dma::sink, sent);
+    EXPECT_EQ((uint32_t)mock_dma::irqCount, tx.transferCount);
+    EXPECT_GT(wrapped, 0);
+}
@@ -0,0 +1,128 @@
+/**
+ * @file fifo_eventfd_test.cpp
+ * @brief 环形队列eventfd通知的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include "siso_fifo_eventfd.h"
+
+// 测试夹具
+class RcsFifoEventFdTest : public ::testing::Test {
+protected:
+    RcsFifo_t fifo;
+    RcsFifoEventFd_t notifier;
+    int epfd;
+    static constexpr size_t fifoSize = 16;
+
+    void SetUp() override {
+        fifo = RcsFifoCreate(fifoSize);
+        ASSERT_EQ(RcsFifoEventFdInit(&notifier, fifo), RCS_FIFO_OK);
+
+        epfd = epoll_create1(0);
+        epoll_event ev = {};
+        ev.events = EPOLLIN;
+        ev.data.fd = notifier.recvFd;
+        epoll_ctl(epfd, EPOLL_CTL_ADD, notifier.recvFd, &ev);
+        ev.data.fd = notifier.sendFd;
+        epoll_ctl(epfd, EPOLL_CTL_ADD, notifier.sendFd, &ev);
+    }
+
+    void TearDown() override {
+        close(epfd);
+        RcsFifoEventFdDeinit(&notifier);
+        RcsFifoDestroy(fifo);
+    }
+
+    // 返回就绪的fd，没有就绪返回-1
+    int PollOnce() {
+        epoll_event ev = {};
+        int n = epoll_wait(epfd, &ev, 1, 0);
+        return n == 1 ? ev.data.fd : -1;
+    }
+
+    void Send(size_t size) {
+        void* memAcquired[2] = {nullptr};
+        ASSERT_GT(RcsFifoSendAcquire(fifo, size, memAcquired), 0);
+        ASSERT_EQ(RcsFifoSendComplete(fifo, (const void**)memAcquired), RCS_FIFO_OK);
+    }
+
+    void Recv(size_t size) {
+        void* memAcquired[2] = {nullptr};
+        ASSERT_GT(RcsFifoRecvAcquire(fifo, size, memAcquired), 0);
+        ASSERT_EQ(RcsFifoRecvComplete(fifo, (const void**)memAcquired), RCS_FIFO_OK);
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsFifoEventFdTest, InvalidParam)
+{
+    RcsFifoEventFd_t other;
+    EXPECT_EQ(RcsFifoEventFdInit(NULL, fifo), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoEventFdInit(&other, NULL), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoEventFdRearmRecv(&notifier, 0), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoEventFdRearmSend(NULL, 1), RCS_FIFO_INVALID_PARAM);
+}
+
+// 空变非空只通知一次
+TEST_F(RcsFifoEventFdTest, RecvReadyCoalesced)
+{
+    EXPECT_EQ(PollOnce(), -1);
+
+    Send(2);
+    Send(3);
+    Send(1);
+    EXPECT_EQ(notifier.recvArmed, 0u);
+    ASSERT_EQ(PollOnce(), notifier.recvFd);
+
+    uint64_t count = 0;
+    ASSERT_EQ(read(notifier.recvFd, &count, sizeof(count)), (ssize_t)sizeof(count));
+    EXPECT_EQ(count, 1u);
+
+    // 未重新布防前，后续发送不再产生通知
+    Send(1);
+    EXPECT_EQ(PollOnce(), -1);
+}
+
+// 重新布防时若数据已到达，应立即可读
+TEST_F(RcsFifoEventFdTest, RearmWithPendingData)
+{
+    Send(4);
+    ASSERT_EQ(PollOnce(), notifier.recvFd);
+
+    Recv(2);
+    ASSERT_EQ(RcsFifoEventFdRearmRecv(&notifier, 1), RCS_FIFO_OK);
+    EXPECT_EQ(PollOnce(), notifier.recvFd);
+
+    Recv(2);
+    ASSERT_EQ(RcsFifoEventFdRearmRecv(&notifier, 1), RCS_FIFO_OK);
+    EXPECT_EQ(PollOnce(), -1);
+}
+
+// 满变不满通知发送方
+TEST_F(RcsFifoEventFdTest, SendReadyAfterFull)
+{
+    Send(fifoSize - 1);
+    ASSERT_EQ(PollOnce(), notifier.recvFd);
+    {
+        uint64_t count;
+        ASSERT_EQ(read(notifier.recvFd, &count, sizeof(count)), (ssize_t)sizeof(count));
+    }
+
+    void* memAcquired[2] = {nullptr};
+    ASSERT_EQ(RcsFifoSendAcquire(fifo, 4, memAcquired), RCS_FIFO_NO_SPACE);
+    ASSERT_EQ(RcsFifoEventFdRearmSend(&notifier, 4), RCS_FIFO_OK);
+    EXPECT_EQ(PollOnce(), -1);
+
+    // 空间不足以满足发送方时不通知
+    Recv(2);
+    EXPECT_EQ(PollOnce(), -1);
+
+    Recv(2);
+    EXPECT_EQ(PollOnce(), notifier.sendFd);
+    EXPECT_GT(RcsFifoSendAcquire(fifo, 4, memAcquired), 0);
+}
@@ -0,0 +1,190 @@
+/**
+ * @file fifo_raii_test.cpp
+ * @brief 环形队列C++预留对象及部分完成的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include "siso_fifo.hpp"
+
+// 测试夹具
+class RcsFifoRaiiTest : public ::testing::Test {
+protected:
+    RcsFifo_t fifo;
+    static constexpr size_t fifoSize = 16;
+
+    void SetUp() override {
+        fifo = RcsFifoCreate(fifoSize);
+    }
+
+    void TearDown() override {
+        RcsFifoDestroy(fifo);
+    }
+};
+
+// 部分完成的参数检查
+TEST_F(RcsFifoRaiiTest, PartialInvalidParam)
+{
+    void* memAcquired[2] = {nullptr};
+    EXPECT_EQ(RcsFifoSendCompletePartial(fifo, NULL, 1), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoSendCompletePartial(fifo, (const void**)memAcquired, 1), RCS_FIFO_INVALID_PARAM);
+
+    ASSERT_EQ(RcsFifoSendAcquire(fifo, 4, memAcquired), 4);
+    EXPECT_EQ(RcsFifoSendCompletePartial(fifo, (const void**)memAcquired, 5), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoSendCompletePartial(fifo, (const void**)memAcquired, 2), RCS_FIFO_OK);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 2u);
+
+    ASSERT_EQ(RcsFifoRecvAcquire(fifo, 2, memAcquired), 2);
+    EXPECT_EQ(RcsFifoRecvCompletePartial(fifo, (const void**)memAcquired, 3), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoRecvCompletePartial(fifo, (const void**)memAcquired, 0), RCS_FIFO_OK);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 2u);
+
+    // 申请已完成后再次部分完成，旧指针不能用于推算申请区域
+    EXPECT_EQ(RcsFifoSendCompletePartial(fifo, (const void**)memAcquired, 1), RCS_FIFO_NOT_ALLOWED);
+    EXPECT_EQ(RcsFifoRecvCompletePartial(fifo, (const void**)memAcquired, 1), RCS_FIFO_NOT_ALLOWED);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 2u);
+}
+
+// 析构时自动完成，FIFO不会一直处于锁定状态
+TEST_F(RcsFifoRaiiTest, CommitOnDestruction)
+{
+    {
+        rcs::SendReservation tx = rcs::sendAcquire(fifo, 5);
+        ASSERT_TRUE(tx);
+        EXPECT_EQ(tx.first().size(), 5u);
+        EXPECT_TRUE(tx.second().empty());
+        EXPECT_EQ(tx.joined().copyFrom("hello", 5), 5u);
+
+        // 同时只允许一个发送预留
+        rcs::SendReservation again = rcs::sendAcquire(fifo, 1);
+        EXPECT_FALSE(again);
+        EXPECT_EQ(again.error(), RCS_FIFO_NOT_ALLOWED);
+    }
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 5u);
+
+    {
+        rcs::RecvReservation rx = rcs::recvAcquire(fifo, 5);
+        ASSERT_TRUE(rx);
+        char buf[8];
+        EXPECT_EQ(rx.joined().copyTo(buf, 5), 5u);
+        EXPECT_EQ(memcmp(buf, "hello", 5), 0);
+
+        // 第二段为空时越界部分被截断，不会访问第二段
+        EXPECT_EQ(rx.joined().copyTo(buf, sizeof(buf), 2), 3u);
+        EXPECT_EQ(memcmp(buf, "llo", 3), 0);
+        EXPECT_EQ(rx.joined().copyTo(buf, 1, 5), 0u);
+        EXPECT_EQ(rx.joined().copyTo(buf, 1, 9), 0u);
+    }
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+}
+
+// 最坏情况申请，按实际用量部分完成
+TEST_F(RcsFifoRaiiTest, PartialCommitAcrossBoundary)
+{
+    // 推进到尾部附近
+    {
+        rcs::SendReservation tx = rcs::sendAcquire(fifo, 12);
+        ASSERT_TRUE(tx);
+    }
+    {
+        rcs::RecvReservation rx = rcs::recvAcquire(fifo, 12);
+        ASSERT_TRUE(rx);
+    }
+
+    {
+        rcs::SendReservation tx = rcs::sendAcquire(fifo, 10);
+        ASSERT_TRUE(tx);
+        EXPECT_EQ(tx.first().size(), 4u);
+        EXPECT_EQ(tx.second().size(), 6u);
+        tx.joined().copyFrom("abcdefg", 7);
+        tx.setCommitSize(7);
+    }
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 7u);
+
+    // 接收方只消费一部分，剩余数据留待下次
+    {
+        rcs::RecvReservation rx = rcs::recvAcquire(fifo, 7);
+        ASSERT_TRUE(rx);
+        EXPECT_EQ((char)rx.joined()[4], 'e');
+        EXPECT_EQ(rx.commit(5), RCS_FIFO_OK);
+        EXPECT_FALSE(rx);
+    }
+    {
+        rcs::RecvReservation rx = rcs::recvAcquire(fifo, 2);
+        ASSERT_TRUE(rx);
+        EXPECT_EQ((char)rx.joined()[0], 'f');
+        EXPECT_EQ((char)rx.joined()[1], 'g');
+    }
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+}
+
+// 移动后所有权转移，只完成一次
+TEST_F(RcsFifoRaiiTest, MoveTransfersOwnership)
+{
+    std::vector<rcs::SendReservation> list;
+    {
+        rcs::SendReservation tx = rcs::sendAcquire(fifo, 3);
+        list.push_back(std::move(tx));
+        EXPECT_FALSE(tx);
+    }
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+
+    EXPECT_EQ(list[0].cancel(), RCS_FIFO_OK);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+    EXPECT_EQ(RcsFifoGetFree(fifo), fifoSize - 1);
+
+    rcs::SendReservation tx = rcs::sendAcquire(fifo, 3);
+    EXPECT_TRUE(tx);
+}
+
+// 预留对象与直接调用C接口的开销对比，每轮写入并读出一个跨越回绕的小块
+TEST_F(RcsFifoRaiiTest, DISABLED_Throughput)
+{
+    const uint32_t rounds = 1000000;
+    const uint8_t tx[7] = {1, 2, 3, 4, 5, 6, 7};
+    uint8_t rx[7];
+    uint32_t sum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < rounds; i++) {
+        void* mem[2] = {nullptr, nullptr};
+        int first = RcsFifoSendAcquire(fifo, sizeof(tx), mem);
+        memcpy(mem[0], tx, (size_t)first);
+        if (mem[1] != nullptr) {
+            memcpy(mem[1], tx + first, sizeof(tx) - (size_t)first);
+        }
+        RcsFifoSendComplete(fifo, (const void**)mem);
+        first = RcsFifoRecvAcquire(fifo, sizeof(rx), mem);
+        memcpy(rx, mem[0], (size_t)first);
+        if (mem[1] != nullptr) {
+            memcpy(rx + first, mem[1], sizeof(rx) - (size_t)first);
+        }
+        RcsFifoRecvComplete(fifo, (const void**)mem);
+        sum += rx[6];
+    }
+    double raw = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < rounds; i++) {
+        {
+            rcs::SendReservation reservation = rcs::sendAcquire(fifo, sizeof(tx));
+            reservation.joined().copyFrom(tx, sizeof(tx));
+        }
+        {
+            rcs::RecvReservation reservation = rcs::recvAcquire(fifo, sizeof(rx));
+            reservation.joined().copyTo(rx, sizeof(rx));
+        }
+        sum += rx[6];
+    }
+    double guarded = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(sum, 2 * rounds * 7);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+    printf("fifo raw: %.1f ns per send+recv\n", raw / rounds * 1e9);
+    printf("fifo raii: %.1f ns per send+recv\n", guarded / rounds * 1e9);
+}
@@ -275,3 +275,25 @@ TEST_F(RcsFifoTest, Loopback_Trunc_Boundary)
 
 
 
+
+// 不拆分读测试：连续数据可直接读取，拒绝后FIFO仍可继续使用
+TEST_F(RcsFifoTest, RecvNoSplit_NotAllowedReleasesCritical)
+{
+    void* txBlk[2] = {nullptr}, *rxBlk[2] = {nullptr}, *rxBlk2[2] = {nullptr};
+
+    ASSERT_EQ(RcsFifoSendAcquire(fifo, 8, txBlk), 8);
+    ASSERT_EQ(RcsFifoSendComplete(fifo, (const void**)txBlk), RCS_FIFO_OK);
+
+    // 读指针在写指针之前，数据连续
+    ASSERT_EQ(RcsFifoRecvAcquireNoSplit(fifo, 4, rxBlk), 4);
+    EXPECT_EQ(rxBlk[1], nullptr);
+
+    // 上一次读尚未结束，应拒绝且不得残留临界区
+    EXPECT_EQ(RcsFifoRecvAcquireNoSplit(fifo, 2, rxBlk2), RCS_FIFO_NOT_ALLOWED);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 4u);
+    ASSERT_EQ(RcsFifoRecvComplete(fifo, (const void**)rxBlk), RCS_FIFO_OK);
+
+    ASSERT_EQ(RcsFifoRecvAcquireNoSplit(fifo, 4, rxBlk), 4);
+    ASSERT_EQ(RcsFifoRecvComplete(fifo, (const void**)rxBlk), RCS_FIFO_OK);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+}
@@ -0,0 +1,203 @@
+/**
+ * @file fifo_wait_test.cpp
+ * @brief 环形队列阻塞等待的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include "siso_fifo_wait.h"
+
+// 测试夹具
+class RcsFifoWaitTest : public ::testing::Test {
+protected:
+    RcsFifo_t fifo;
+    RcsFifoWaiter_t waiter;
+    static constexpr size_t fifoSize = 64;
+
+    void SetUp() override {
+        fifo = RcsFifoCreate(fifoSize);
+        ASSERT_EQ(RcsFifoWaiterInit(&waiter, fifo, RCS_FIFO_WAIT_DEFAULT_SPIN), RCS_FIFO_OK);
+    }
+
+    void TearDown() override {
+        RcsFifoWaiterDeinit(&waiter);
+        RcsFifoDestroy(fifo);
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsFifoWaitTest, InvalidParam)
+{
+    void* memAcquired[2] = {nullptr};
+
+    EXPECT_EQ(RcsFifoWaiterInit(NULL, fifo, 0), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoRecvAcquireWait(&waiter, 0, memAcquired, 0), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoRecvAcquireWait(&waiter, fifoSize, memAcquired, 0), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoSendAcquireWait(&waiter, fifoSize, memAcquired, 0), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsFifoSendAcquireWait(&waiter, 1, NULL, 0), RCS_FIFO_INVALID_PARAM);
+}
+
+// 事件钩子已被占用时拒绝挂接，失败方的注销不影响已挂接的等待器
+TEST_F(RcsFifoWaitTest, HookOwnership)
+{
+    RcsFifoWaiter_t other;
+    EXPECT_EQ(RcsFifoWaiterInit(&other, fifo, 0), RCS_FIFO_NOT_ALLOWED);
+    RcsFifoWaiterDeinit(&other);
+    EXPECT_EQ(RcsFifoClearEventHook(fifo, ((RcsFifoHandle_t*)fifo)->eventHook, &other), RCS_FIFO_NOT_ALLOWED);
+
+    void* memAcquired[2] = {nullptr};
+    ASSERT_EQ(RcsFifoSendAcquire(fifo, 4, memAcquired), 4);
+    ASSERT_EQ(RcsFifoSendComplete(fifo, (const void**)memAcquired), RCS_FIFO_OK);
+    EXPECT_EQ(waiter.dataSeq, 1u);
+
+    // 注销后其他使用者可以挂接
+    RcsFifoWaiterDeinit(&waiter);
+    ASSERT_EQ(RcsFifoWaiterInit(&other, fifo, 0), RCS_FIFO_OK);
+    RcsFifoWaiterDeinit(&other);
+    ASSERT_EQ(RcsFifoWaiterInit(&waiter, fifo, 0), RCS_FIFO_OK);
+}
+
+// 每个FIFO有自己的临界区，占用一个FIFO时其他FIFO照常收发
+TEST_F(RcsFifoWaitTest, IndependentCritical)
+{
+    RcsFifo_t other = RcsFifoCreate(fifoSize);
+    RcsFifoHandle_t* handle = (RcsFifoHandle_t*)fifo;
+    void* memAcquired[2] = {nullptr};
+
+    FifoPortEnterCriticalFromAll(handle);
+    ASSERT_EQ(RcsFifoSendAcquire(other, 4, memAcquired), 4);
+    ASSERT_EQ(RcsFifoSendComplete(other, (const void**)memAcquired), RCS_FIFO_OK);
+    ASSERT_EQ(RcsFifoRecvAcquire(other, 4, memAcquired), 4);
+    ASSERT_EQ(RcsFifoRecvComplete(other, (const void**)memAcquired), RCS_FIFO_OK);
+    FifoPortExitCriticalFromAll(handle);
+
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+    RcsFifoDestroy(other);
+}
+
+static void SlowHook(RcsFifo_t, int, void* arg)
+{
+    std::atomic<int>* state = (std::atomic<int>*)arg;
+    state->store(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    state->store(2);
+}
+
+// 注销钩子时等待另一线程中进行中的钩子调用返回，之后参数可以释放
+TEST_F(RcsFifoWaitTest, ClearWaitsForRunningHook)
+{
+    RcsFifoWaiterDeinit(&waiter);
+    std::atomic<int> state{0};
+    ASSERT_EQ(RcsFifoSetEventHook(fifo, SlowHook, &state), RCS_FIFO_OK);
+
+    std::thread producer([&] {
+        void* memAcquired[2] = {nullptr};
+        ASSERT_EQ(RcsFifoSendAcquire(fifo, 4, memAcquired), 4);
+        RcsFifoSendComplete(fifo, (const void**)memAcquired);
+    });
+    while (state.load() == 0) {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(RcsFifoClearEventHook(fifo, SlowHook, &state), RCS_FIFO_OK);
+    EXPECT_EQ(state.load(), 2);
+    producer.join();
+    ASSERT_EQ(RcsFifoWaiterInit(&waiter, fifo, 0), RCS_FIFO_OK);
+}
+
+// 超时测试
+TEST_F(RcsFifoWaitTest, RecvTimeout)
+{
+    void* memAcquired[2] = {nullptr};
+
+    auto start = std::chrono::steady_clock::now();
+    int ret = RcsFifoRecvAcquireWait(&waiter, 1, memAcquired, 20);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(ret, RCS_FIFO_TIMEOUT);
+    EXPECT_GE(elapsed, std::chrono::milliseconds(20));
+    EXPECT_EQ(waiter.waitFlags, 0u);
+}
+
+// 数据已就绪时不应阻塞
+TEST_F(RcsFifoWaitTest, RecvReadyNoWait)
+{
+    void* memAcquired[2] = {nullptr};
+
+    ASSERT_EQ(RcsFifoSendAcquire(fifo, 4, memAcquired), 4);
+    ASSERT_EQ(RcsFifoSendComplete(fifo, (const void**)memAcquired), RCS_FIFO_OK);
+    EXPECT_EQ(waiter.dataSeq, 1u);
+
+    EXPECT_EQ(RcsFifoRecvAcquireWait(&waiter, 4, memAcquired, 0), 4);
+    EXPECT_EQ(RcsFifoRecvComplete(fifo, (const void**)memAcquired), RCS_FIFO_OK);
+    EXPECT_EQ(waiter.spaceSeq, 1u);
+}
+
+// 休眠的接收方被发送完成唤醒
+TEST_F(RcsFifoWaitTest, RecvWokenBySend)
+{
+    RcsFifoWaiterDeinit(&waiter);
+    ASSERT_EQ(RcsFifoWaiterInit(&waiter, fifo, 0), RCS_FIFO_OK);
+
+    std::thread producer([this]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        void* txBlk[2] = {nullptr};
+        ASSERT_EQ(RcsFifoSendAcquire(fifo, 3, txBlk), 3);
+        memcpy(txBlk[0], "abc", 3);
+        RcsFifoSendComplete(fifo, (const void**)txBlk);
+    });
+
+    void* rxBlk[2] = {nullptr};
+    int ret = RcsFifoRecvAcquireWait(&waiter, 3, rxBlk, RCS_FIFO_WAIT_FOREVER);
+    producer.join();
+
+    ASSERT_EQ(ret, 3);
+    EXPECT_EQ(memcmp(rxBlk[0], "abc", 3), 0);
+    EXPECT_EQ(RcsFifoRecvComplete(fifo, (const void**)rxBlk), RCS_FIFO_OK);
+}
+
+// 生产者与消费者双向阻塞的长时间传输
+TEST_F(RcsFifoWaitTest, StreamBothSidesBlocking)
+{
+    constexpr size_t total = 200000;
+    constexpr size_t chunk = 7;
+
+    std::thread producer([&]() {
+        size_t sent = 0;
+        while (sent < total) {
+            size_t len = std::min(chunk, total - sent);
+            void* txBlk[2] = {nullptr};
+            int first = RcsFifoSendAcquireWait(&waiter, len, txBlk, RCS_FIFO_WAIT_FOREVER);
+            ASSERT_GT(first, 0);
+            for (size_t i = 0; i < len; i++) {
+                uint8_t* dst = (i < (size_t)first) ? (uint8_t*)txBlk[0] + i : (uint8_t*)txBlk[1] + (i - first);
+                *dst = (uint8_t)(sent + i);
+            }
+            RcsFifoSendComplete(fifo, (const void**)txBlk);
+            sent += len;
+        }
+    });
+
+    size_t received = 0;
+    bool ordered = true;
+    while (received < total) {
+        size_t len = std::min((size_t)5, total - received);
+        void* rxBlk[2] = {nullptr};
+        int first = RcsFifoRecvAcquireWait(&waiter, len, rxBlk, RCS_FIFO_WAIT_FOREVER);
+        ASSERT_GT(first, 0);
+        for (size_t i = 0; i < len; i++) {
+            uint8_t* src = (i < (size_t)first) ? (uint8_t*)rxBlk[0] + i : (uint8_t*)rxBlk[1] + (i - first);
+            ordered = ordered && (*src == (uint8_t)(received + i));
+        }
+        RcsFifoRecvComplete(fifo, (const void**)rxBlk);
+        received += len;
+    }
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+}
@@ -0,0 +1,239 @@
+/**
+ * @file frame_parser_test.cpp
+ * @brief 两段视图帧解析器的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "frame_parser.h"
+
+typedef struct
+{
+    std::vector<std::vector<uint8_t>> frames;
+    int splitFrames;
+}TestSink_t;
+
+static void CollectFrame(const RcsFifoView_t *payload, void *arg)
+{
+    TestSink_t *sink = (TestSink_t *)arg;
+    std::vector<uint8_t> data(payload->len[0] + payload->len[1]);
+    RcsFifoViewCopy(payload, 0, data.data(), data.size());
+    sink->frames.push_back(data);
+    if (payload->len[1] != 0) {
+        sink->splitFrames++;
+    }
+}
+
+// 向FIFO写入原始字节
+static void WriteRaw(RcsFifo_t fifo, const uint8_t *data, size_t size)
+{
+    void *memAcquired[2] = {nullptr};
+    int first = RcsFifoSendAcquire(fifo, size, memAcquired);
+    ASSERT_GT(first, 0);
+    memcpy(memAcquired[0], data, first);
+    if ((size_t)first < size) {
+        memcpy(memAcquired[1], data + first, size - first);
+    }
+    RcsFifoSendComplete(fifo, (const void **)memAcquired);
+}
+
+// 测试夹具
+class RcsFrameParserTest : public ::testing::Test {
+protected:
+    static constexpr size_t fifoSize = 64;
+    RcsFifoHandle_t fifoHandle;
+    uint8_t fifoMemory[fifoSize];
+    RcsFifo_t fifo;
+    RcsFrameParser_t parser;
+    TestSink_t sink;
+
+    void SetUp() override {
+        fifo = RcsFifoCreateStatic(fifoSize, &fifoHandle, fifoMemory);
+        sink.splitFrames = 0;
+        ASSERT_EQ(RcsFrameParserInit(&parser, fifo, RCS_FRAME_DEFAULT_SOF, 32, CollectFrame, &sink), RCS_FRAME_OK);
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsFrameParserTest, InvalidParam)
+{
+    RcsFrameParser_t other;
+    EXPECT_EQ(RcsFrameParserInit(NULL, fifo, 0xA5, 8, CollectFrame, NULL), RCS_FRAME_INVALID_PARAM);
+    EXPECT_EQ(RcsFrameParserInit(&other, fifo, 0xA5, 8, NULL, NULL), RCS_FRAME_INVALID_PARAM);
+    // 整帧放不进FIFO
+    EXPECT_EQ(RcsFrameParserInit(&other, fifo, 0xA5, fifoSize - RCS_FRAME_OVERHEAD, CollectFrame, NULL),
+              RCS_FRAME_INVALID_PARAM);
+    EXPECT_EQ(RcsFrameParserPoll(NULL), RCS_FRAME_INVALID_PARAM);
+    EXPECT_EQ(RcsFrameWrite(fifo, 0xA5, NULL, 1), RCS_FRAME_INVALID_PARAM);
+    EXPECT_EQ(RcsFrameWrite(fifo, 0xA5, fifoMemory, fifoSize), RCS_FRAME_NO_SPACE);
+}
+
+// 视图的截取与拷贝
+TEST_F(RcsFrameParserTest, ViewHelpers)
+{
+    uint8_t a[4] = {0, 1, 2, 3};
+    uint8_t b[3] = {4, 5, 6};
+    void *mem[2] = {a, b};
+    RcsFifoView_t view, slice;
+    ASSERT_EQ(RcsFifoViewInit(&view, mem, 4, 7), RCS_FIFO_OK);
+    EXPECT_EQ(RcsFifoViewInit(&slice, mem, 5, 4), RCS_FIFO_INVALID_PARAM);
+
+    ASSERT_EQ(RcsFifoViewSlice(&view, 2, 4, &slice), RCS_FIFO_OK);
+    EXPECT_EQ(slice.seg[0], a + 2);
+    EXPECT_EQ(slice.len[0], 2u);
+    EXPECT_EQ(slice.seg[1], b);
+    EXPECT_EQ(slice.len[1], 2u);
+    ASSERT_EQ(RcsFifoViewSlice(&view, 5, 2, &slice), RCS_FIFO_OK);
+    EXPECT_EQ(slice.seg[0], b + 1);
+    EXPECT_EQ(slice.len[1], 0u);
+    EXPECT_EQ(RcsFifoViewSlice(&view, 5, 3, &slice), RCS_FIFO_INVALID_PARAM);
+
+    uint8_t out[8] = {0};
+    EXPECT_EQ(RcsFifoViewCopy(&view, 3, out, 8), 4u);
+    EXPECT_EQ(out[0], 3);
+    EXPECT_EQ(out[3], 6);
+}
+
+// 收发往返，帧跨越缓冲区末尾时负载以两段视图交付
+TEST_F(RcsFrameParserTest, RoundTripAcrossWrap)
+{
+    std::vector<std::vector<uint8_t>> sent;
+    for (int i = 0; i < 50; i++) {
+        std::vector<uint8_t> payload(1 + (i * 7) % 30);
+        for (size_t j = 0; j < payload.size(); j++) {
+            payload[j] = (uint8_t)(i + j);
+        }
+        ASSERT_EQ(RcsFrameWrite(fifo, RCS_FRAME_DEFAULT_SOF, payload.data(), payload.size()), RCS_FRAME_OK);
+        ASSERT_EQ(RcsFrameParserPoll(&parser), 1);
+        sent.push_back(payload);
+    }
+    EXPECT_EQ(sink.frames, sent);
+    EXPECT_GT(sink.splitFrames, 0);
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+    EXPECT_EQ(parser.discardCount, 0u);
+
+    // 空负载
+    ASSERT_EQ(RcsFrameWrite(fifo, RCS_FRAME_DEFAULT_SOF, NULL, 0), RCS_FRAME_OK);
+    ASSERT_EQ(RcsFrameParserPoll(&parser), 1);
+    EXPECT_TRUE(sink.frames.back().empty());
+}
+
+// 不完整的帧留在FIFO中，数据到齐后再交付
+TEST_F(RcsFrameParserTest, PartialFrame)
+{
+    RcsFifo_t staging = RcsFifoCreate(64);
+    const uint8_t payload[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    RcsFrameWrite(staging, RCS_FRAME_DEFAULT_SOF, payload, sizeof(payload));
+    uint8_t raw[sizeof(payload) + RCS_FRAME_OVERHEAD];
+    void *mem[2];
+    int first = RcsFifoRecvAcquire(staging, sizeof(raw), mem);
+    ASSERT_EQ(first, (int)sizeof(raw));
+    memcpy(raw, mem[0], sizeof(raw));
+    RcsFifoRecvComplete(staging, (const void **)mem);
+    RcsFifoDestroy(staging);
+
+    for (size_t split = 1; split < sizeof(raw); split++) {
+        WriteRaw(fifo, raw, split);
+        ASSERT_EQ(RcsFrameParserPoll(&parser), 0);
+        ASSERT_EQ(RcsFifoGetUsed(fifo), split);
+        WriteRaw(fifo, raw + split, sizeof(raw) - split);
+        ASSERT_EQ(RcsFrameParserPoll(&parser), 1);
+    }
+    EXPECT_EQ(sink.frames.size(), sizeof(raw) - 1);
+    EXPECT_EQ(parser.discardCount, 0u);
+}
+
+// 垃圾数据、错误长度与CRC错误之后能重新同步
+TEST_F(RcsFrameParserTest, Resync)
+{
+    const uint8_t good[3] = {0x11, 0x22, 0x33};
+
+    const uint8_t garbage[] = {0x00, 0xFF, 0xA5, 0xFF, 0xFF, 0x12};   // 含伪SOF且长度超限
+    WriteRaw(fifo, garbage, sizeof(garbage));
+    RcsFrameWrite(fifo, RCS_FRAME_DEFAULT_SOF, good, sizeof(good));
+    EXPECT_EQ(RcsFrameParserPoll(&parser), 1);
+    EXPECT_EQ(parser.lengthErrorCount, 1u);
+    EXPECT_EQ(parser.discardCount, sizeof(garbage));
+
+    // 破坏一帧的CRC，紧随其后的好帧不受影响
+    RcsFrameWrite(fifo, RCS_FRAME_DEFAULT_SOF, good, sizeof(good));
+    fifoMemory[(fifoHandle.indexWriteTail + fifoSize - 1) % fifoSize] ^= 0x01;
+    RcsFrameWrite(fifo, RCS_FRAME_DEFAULT_SOF, good, sizeof(good));
+    EXPECT_EQ(RcsFrameParserPoll(&parser), 1);
+    EXPECT_EQ(parser.crcErrorCount, 1u);
+    ASSERT_EQ(sink.frames.size(), 2u);
+    EXPECT_EQ(sink.frames[1], std::vector<uint8_t>(good, good + 3));
+    EXPECT_EQ(RcsFifoGetUsed(fifo), 0u);
+}
+
+// 随机噪声混合随机帧，所有好帧都能按序取出
+TEST_F(RcsFrameParserTest, NoisyStream)
+{
+    RcsFifo_t big = RcsFifoCreate(1024);
+    RcsFrameParser_t bigParser;
+    TestSink_t bigSink{};
+    ASSERT_EQ(RcsFrameParserInit(&bigParser, big, RCS_FRAME_DEFAULT_SOF, 200, CollectFrame, &bigSink), RCS_FRAME_OK);
+
+    std::mt19937 rng(41);
+    std::vector<std::vector<uint8_t>> sent;
+    for (int i = 0; i < 2000; i++) {
+        if (RcsFifoGetFree(big) < 200 + RCS_FRAME_OVERHEAD + 8) {
+            RcsFrameParserPoll(&bigParser);
+        }
+        if (rng() % 4 == 0) {
+            // 不含SOF的噪声，保证不会与后续好帧拼出伪帧
+            uint8_t noise[8];
+            size_t n = 1 + rng() % sizeof(noise);
+            for (size_t j = 0; j < n; j++) {
+                noise[j] = (uint8_t)(rng() % 0xA5);
+            }
+            WriteRaw(big, noise, n);
+        }
+        std::vector<uint8_t> payload(rng() % 200);
+        for (auto &byte : payload) {
+            byte = (uint8_t)rng();
+        }
+        ASSERT_EQ(RcsFrameWrite(big, RCS_FRAME_DEFAULT_SOF, payload.data(), payload.size()), RCS_FRAME_OK);
+        sent.push_back(payload);
+        if (rng() % 3 == 0) {
+            RcsFrameParserPoll(&bigParser);
+        }
+    }
+    RcsFrameParserPoll(&bigParser);
+    EXPECT_EQ(bigSink.frames, sent);
+    RcsFifoDestroy(big);
+}
+
+static void CountFrame(const RcsFifoView_t *payload, void *arg)
+{
+    *(size_t *)arg += payload->len[0] + payload->len[1];
+}
+
+// 吞吐量：只做统计输出，不作为通过条件
+TEST_F(RcsFrameParserTest, DISABLED_Throughput)
+{
+    RcsFifo_t big = RcsFifoCreate(8192);
+    RcsFrameParser_t bigParser;
+    size_t received = 0;
+    RcsFrameParserInit(&bigParser, big, RCS_FRAME_DEFAULT_SOF, 1024, CountFrame, &received);
+
+    std::vector<uint8_t> payload(256, 0x5A);
+    const size_t target = 16u << 20;
+    auto begin = std::chrono::steady_clock::now();
+    while (received < target) {
+        while (RcsFrameWrite(big, RCS_FRAME_DEFAULT_SOF, payload.data(), payload.size()) == RCS_FRAME_OK) {
+        }
+        RcsFrameParserPoll(&bigParser);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    double mbps = (double)received / (1 << 20) / seconds;
+    RecordProperty("MBps", std::to_string(mbps));
+    printf("frame parser: %.1f MB/s payload\n", mbps);
+    EXPECT_EQ(bigParser.crcErrorCount, 0u);
+    RcsFifoDestroy(big);
+}
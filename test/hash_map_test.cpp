@@ -0,0 +1,147 @@
+/**
+ * @file hash_map_test.cpp
+ * @brief Robin Hood哈希表的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <map>
+#include <random>
+
+#include "hash_map.h"
+
+// 测试夹具
+class RcsHashMapTest : public ::testing::Test {
+protected:
+    static constexpr size_t capacity = 64;
+    RcsHashMapHandle_t handle;
+    RcsHashEntry_t entries[capacity];
+    RcsHashMap_t map;
+
+    void SetUp() override {
+        map = RcsHashMapCreateStatic(capacity, &handle, entries);
+    }
+
+    // 校验Robin Hood不变量：每个元素的探测距离与其理想位置一致且不超过上界
+    void checkInvariant(RcsHashMapHandle_t* h) {
+        size_t count = 0;
+        for (uint32_t i = 0; i <= h->mask; i++) {
+            const RcsHashEntry_t& e = h->entries[i];
+            if (e.dist == 0) {
+                continue;
+            }
+            count++;
+            ASSERT_LE(e.dist, (uint32_t)RCS_HASH_MAX_PROBE);
+            uint32_t ideal = (e.key * 0x9E3779B1u) >> h->shift;
+            ASSERT_EQ((ideal + e.dist - 1) & h->mask, i);
+        }
+        ASSERT_EQ(count, h->count);
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsHashMapTest, InvalidParam)
+{
+    RcsHashMapHandle_t other;
+    void* value;
+    EXPECT_EQ(RcsHashMapCreateStatic(0, &other, entries), nullptr);
+    EXPECT_EQ(RcsHashMapCreateStatic(1, &other, entries), nullptr);
+    EXPECT_EQ(RcsHashMapCreateStatic(48, &other, entries), nullptr);
+    EXPECT_EQ(RcsHashMapCreateStatic(capacity, NULL, entries), nullptr);
+    EXPECT_EQ(RcsHashMapCreate(100), nullptr);
+    EXPECT_EQ(RcsHashMapInsert(NULL, 1, NULL), RCS_HASH_INVALID_PARAM);
+    EXPECT_EQ(RcsHashMapLookup(map, 1, NULL), RCS_HASH_INVALID_PARAM);
+    EXPECT_EQ(RcsHashMapLookup(map, 1, &value), RCS_HASH_NOT_FOUND);
+    EXPECT_EQ(RcsHashMapRemove(map, 1), RCS_HASH_NOT_FOUND);
+}
+
+static int handlerA;
+static int handlerB;
+
+// 标准帧与扩展帧标识符分发
+TEST_F(RcsHashMapTest, CanIdDispatch)
+{
+    EXPECT_EQ(RcsHashMapInsert(map, 0x123, &handlerA), RCS_HASH_OK);
+    EXPECT_EQ(RcsHashMapInsert(map, 0x18DAF110, &handlerB), RCS_HASH_OK);
+    EXPECT_EQ(RcsHashMapInsert(map, 0x0, NULL), RCS_HASH_OK);
+
+    void* value = nullptr;
+    ASSERT_EQ(RcsHashMapLookup(map, 0x123, &value), RCS_HASH_OK);
+    EXPECT_EQ(value, &handlerA);
+    ASSERT_EQ(RcsHashMapLookup(map, 0x18DAF110, &value), RCS_HASH_OK);
+    EXPECT_EQ(value, &handlerB);
+    ASSERT_EQ(RcsHashMapLookup(map, 0x0, &value), RCS_HASH_OK);
+    EXPECT_EQ(value, nullptr);
+    EXPECT_EQ(RcsHashMapLookup(map, 0x124, &value), RCS_HASH_NOT_FOUND);
+
+    // 重复插入更新值，不增加个数
+    EXPECT_EQ(RcsHashMapInsert(map, 0x123, &handlerB), RCS_HASH_OK);
+    EXPECT_EQ(RcsHashMapGetCount(map), 3u);
+    ASSERT_EQ(RcsHashMapLookup(map, 0x123, &value), RCS_HASH_OK);
+    EXPECT_EQ(value, &handlerB);
+
+    EXPECT_EQ(RcsHashMapRemove(map, 0x123), RCS_HASH_OK);
+    EXPECT_EQ(RcsHashMapLookup(map, 0x123, &value), RCS_HASH_NOT_FOUND);
+    RcsHashMapClear(map);
+    EXPECT_EQ(RcsHashMapGetCount(map), 0u);
+}
+
+// 填满：探测长度受限，失败时表不变
+TEST_F(RcsHashMapTest, BoundedProbe)
+{
+    uint32_t inserted = 0;
+    for (uint32_t id = 0x100; id < 0x100 + capacity * 2; id++) {
+        size_t before = RcsHashMapGetCount(map);
+        int ret = RcsHashMapInsert(map, id, (void*)(uintptr_t)id);
+        if (ret == RCS_HASH_OK) {
+            inserted++;
+        }
+        else {
+            EXPECT_EQ(ret, RCS_HASH_FULL);
+            EXPECT_EQ(RcsHashMapGetCount(map), before);
+        }
+        checkInvariant(&handle);
+    }
+    EXPECT_GE(inserted, capacity * 3 / 4);
+    EXPECT_LE(inserted, capacity);
+
+    for (uint32_t id = 0x100; id < 0x100 + capacity * 2; id++) {
+        void* value = nullptr;
+        if (RcsHashMapLookup(map, id, &value) == RCS_HASH_OK) {
+            EXPECT_EQ(value, (void*)(uintptr_t)id);
+        }
+    }
+}
+
+// 随机插入删除与std::map对照
+TEST_F(RcsHashMapTest, RandomAgainstReference)
+{
+    RcsHashMap_t dynamic = RcsHashMapCreate(1024);
+    ASSERT_NE(dynamic, nullptr);
+    std::map<uint32_t, uintptr_t> reference;
+    std::mt19937 rng(39);
+
+    for (int step = 0; step < 50000; step++) {
+        uint32_t key = rng() & 0x1FFFFFFF;
+        if (!reference.empty() && rng() % 2 == 0) {
+            key = std::next(reference.begin(), rng() % reference.size())->first;
+            ASSERT_EQ(RcsHashMapRemove(dynamic, key), RCS_HASH_OK);
+            reference.erase(key);
+        }
+        else if (reference.size() < 700) {
+            int ret = RcsHashMapInsert(dynamic, key, (void*)(uintptr_t)step);
+            if (ret == RCS_HASH_OK) {
+                reference[key] = step;
+            }
+        }
+    }
+    checkInvariant((RcsHashMapHandle_t*)dynamic);
+    ASSERT_EQ(RcsHashMapGetCount(dynamic), reference.size());
+    for (auto& kv : reference) {
+        void* value = nullptr;
+        ASSERT_EQ(RcsHashMapLookup(dynamic, kv.first, &value), RCS_HASH_OK);
+        EXPECT_EQ(value, (void*)kv.second);
+    }
+    RcsHashMapDestroy(dynamic);
+}
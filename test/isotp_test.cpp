@@ -0,0 +1,389 @@
+/**
+ * @file isotp_test.cpp
+ * @brief ISO-TP会话的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <random>
+#include <vector>
+
+#include "isotp.h"
+
+// 一端的会话及其接收FIFO、发送帧队列与事件记录
+typedef struct
+{
+    RcsIsoTpSession_t session;
+    RcsFifo_t fifo;
+    RcsCanQueue_t txQueue;
+    std::vector<int> events;
+}TestNode_t;
+
+static void RecordEvent(RcsIsoTpSession_t *session, int event, void *arg)
+{
+    (void)session;
+    ((TestNode_t *)arg)->events.push_back(event);
+}
+
+// 测试夹具：A发送ID 0x7E0，B发送ID 0x7E8，二者通过各自的发送帧队列相连
+class RcsIsoTpTest : public ::testing::Test {
+protected:
+    RcsTimerWheel_t wheel;
+    TestNode_t a;
+    TestNode_t b;
+    std::mt19937 rng{45};
+    int dropCfAfter = -1;   // 丢弃从A发往B的第N个连续帧之后的所有帧
+
+    void SetUp() override {
+        wheel = RcsTimerWheelCreate();
+        Open(&a, 0x7E0, 0x7E8, 1024, 0, 0);
+        Open(&b, 0x7E8, 0x7E0, 1024, 4, 0);
+    }
+
+    void TearDown() override {
+        Close(&a);
+        Close(&b);
+        RcsTimerWheelDestroy(wheel);
+    }
+
+    void Open(TestNode_t *node, uint32_t txId, uint32_t rxId, size_t fifoSize, uint8_t bs, uint8_t stMin)
+    {
+        node->fifo = RcsFifoCreate(fifoSize);
+        node->txQueue = RcsCanQueueCreate(64, RCS_CAN_SLOT_CLASSIC);
+        node->events.clear();
+        RcsIsoTpConfig_t config = {};
+        config.txId = txId;
+        config.rxId = rxId;
+        config.blockSize = bs;
+        config.stMin = stMin;
+        config.timeout = 50;
+        config.rxFifo = node->fifo;
+        config.txQueue = node->txQueue;
+        config.wheel = wheel;
+        config.callback = RecordEvent;
+        config.arg = node;
+        ASSERT_EQ(RcsIsoTpInit(&node->session, &config), RCS_ISOTP_OK);
+    }
+
+    void Close(TestNode_t *node)
+    {
+        RcsIsoTpReset(&node->session);
+        RcsFifoDestroy(node->fifo);
+        RcsCanQueueDestroy(node->txQueue);
+    }
+
+    // 把一端发送帧队列中的帧交给另一端，返回转发的帧数
+    size_t Forward(TestNode_t *from, TestNode_t *to)
+    {
+        const RcsCanFrame_t *frames = NULL;
+        size_t total = 0;
+        size_t count;
+        while ((count = RcsCanQueueRecvAcquire(from->txQueue, &frames)) != 0) {
+            for (size_t i = 0; i < count; i++) {
+                bool isCf = (frames[i].data[0] >> 4) == 2;
+                if (from == &a && isCf && dropCfAfter >= 0 && dropCfAfter-- == 0) {
+                    dropCfAfter = 0;
+                    continue;
+                }
+                RcsIsoTpOnFrame(&to->session, &frames[i]);
+            }
+            RcsCanQueueRecvComplete(from->txQueue, count);
+            total += count;
+        }
+        return total;
+    }
+
+    // 推进一个节拍并交换双方的帧
+    void Step()
+    {
+        RcsTimerWheelTick(wheel);
+        RcsTimerWheelProcess(wheel);
+        while (Forward(&a, &b) + Forward(&b, &a) != 0) {
+        }
+    }
+
+    std::vector<uint8_t> RecvMessage(TestNode_t *node, bool *split = nullptr)
+    {
+        RcsFifoView_t payload;
+        void *mem[2];
+        int size = RcsIsoTpMsgAcquire(node->fifo, &payload, mem);
+        if (size < 0) {
+            return {};
+        }
+        std::vector<uint8_t> data(size);
+        RcsFifoViewCopy(&payload, 0, data.data(), data.size());
+        if (split != nullptr) {
+            *split = payload.len[1] != 0;
+        }
+        EXPECT_EQ(RcsIsoTpMsgRelease(node->fifo, mem, size), RCS_ISOTP_OK);
+        return data;
+    }
+
+    std::vector<uint8_t> RandomData(size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        for (auto &byte : data) {
+            byte = (uint8_t)rng();
+        }
+        return data;
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsIsoTpTest, InvalidParam)
+{
+    RcsIsoTpSession_t session;
+    RcsIsoTpConfig_t config = {};
+    EXPECT_EQ(RcsIsoTpInit(&session, &config), RCS_ISOTP_INVALID_PARAM);
+    EXPECT_EQ(RcsIsoTpInit(NULL, &config), RCS_ISOTP_INVALID_PARAM);
+
+    uint8_t data[4] = {0};
+    EXPECT_EQ(RcsIsoTpSend(&a.session, data, 0), RCS_ISOTP_INVALID_PARAM);
+    EXPECT_EQ(RcsIsoTpSend(&a.session, NULL, 4), RCS_ISOTP_INVALID_PARAM);
+
+    RcsCanFrame_t frame = {};
+    frame.id = 0x123;
+    frame.len = 8;
+    EXPECT_EQ(RcsIsoTpOnFrame(&a.session, &frame), RCS_ISOTP_NOT_MINE);
+
+    RcsFifoView_t payload;
+    void *mem[2];
+    EXPECT_EQ(RcsIsoTpMsgAcquire(a.fifo, &payload, mem), RCS_ISOTP_EMPTY);
+}
+
+// 单帧
+TEST_F(RcsIsoTpTest, SingleFrame)
+{
+    const uint8_t data[5] = {0x22, 0xF1, 0x90, 0x00, 0x01};
+    ASSERT_EQ(RcsIsoTpSend(&a.session, data, sizeof(data)), RCS_ISOTP_OK);
+    EXPECT_THAT(a.events, ::testing::ElementsAre(RCS_ISOTP_EVENT_TX_DONE));
+
+    const RcsCanFrame_t *frames = NULL;
+    ASSERT_EQ(RcsCanQueueRecvAcquire(a.txQueue, &frames), 1u);
+    EXPECT_EQ(frames[0].id, 0x7E0u);
+    EXPECT_EQ(frames[0].data[0], 0x05);
+    EXPECT_EQ(frames[0].data[7], RCS_ISOTP_PADDING);
+
+    Step();
+    EXPECT_THAT(b.events, ::testing::ElementsAre(RCS_ISOTP_EVENT_RX_DONE));
+    EXPECT_THAT(RecvMessage(&b), ::testing::ElementsAreArray(data));
+}
+
+// 多帧，接收方BS=4，双向同时进行
+TEST_F(RcsIsoTpTest, MultiFrameBothDirections)
+{
+    std::vector<uint8_t> toB = RandomData(300);
+    std::vector<uint8_t> toA = RandomData(100);
+    ASSERT_EQ(RcsIsoTpSend(&a.session, toB.data(), toB.size()), RCS_ISOTP_OK);
+    ASSERT_EQ(RcsIsoTpSend(&b.session, toA.data(), toA.size()), RCS_ISOTP_OK);
+    EXPECT_EQ(RcsIsoTpSend(&a.session, toB.data(), toB.size()), RCS_ISOTP_BUSY);
+    EXPECT_TRUE(RcsIsoTpIsSending(&a.session));
+
+    for (int i = 0; i < 10; i++) {
+        Step();
+    }
+    EXPECT_FALSE(RcsIsoTpIsSending(&a.session));
+    EXPECT_THAT(a.events, ::testing::UnorderedElementsAre(RCS_ISOTP_EVENT_TX_DONE, RCS_ISOTP_EVENT_RX_DONE));
+    EXPECT_THAT(b.events, ::testing::UnorderedElementsAre(RCS_ISOTP_EVENT_TX_DONE, RCS_ISOTP_EVENT_RX_DONE));
+    EXPECT_EQ(RecvMessage(&b), toB);
+    EXPECT_EQ(RecvMessage(&a), toA);
+}
+
+// 超过4095字节使用32位长度的首帧
+TEST_F(RcsIsoTpTest, LongMessage)
+{
+    Close(&b);
+    Open(&b, 0x7E8, 0x7E0, 8192, 0, 0);
+    std::vector<uint8_t> image = RandomData(6000);
+    ASSERT_EQ(RcsIsoTpSend(&a.session, image.data(), image.size()), RCS_ISOTP_OK);
+    const RcsCanFrame_t *frames = NULL;
+    ASSERT_EQ(RcsCanQueueRecvAcquire(a.txQueue, &frames), 1u);
+    EXPECT_EQ(frames[0].data[0], 0x10);
+    EXPECT_EQ(frames[0].data[1], 0x00);
+
+    // BS=0时一次流控后连续帧全部发出，发送帧队列满时按节拍重试
+    for (int i = 0; i < 40 && RcsIsoTpIsSending(&a.session); i++) {
+        Step();
+    }
+    EXPECT_THAT(a.events, ::testing::ElementsAre(RCS_ISOTP_EVENT_TX_DONE));
+    EXPECT_EQ(RecvMessage(&b), image);
+}
+
+// 接收FIFO回绕时消息分两段交付，内容不变
+TEST_F(RcsIsoTpTest, ReassembleAcrossWrap)
+{
+    int splitCount = 0;
+    for (int round = 0; round < 20; round++) {
+        std::vector<uint8_t> data = RandomData(100 + rng() % 300);
+        ASSERT_EQ(RcsIsoTpSend(&a.session, data.data(), data.size()), RCS_ISOTP_OK);
+        for (int i = 0; i < 10 && RcsIsoTpIsSending(&a.session); i++) {
+            Step();
+        }
+        bool split = false;
+        ASSERT_EQ(RecvMessage(&b, &split), data);
+        splitCount += split ? 1 : 0;
+    }
+    EXPECT_GT(splitCount, 0);
+}
+
+// STmin限制连续帧的发送间隔
+TEST_F(RcsIsoTpTest, SeparationTime)
+{
+    Close(&b);
+    Open(&b, 0x7E8, 0x7E0, 1024, 0, 2);
+    std::vector<uint8_t> data = RandomData(6 + 7 * 5);
+    ASSERT_EQ(RcsIsoTpSend(&a.session, data.data(), data.size()), RCS_ISOTP_OK);
+
+    int ticks = 0;
+    Forward(&a, &b);
+    Forward(&b, &a);
+    while (RcsIsoTpIsSending(&a.session) && ticks < 100) {
+        Step();
+        ticks++;
+    }
+    // 5个连续帧之间有4个间隔，每个间隔至少2个节拍
+    EXPECT_GE(ticks, 4 * 2);
+    EXPECT_EQ(RecvMessage(&b), data);
+}
+
+// 连续帧丢失时接收方超时并丢弃已重组的部分
+TEST_F(RcsIsoTpTest, ReceiveTimeout)
+{
+    std::vector<uint8_t> data = RandomData(200);
+    dropCfAfter = 2;
+    ASSERT_EQ(RcsIsoTpSend(&a.session, data.data(), data.size()), RCS_ISOTP_OK);
+    for (int i = 0; i < 120; i++) {
+        Step();
+    }
+    EXPECT_THAT(b.events, ::testing::ElementsAre(RCS_ISOTP_EVENT_RX_TIMEOUT));
+    EXPECT_THAT(a.events, ::testing::ElementsAre(RCS_ISOTP_EVENT_TX_TIMEOUT));
+    EXPECT_EQ(RcsFifoGetUsed(b.fifo), 0u);
+    EXPECT_FALSE(RcsIsoTpIsSending(&a.session));
+}
+
+// 每个流控WAIT重新开始N_Bs计时，连续WAIT超过N_WFTmax后放弃发送
+TEST_F(RcsIsoTpTest, FlowControlWaitLimit)
+{
+    std::vector<uint8_t> data = RandomData(100);
+    ASSERT_EQ(RcsIsoTpSend(&a.session, data.data(), data.size()), RCS_ISOTP_OK);
+    RcsCanFrame_t wait = {};
+    wait.id = 0x7E8;
+    wait.len = 3;
+    wait.data[0] = 0x31;
+
+    for (int i = 0; i < RCS_ISOTP_WFT_MAX; i++) {
+        for (int k = 0; k < 40; k++) {
+            RcsTimerWheelTick(wheel);
+            RcsTimerWheelProcess(wheel);
+        }
+        ASSERT_EQ(RcsIsoTpOnFrame(&a.session, &wait), RCS_ISOTP_OK);
+    }
+    EXPECT_TRUE(a.events.empty());
+    EXPECT_TRUE(RcsIsoTpIsSending(&a.session));
+
+    ASSERT_EQ(RcsIsoTpOnFrame(&a.session, &wait), RCS_ISOTP_OK);
+    EXPECT_THAT(a.events, ::testing::ElementsAre(RCS_ISOTP_EVENT_TX_ERROR));
+    EXPECT_FALSE(RcsIsoTpIsSending(&a.session));
+}
+
+// 序号错误
+TEST_F(RcsIsoTpTest, BadSequence)
+{
+    std::vector<uint8_t> data = RandomData(50);
+    ASSERT_EQ(RcsIsoTpSend(&a.session, data.data(), data.size()), RCS_ISOTP_OK);
+    Forward(&a, &b);
+
+    RcsCanFrame_t cf = {};
+    cf.id = 0x7E0;
+    cf.len = 8;
+    cf.data[0] = 0x23;
+    EXPECT_EQ(RcsIsoTpOnFrame(&b.session, &cf), RCS_ISOTP_OK);
+    EXPECT_THAT(b.events, ::testing::ElementsAre(RCS_ISOTP_EVENT_RX_BAD_SEQ));
+    EXPECT_EQ(RcsFifoGetUsed(b.fifo), 0u);
+}
+
+// 接收FIFO放不下时回复OVFLW，发送方收到溢出事件
+TEST_F(RcsIsoTpTest, ReceiverOverflow)
+{
+    std::vector<uint8_t> data = RandomData(2000);
+    ASSERT_EQ(RcsIsoTpSend(&a.session, data.data(), data.size()), RCS_ISOTP_OK);
+    Step();
+    EXPECT_THAT(b.events, ::testing::ElementsAre(RCS_ISOTP_EVENT_RX_OVERFLOW));
+    EXPECT_THAT(a.events, ::testing::ElementsAre(RCS_ISOTP_EVENT_TX_OVERFLOW));
+    EXPECT_FALSE(RcsIsoTpIsSending(&a.session));
+}
+
+// 多个会话共享一个发送帧队列和时间轮
+TEST_F(RcsIsoTpTest, ManySessions)
+{
+    const int count = 8;
+    RcsCanQueue_t wire = RcsCanQueueCreate(256, RCS_CAN_SLOT_CLASSIC);
+    RcsCanQueue_t back = RcsCanQueueCreate(256, RCS_CAN_SLOT_CLASSIC);
+    std::vector<TestNode_t> tx(count), rx(count);
+    std::vector<std::vector<uint8_t>> messages;
+
+    for (int i = 0; i < count; i++) {
+        RcsIsoTpConfig_t config = {};
+        config.timeout = 50;
+        config.wheel = wheel;
+        config.callback = RecordEvent;
+
+        tx[i].fifo = RcsFifoCreate(64);
+        config.txId = 0x600 + i;
+        config.rxId = 0x680 + i;
+        config.rxFifo = tx[i].fifo;
+        config.txQueue = wire;
+        config.arg = &tx[i];
+        ASSERT_EQ(RcsIsoTpInit(&tx[i].session, &config), RCS_ISOTP_OK);
+
+        rx[i].fifo = RcsFifoCreate(512);
+        config.txId = 0x680 + i;
+        config.rxId = 0x600 + i;
+        config.rxFifo = rx[i].fifo;
+        config.txQueue = back;
+        config.blockSize = 2;
+        config.arg = &rx[i];
+        ASSERT_EQ(RcsIsoTpInit(&rx[i].session, &config), RCS_ISOTP_OK);
+
+        messages.push_back(RandomData(20 + i * 30));
+    }
+    for (int i = 0; i < count; i++) {
+        ASSERT_EQ(RcsIsoTpSend(&tx[i].session, messages[i].data(), messages[i].size()), RCS_ISOTP_OK);
+    }
+
+    // 按ID依次尝试各会话，直到有一个接收
+    auto deliver = [&](RcsCanQueue_t queue, std::vector<TestNode_t> &nodes) {
+        const RcsCanFrame_t *frames = NULL;
+        size_t n, total = 0;
+        while ((n = RcsCanQueueRecvAcquire(queue, &frames)) != 0) {
+            for (size_t k = 0; k < n; k++) {
+                for (auto &node : nodes) {
+                    if (RcsIsoTpOnFrame(&node.session, &frames[k]) != RCS_ISOTP_NOT_MINE) {
+                        break;
+                    }
+                }
+            }
+            RcsCanQueueRecvComplete(queue, n);
+            total += n;
+        }
+        return total;
+    };
+    for (int t = 0; t < 20; t++) {
+        RcsTimerWheelTick(wheel);
+        RcsTimerWheelProcess(wheel);
+        while (deliver(wire, rx) + deliver(back, tx) != 0) {
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        EXPECT_EQ(RecvMessage(&rx[i]), messages[i]) << "session " << i;
+        EXPECT_THAT(tx[i].events, ::testing::ElementsAre(RCS_ISOTP_EVENT_TX_DONE));
+        RcsIsoTpReset(&tx[i].session);
+        RcsIsoTpReset(&rx[i].session);
+        RcsFifoDestroy(tx[i].fifo);
+        RcsFifoDestroy(rx[i].fifo);
+    }
+    RcsCanQueueDestroy(wire);
+    RcsCanQueueDestroy(back);
+}
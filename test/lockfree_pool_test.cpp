@@ -0,0 +1,157 @@
+/**
+ * @file lockfree_pool_test.cpp
+ * @brief 无锁内存池的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "lockfree_pool.h"
+
+// 测试夹具
+class RcsLfPoolTest : public ::testing::Test {
+protected:
+    static constexpr size_t blockSize = 16;
+    static constexpr size_t blockCount = 64;
+    RcsLfPoolHandle_t handle;
+    alignas(void*) uint8_t memory[RCS_LFPOOL_MEM_SIZE(blockSize, blockCount)];
+    RcsLfPool_t pool;
+
+    void SetUp() override {
+        pool = RcsLfPoolCreateStatic(blockSize, blockCount, &handle, memory);
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsLfPoolTest, InvalidParam)
+{
+    RcsLfPoolHandle_t other;
+    EXPECT_EQ(RcsLfPoolCreateStatic(0, blockCount, &other, memory), nullptr);
+    EXPECT_EQ(RcsLfPoolCreateStatic(blockSize, 0, &other, memory), nullptr);
+    EXPECT_EQ(RcsLfPoolCreateStatic(blockSize, blockCount, &other, memory + 1), nullptr);
+    EXPECT_EQ(RcsLfPoolFree(pool, memory + 2), RCS_LFPOOL_INVALID_PARAM);
+    EXPECT_EQ(RcsLfPoolFree(pool, NULL), RCS_LFPOOL_INVALID_PARAM);
+    EXPECT_EQ(RcsLfPoolCacheInit(NULL, pool), RCS_LFPOOL_INVALID_PARAM);
+}
+
+// 单线程申请到耗尽
+TEST_F(RcsLfPoolTest, AllocUntilExhausted)
+{
+    std::set<void*> blocks;
+    for (size_t i = 0; i < blockCount; i++) {
+        void* block = RcsLfPoolAlloc(pool);
+        ASSERT_NE(block, nullptr);
+        blocks.insert(block);
+    }
+    EXPECT_EQ(blocks.size(), blockCount);
+    EXPECT_EQ(RcsLfPoolAlloc(pool), nullptr);
+    EXPECT_EQ(RcsLfPoolGetFree(pool), 0u);
+
+    for (void* block : blocks) {
+        EXPECT_EQ(RcsLfPoolFree(pool, block), RCS_LFPOOL_OK);
+    }
+    EXPECT_EQ(RcsLfPoolGetFree(pool), blockCount);
+}
+
+// 块大小不是指针大小的整数倍时，每个块仍按指针对齐
+TEST_F(RcsLfPoolTest, BlocksPointerAligned)
+{
+    EXPECT_EQ(RCS_LFPOOL_BLOCK_SIZE(12) % sizeof(void*), 0u);
+    RcsLfPool_t odd = RcsLfPoolCreate(12, 8);
+    ASSERT_NE(odd, nullptr);
+    for (size_t i = 0; i < 8; i++) {
+        void* block = RcsLfPoolAlloc(odd);
+        ASSERT_NE(block, nullptr);
+        EXPECT_EQ((uintptr_t)block % sizeof(void*), 0u);
+    }
+    RcsLfPoolDestroy(odd);
+}
+
+// 出入栈都会推进版本号
+TEST_F(RcsLfPoolTest, TagAdvances)
+{
+    RcsLfPoolHead_t before = handle.head;
+    void* block = RcsLfPoolAlloc(pool);
+    RcsLfPoolFree(pool, block);
+    EXPECT_EQ(handle.head & RCS_LFPOOL_NIL, before & RCS_LFPOOL_NIL);
+    EXPECT_NE(handle.head, before);
+}
+
+// 线程本地缓存批量取回与归还
+TEST_F(RcsLfPoolTest, CacheBatches)
+{
+    RcsLfPoolCache_t cache;
+    ASSERT_EQ(RcsLfPoolCacheInit(&cache, pool), RCS_LFPOOL_OK);
+
+    void* block = RcsLfPoolCacheAlloc(&cache);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(cache.count, RCS_LFPOOL_CACHE_SIZE / 2 - 1u);
+    EXPECT_EQ(RcsLfPoolGetFree(pool), blockCount - RCS_LFPOOL_CACHE_SIZE / 2);
+
+    RcsLfPoolCacheFree(&cache, block);
+    RcsLfPoolCacheFlush(&cache);
+    EXPECT_EQ(cache.count, 0u);
+    EXPECT_EQ(RcsLfPoolGetFree(pool), blockCount);
+}
+
+// 多线程并发申请释放，每个块同一时刻只属于一个线程
+TEST_F(RcsLfPoolTest, ConcurrentOwnership)
+{
+    constexpr int threadCount = 4;
+    constexpr int iterations = 20000;
+    std::atomic<bool> conflict{false};
+
+    auto worker = [&](int id, bool useCache) {
+        RcsLfPoolCache_t cache;
+        RcsLfPoolCacheInit(&cache, pool);
+        std::vector<uint32_t*> held;
+        for (int i = 0; i < iterations; i++) {
+            if (held.size() < 8 && (i % 3 != 2)) {
+                uint32_t* block = (uint32_t*)(useCache ? RcsLfPoolCacheAlloc(&cache) : RcsLfPoolAlloc(pool));
+                if (block != nullptr) {
+                    block[1] = (uint32_t)id;
+                    held.push_back(block);
+                }
+            }
+            else if (!held.empty()) {
+                uint32_t* block = held.back();
+                held.pop_back();
+                if (block[1] != (uint32_t)id) {
+                    conflict = true;
+                }
+                if (useCache) {
+                    RcsLfPoolCacheFree(&cache, block);
+                }
+                else {
+                    RcsLfPoolFree(pool, block);
+                }
+            }
+        }
+        for (uint32_t* block : held) {
+            RcsLfPoolFree(pool, block);
+        }
+        RcsLfPoolCacheFlush(&cache);
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back(worker, t, t % 2 == 0);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_FALSE(conflict);
+    EXPECT_EQ(RcsLfPoolGetFree(pool), blockCount);
+
+    std::set<void*> blocks;
+    while (void* block = RcsLfPoolAlloc(pool)) {
+        blocks.insert(block);
+    }
+    EXPECT_EQ(blocks.size(), blockCount);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 模拟链表模式DMA的节点（类似STM32 GPDMA的LLI），按链表顺序传输，整条链结束后产生一次传输完成中断
+typedef struct MockDmaNode
+{
+    const uint8_t            *src;
+    uint16_t                  count;   // 单个节点最多65535字节
+    const struct MockDmaNode *next;    // 为NULL表示链表结束
+}MockDmaNode_t;
+
+// 启动传输，通道忙时返回-1
+int mock_dma_start(const MockDmaNode_t *head);
+
+// 通道是否正在传输
+int mock_dma_busy(void);
+
+// 注册传输完成中断的处理函数
+void mock_dma_set_tc_handler(void (*handler)(void *), void *arg);
+
+// 执行当前的整条链，把数据送到外设，然后触发传输完成中断，返回传输的字节数
+size_t mock_dma_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+// 测试中使用的观察接口
+namespace mock_dma {
+    void reset();
+
+    // 外设收到的全部数据
+    extern std::vector<uint8_t> sink;
+
+    // 传输完成中断的次数
+    extern int irqCount;
+}
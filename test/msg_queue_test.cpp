@@ -0,0 +1,147 @@
+/**
+ * @file msg_queue_test.cpp
+ * @brief 指针传递消息队列的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstring>
+
+#include "msg_queue.h"
+
+// 测试夹具
+class RcsMsgQueueTest : public ::testing::Test {
+protected:
+    static constexpr size_t payloadSize = 1024;
+    static constexpr size_t blockCount = 4;
+    static constexpr size_t depth = 3;
+    RcsPool_t pool;
+    RcsMsgQueueHandle_t handle;
+    void* slots[depth];
+    RcsMsgQueue_t queue;
+
+    void SetUp() override {
+        pool = RcsPoolCreate(RCS_MSG_BLOCK_SIZE(payloadSize), blockCount);
+        queue = RcsMsgQueueCreateStatic(depth, &handle, slots);
+    }
+
+    void TearDown() override {
+        RcsPoolDestroy(pool);
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsMsgQueueTest, InvalidParam)
+{
+    void* msg = nullptr;
+    EXPECT_EQ(RcsMsgAlloc(NULL, 1), nullptr);
+    EXPECT_EQ(RcsMsgAlloc(pool, 0), nullptr);
+    EXPECT_EQ(RcsMsgAlloc(pool, payloadSize + 1), nullptr);
+    EXPECT_EQ(RcsMsgQueueCreateStatic(0, &handle, slots), nullptr);
+    EXPECT_EQ(RcsMsgQueueSend(queue, NULL), RCS_MSG_INVALID_PARAM);
+    EXPECT_EQ(RcsMsgQueueRecv(queue, NULL), RCS_MSG_INVALID_PARAM);
+    EXPECT_EQ(RcsMsgQueueRecv(queue, &msg), RCS_MSG_EMPTY);
+}
+
+// 发送接收只传递指针，接收方释放后归还内存池
+TEST_F(RcsMsgQueueTest, ZeroCopyHandoff)
+{
+    uint8_t* tx = (uint8_t*)RcsMsgAlloc(pool, payloadSize);
+    ASSERT_NE(tx, nullptr);
+    EXPECT_EQ(RcsMsgGetSize(tx), payloadSize);
+    memset(tx, 0x3C, payloadSize);
+    EXPECT_EQ(RcsPoolGetFree(pool), blockCount - 1);
+
+    ASSERT_EQ(RcsMsgQueueSend(queue, tx), RCS_MSG_OK);
+    void* rx = nullptr;
+    ASSERT_EQ(RcsMsgQueueRecv(queue, &rx), RCS_MSG_OK);
+    EXPECT_EQ(rx, tx);
+    EXPECT_EQ(((uint8_t*)rx)[payloadSize - 1], 0x3C);
+
+    RcsMsgRelease(rx);
+    EXPECT_EQ(RcsPoolGetFree(pool), blockCount);
+}
+
+// 队列满时引用仍归发送方
+TEST_F(RcsMsgQueueTest, QueueFull)
+{
+    void* msgs[depth + 1];
+    for (size_t i = 0; i <= depth; i++) {
+        msgs[i] = RcsMsgAlloc(pool, 8);
+        ASSERT_NE(msgs[i], nullptr);
+    }
+    for (size_t i = 0; i < depth; i++) {
+        ASSERT_EQ(RcsMsgQueueSend(queue, msgs[i]), RCS_MSG_OK);
+    }
+    EXPECT_EQ(RcsMsgQueueSend(queue, msgs[depth]), RCS_MSG_FULL);
+    EXPECT_EQ(RcsMsgQueueGetCount(queue), depth);
+    RcsMsgRelease(msgs[depth]);
+
+    // 按先进先出顺序取出
+    for (size_t i = 0; i < depth; i++) {
+        void* rx = nullptr;
+        ASSERT_EQ(RcsMsgQueueRecv(queue, &rx), RCS_MSG_OK);
+        EXPECT_EQ(rx, msgs[i]);
+        RcsMsgRelease(rx);
+    }
+    EXPECT_EQ(RcsPoolGetFree(pool), blockCount);
+}
+
+// 深度不是2的幂时，读写位置反复回绕后仍按先进先出顺序取出
+TEST_F(RcsMsgQueueTest, IndexWrap)
+{
+    void* msgs[2];
+    for (size_t i = 0; i < 2; i++) {
+        msgs[i] = RcsMsgAlloc(pool, 8);
+        ASSERT_NE(msgs[i], nullptr);
+    }
+    for (size_t round = 0; round < 10; round++) {
+        ASSERT_EQ(RcsMsgQueueSend(queue, msgs[0]), RCS_MSG_OK);
+        ASSERT_EQ(RcsMsgQueueSend(queue, msgs[1]), RCS_MSG_OK);
+        EXPECT_LT(handle.indexWrite, depth);
+        EXPECT_EQ(RcsMsgQueueGetCount(queue), 2u);
+        void* rx = nullptr;
+        ASSERT_EQ(RcsMsgQueueRecv(queue, &rx), RCS_MSG_OK);
+        EXPECT_EQ(rx, msgs[0]);
+        ASSERT_EQ(RcsMsgQueueRecv(queue, &rx), RCS_MSG_OK);
+        EXPECT_EQ(rx, msgs[1]);
+        EXPECT_EQ(handle.indexRead, handle.indexWrite);
+    }
+    RcsMsgRelease(msgs[0]);
+    RcsMsgRelease(msgs[1]);
+    EXPECT_EQ(RcsPoolGetFree(pool), blockCount);
+}
+
+// 一对多分发，最后一个接收方释放后才归还
+TEST_F(RcsMsgQueueTest, BroadcastFanOut)
+{
+    RcsMsgQueue_t second = RcsMsgQueueCreate(2);
+    RcsMsgQueue_t third = RcsMsgQueueCreate(1);
+    RcsMsgQueue_t queues[3] = {queue, second, third};
+
+    // 先占满第三个队列，使其投递失败
+    void* filler = RcsMsgAlloc(pool, 8);
+    ASSERT_EQ(RcsMsgQueueSend(third, filler), RCS_MSG_OK);
+
+    void* msg = RcsMsgAlloc(pool, 16);
+    ASSERT_NE(msg, nullptr);
+    EXPECT_EQ(RcsMsgQueueBroadcast(queues, 3, msg), 2);
+
+    void* a = nullptr;
+    void* b = nullptr;
+    ASSERT_EQ(RcsMsgQueueRecv(queue, &a), RCS_MSG_OK);
+    ASSERT_EQ(RcsMsgQueueRecv(second, &b), RCS_MSG_OK);
+    EXPECT_EQ(a, msg);
+    EXPECT_EQ(b, msg);
+
+    RcsMsgRelease(a);
+    EXPECT_EQ(RcsPoolGetFree(pool), blockCount - 2);
+    RcsMsgRelease(b);
+    EXPECT_EQ(RcsPoolGetFree(pool), blockCount - 1);
+
+    // 销毁队列时释放残留消息
+    RcsMsgQueueDestroy(third);
+    RcsMsgQueueDestroy(second);
+    EXPECT_EQ(RcsPoolGetFree(pool), blockCount);
+}
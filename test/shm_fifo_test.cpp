@@ -0,0 +1,158 @@
+/**
+ * @file shm_fifo_test.cpp
+ * @brief 共享内存FIFO的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstring>
+#include <string>
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "shm_fifo.h"
+
+// 测试夹具：创建者作为生产者，挂接者作为消费者
+class RcsShmFifoTest : public ::testing::Test {
+protected:
+    RcsShmFifo_t producer;
+    RcsShmFifo_t consumer;
+    std::string name;
+    static constexpr size_t capacity = 32;
+
+    void SetUp() override {
+        name = "/rcs_shm_fifo_test_" + std::to_string(getpid());
+        RcsShmFifoUnlink(name.c_str());
+        ASSERT_EQ(RcsShmFifoCreate(&producer, name.c_str(), capacity), RCS_FIFO_OK);
+        ASSERT_EQ(RcsShmFifoAttach(&consumer, name.c_str()), RCS_FIFO_OK);
+    }
+
+    void TearDown() override {
+        RcsShmFifoDetach(&consumer);
+        RcsShmFifoDetach(&producer);
+        RcsShmFifoUnlink(name.c_str());
+    }
+};
+
+// 参数与区域校验
+TEST_F(RcsShmFifoTest, InvalidParam)
+{
+    void* memAcquired[2] = {nullptr};
+    RcsShmFifo_t other;
+    alignas(8) uint8_t garbage[256] = {0};
+
+    EXPECT_EQ(RcsShmFifoCreate(&other, name.c_str(), capacity), RCS_FIFO_NOT_ALLOWED);
+    EXPECT_EQ(RcsShmFifoAttachRegion(&other, garbage, sizeof(garbage)), RCS_FIFO_ERROR);
+    EXPECT_EQ(RcsShmFifoInitRegion(&other, garbage, 16), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsShmFifoSendAcquire(&producer, 0, memAcquired), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsShmFifoSendAcquire(&producer, capacity + 1, memAcquired), RCS_FIFO_NO_SPACE);
+    EXPECT_EQ(RcsShmFifoRecvAcquire(&consumer, 1, memAcquired), RCS_FIFO_NO_DATA);
+    EXPECT_EQ(RcsShmFifoSendComplete(NULL), RCS_FIFO_INVALID_PARAM);
+    EXPECT_EQ(RcsShmFifoRecvComplete(NULL), RCS_FIFO_INVALID_PARAM);
+
+    // 没有进行中的申请时不允许完成
+    EXPECT_EQ(RcsShmFifoSendComplete(&producer), RCS_FIFO_NOT_ALLOWED);
+    EXPECT_EQ(RcsShmFifoRecvComplete(&consumer), RCS_FIFO_NOT_ALLOWED);
+}
+
+// 两个映射地址不同，但看到同一份数据
+TEST_F(RcsShmFifoTest, DifferentMappings)
+{
+    ASSERT_NE((void*)producer.header, (void*)consumer.header);
+    EXPECT_EQ(consumer.header->capacity, capacity);
+
+    void* txBlk[2] = {nullptr}, *rxBlk[2] = {nullptr};
+    ASSERT_EQ(RcsShmFifoSendAcquire(&producer, 5, txBlk), 5);
+    ASSERT_EQ(RcsShmFifoSendAcquire(&producer, 5, txBlk), RCS_FIFO_NOT_ALLOWED);
+    memcpy(txBlk[0], "hello", 5);
+
+    // 未完成前消费者看不到
+    ASSERT_EQ(RcsShmFifoRecvAcquire(&consumer, 5, rxBlk), RCS_FIFO_NO_DATA);
+    ASSERT_EQ(RcsShmFifoSendComplete(&producer), RCS_FIFO_OK);
+
+    ASSERT_EQ(RcsShmFifoRecvAcquire(&consumer, 5, rxBlk), 5);
+    EXPECT_NE(rxBlk[0], txBlk[0]);
+    EXPECT_EQ(memcmp(rxBlk[0], "hello", 5), 0);
+    ASSERT_EQ(RcsShmFifoRecvComplete(&consumer), RCS_FIFO_OK);
+}
+
+// 全部容量可用，且跨界时返回两段
+TEST_F(RcsShmFifoTest, FullCapacityAndWrap)
+{
+    void* txBlk[2] = {nullptr}, *rxBlk[2] = {nullptr};
+
+    ASSERT_EQ(RcsShmFifoSendAcquire(&producer, capacity, txBlk), (int)capacity);
+    ASSERT_EQ(RcsShmFifoSendComplete(&producer), RCS_FIFO_OK);
+    ASSERT_EQ(RcsShmFifoSendAcquire(&producer, 1, txBlk), RCS_FIFO_NO_SPACE);
+
+    ASSERT_EQ(RcsShmFifoRecvAcquire(&consumer, capacity - 3, rxBlk), (int)capacity - 3);
+    ASSERT_EQ(RcsShmFifoRecvComplete(&consumer), RCS_FIFO_OK);
+
+    ASSERT_EQ(RcsShmFifoSendAcquire(&producer, 6, txBlk), 6);
+    EXPECT_EQ(txBlk[0], (void*)producer.data);
+    memcpy(txBlk[0], "ABCDEF", 6);
+    ASSERT_EQ(RcsShmFifoSendComplete(&producer), RCS_FIFO_OK);
+
+    ASSERT_EQ(RcsShmFifoRecvAcquire(&consumer, 9, rxBlk), 3);
+    ASSERT_EQ(rxBlk[1], (void*)consumer.data);
+    EXPECT_EQ(memcmp(rxBlk[1], "ABCDEF", 6), 0);
+    ASSERT_EQ(RcsShmFifoRecvComplete(&consumer), RCS_FIFO_OK);
+}
+
+// 跨进程传输：子进程作为生产者，3字节的记录会不断跨界
+TEST_F(RcsShmFifoTest, CrossProcessStream)
+{
+    constexpr uint32_t total = 20000;
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        RcsShmFifo_t child;
+        if (RcsShmFifoAttach(&child, name.c_str()) != RCS_FIFO_OK) {
+            _exit(1);
+        }
+        for (uint32_t i = 0; i < total; ) {
+            void* txBlk[2] = {nullptr};
+            int first = RcsShmFifoSendAcquire(&child, 3, txBlk);
+            if (first < 0) {
+                sched_yield();
+                continue;
+            }
+            uint8_t bytes[3] = {(uint8_t)i, (uint8_t)(i >> 8), (uint8_t)(i >> 16)};
+            memcpy(txBlk[0], bytes, first);
+            if (txBlk[1] != NULL) {
+                memcpy(txBlk[1], bytes + first, 3 - first);
+            }
+            RcsShmFifoSendComplete(&child);
+            i++;
+        }
+        RcsShmFifoDetach(&child);
+        _exit(0);
+    }
+
+    bool ordered = true;
+    for (uint32_t expect = 0; expect < total; ) {
+        void* rxBlk[2] = {nullptr};
+        int first = RcsShmFifoRecvAcquire(&consumer, 3, rxBlk);
+        if (first < 0) {
+            sched_yield();
+            continue;
+        }
+        uint8_t bytes[3];
+        memcpy(bytes, rxBlk[0], first);
+        if (rxBlk[1] != NULL) {
+            memcpy(bytes + first, rxBlk[1], 3 - first);
+        }
+        uint32_t value = bytes[0] | (bytes[1] << 8) | ((uint32_t)bytes[2] << 16);
+        ordered = ordered && (value == expect);
+        RcsShmFifoRecvComplete(&consumer);
+        expect++;
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    EXPECT_TRUE(ordered);
+}
@@ -0,0 +1,169 @@
+/**
+ * @file slot_map_test.cpp
+ * @brief 槽表的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <map>
+#include <random>
+
+#include "slot_map.h"
+#include "siso_fifo.h"
+
+typedef struct
+{
+    uint32_t canId;
+    uint32_t state;
+}TestNode_t;
+
+// 测试夹具
+class RcsSlotMapTest : public ::testing::Test {
+protected:
+    static constexpr size_t capacity = 8;
+    RcsSlotMapHandle_t handle;
+    alignas(void*) uint8_t memory[RCS_SLOTMAP_MEM_SIZE(sizeof(TestNode_t), capacity)];
+    RcsSlotMap_t map;
+
+    void SetUp() override {
+        map = RcsSlotMapCreateStatic(sizeof(TestNode_t), capacity, &handle, memory);
+    }
+
+    RcsSlotHandle_t insertNode(uint32_t canId) {
+        RcsSlotHandle_t h = RCS_SLOTMAP_INVALID_HANDLE;
+        TestNode_t* node = (TestNode_t*)RcsSlotMapInsert(map, &h);
+        if (node != nullptr) {
+            node->canId = canId;
+            node->state = 0;
+        }
+        return h;
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsSlotMapTest, InvalidParam)
+{
+    RcsSlotMapHandle_t other;
+    RcsSlotHandle_t h;
+    EXPECT_EQ(RcsSlotMapCreateStatic(0, capacity, &other, memory), nullptr);
+    EXPECT_EQ(RcsSlotMapCreateStatic(sizeof(TestNode_t), 0, &other, memory), nullptr);
+    EXPECT_EQ(RcsSlotMapCreateStatic(sizeof(TestNode_t), capacity, &other, memory + 1), nullptr);
+    EXPECT_EQ(RcsSlotMapCreate(4, RCS_SLOTMAP_MAX_CAPACITY + 1), nullptr);
+    EXPECT_EQ(RcsSlotMapInsert(NULL, &h), nullptr);
+    EXPECT_EQ(RcsSlotMapInsert(map, NULL), nullptr);
+    EXPECT_EQ(RcsSlotMapRemove(NULL, 0), RCS_SLOTMAP_INVALID_PARAM);
+    EXPECT_EQ(RcsSlotMapGet(map, RCS_SLOTMAP_INVALID_HANDLE), nullptr);
+
+    // 伪造的句柄（版本号恰好匹配空闲槽）也不能命中
+    EXPECT_EQ(RcsSlotMapGet(map, (1u << 16) | 3), nullptr);
+    EXPECT_EQ(RcsSlotMapRemove(map, (1u << 16) | 3), RCS_SLOTMAP_STALE);
+}
+
+// 删除后旧句柄失效，槽被复用时版本号不同
+TEST_F(RcsSlotMapTest, StaleHandle)
+{
+    RcsSlotHandle_t a = insertNode(0x100);
+    RcsSlotHandle_t b = insertNode(0x200);
+    ASSERT_NE(a, RCS_SLOTMAP_INVALID_HANDLE);
+    EXPECT_EQ(((TestNode_t*)RcsSlotMapGet(map, a))->canId, 0x100u);
+
+    EXPECT_EQ(RcsSlotMapRemove(map, a), RCS_SLOTMAP_OK);
+    EXPECT_EQ(RcsSlotMapGet(map, a), nullptr);
+    EXPECT_EQ(RcsSlotMapRemove(map, a), RCS_SLOTMAP_STALE);
+
+    RcsSlotHandle_t c = insertNode(0x300);
+    EXPECT_EQ(RCS_SLOTMAP_HANDLE_INDEX(c), RCS_SLOTMAP_HANDLE_INDEX(a));
+    EXPECT_NE(c, a);
+    EXPECT_EQ(RcsSlotMapGet(map, a), nullptr);
+    EXPECT_EQ(((TestNode_t*)RcsSlotMapGet(map, b))->canId, 0x200u);
+    EXPECT_EQ(((TestNode_t*)RcsSlotMapGet(map, c))->canId, 0x300u);
+
+    RcsSlotMapClear(map);
+    EXPECT_EQ(RcsSlotMapGetCount(map), 0u);
+    EXPECT_EQ(RcsSlotMapGet(map, b), nullptr);
+    EXPECT_EQ(RcsSlotMapGet(map, c), nullptr);
+}
+
+// 满、紧密遍历与句柄反查
+TEST_F(RcsSlotMapTest, DenseIteration)
+{
+    RcsSlotHandle_t handles[capacity];
+    for (size_t i = 0; i < capacity; i++) {
+        handles[i] = insertNode(0x100 + i);
+    }
+    RcsSlotHandle_t h;
+    EXPECT_EQ(RcsSlotMapInsert(map, &h), nullptr);
+
+    RcsSlotMapRemove(map, handles[1]);
+    RcsSlotMapRemove(map, handles[5]);
+    ASSERT_EQ(RcsSlotMapGetCount(map), capacity - 2);
+
+    TestNode_t* nodes = (TestNode_t*)RcsSlotMapGetData(map);
+    uint32_t sum = 0;
+    for (size_t i = 0; i < RcsSlotMapGetCount(map); i++) {
+        sum += nodes[i].canId;
+        EXPECT_EQ(RcsSlotMapGet(map, RcsSlotMapHandleAt(map, i)), &nodes[i]);
+    }
+    EXPECT_EQ(sum, (0x100u * capacity + 28u) - (0x101u + 0x105u));
+    EXPECT_EQ(RcsSlotMapHandleAt(map, capacity - 2), RCS_SLOTMAP_INVALID_HANDLE);
+}
+
+// 句柄通过FIFO传递
+TEST_F(RcsSlotMapTest, HandleThroughFifo)
+{
+    RcsFifo_t fifo = RcsFifoCreate(16);
+    RcsSlotHandle_t sent = insertNode(0x7FF);
+    void* memAcquired[2] = {nullptr};
+    ASSERT_EQ(RcsFifoSendAcquire(fifo, sizeof(sent), memAcquired), (int)sizeof(sent));
+    memcpy(memAcquired[0], &sent, sizeof(sent));
+    RcsFifoSendComplete(fifo, (const void**)memAcquired);
+
+    RcsSlotHandle_t received = RCS_SLOTMAP_INVALID_HANDLE;
+    ASSERT_EQ(RcsFifoRecvAcquire(fifo, sizeof(received), memAcquired), (int)sizeof(received));
+    memcpy(&received, memAcquired[0], sizeof(received));
+    RcsFifoRecvComplete(fifo, (const void**)memAcquired);
+    EXPECT_EQ(((TestNode_t*)RcsSlotMapGet(map, received))->canId, 0x7FFu);
+    RcsFifoDestroy(fifo);
+}
+
+// 随机插入删除，与std::map对照
+TEST_F(RcsSlotMapTest, RandomAgainstReference)
+{
+    RcsSlotMap_t dynamic = RcsSlotMapCreate(sizeof(uint32_t), 64);
+    ASSERT_NE(dynamic, nullptr);
+    std::map<RcsSlotHandle_t, uint32_t> reference;
+    std::vector<RcsSlotHandle_t> removed;
+    std::mt19937 rng(36);
+
+    for (uint32_t step = 0; step < 20000; step++) {
+        if (reference.empty() || (rng() % 2 == 0 && reference.size() < 64)) {
+            RcsSlotHandle_t h;
+            uint32_t* value = (uint32_t*)RcsSlotMapInsert(dynamic, &h);
+            ASSERT_NE(value, nullptr);
+            *value = step;
+            ASSERT_EQ(reference.count(h), 0u);
+            reference[h] = step;
+        }
+        else {
+            auto it = reference.begin();
+            std::advance(it, rng() % reference.size());
+            ASSERT_EQ(RcsSlotMapRemove(dynamic, it->first), RCS_SLOTMAP_OK);
+            removed.push_back(it->first);
+            reference.erase(it);
+        }
+    }
+
+    ASSERT_EQ(RcsSlotMapGetCount(dynamic), reference.size());
+    for (auto& kv : reference) {
+        uint32_t* value = (uint32_t*)RcsSlotMapGet(dynamic, kv.first);
+        ASSERT_NE(value, nullptr);
+        EXPECT_EQ(*value, kv.second);
+    }
+    for (RcsSlotHandle_t h : removed) {
+        if (reference.count(h) == 0) {
+            EXPECT_EQ(RcsSlotMapGet(dynamic, h), nullptr);
+        }
+    }
+    RcsSlotMapDestroy(dynamic);
+}
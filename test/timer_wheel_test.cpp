@@ -0,0 +1,189 @@
+/**
+ * @file timer_wheel_test.cpp
+ * @brief 分层时间轮的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "timer_wheel.h"
+
+typedef struct
+{
+    RcsTimerNode_t node;
+    RcsTimerWheel_t wheel;
+    uint32_t expectTick;
+    uint32_t firedTick;
+    int fireCount;
+    uint32_t period;
+}TestSession_t;
+
+static void SessionTimeout(RcsTimerNode_t *node, void *arg)
+{
+    TestSession_t *session = (TestSession_t *)arg;
+    EXPECT_EQ(node, &session->node);
+    session->firedTick = RcsTimerWheelGetNow(session->wheel);
+    session->fireCount++;
+    if (session->period != 0) {
+        RcsTimerStart(session->wheel, node, session->period);
+    }
+}
+
+// 测试夹具
+class RcsTimerWheelTest : public ::testing::Test {
+protected:
+    RcsTimerWheelHandle_t handle;
+    RcsTimerWheel_t wheel;
+
+    void SetUp() override {
+        wheel = RcsTimerWheelCreateStatic(&handle);
+    }
+
+    void initSession(TestSession_t* session, uint32_t period = 0) {
+        memset(session, 0, sizeof(TestSession_t));
+        session->wheel = wheel;
+        session->period = period;
+        RcsTimerNodeInit(&session->node, SessionTimeout, session);
+    }
+
+    size_t runTicks(uint32_t ticks) {
+        size_t fired = 0;
+        for (uint32_t i = 0; i < ticks; i++) {
+            RcsTimerWheelTick(wheel);
+            fired += RcsTimerWheelProcess(wheel);
+        }
+        return fired;
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsTimerWheelTest, InvalidParam)
+{
+    RcsTimerNode_t node;
+    EXPECT_EQ(RcsTimerWheelCreateStatic(NULL), nullptr);
+    EXPECT_EQ(RcsTimerNodeInit(NULL, SessionTimeout, NULL), RCS_TIMER_INVALID_PARAM);
+    EXPECT_EQ(RcsTimerNodeInit(&node, NULL, NULL), RCS_TIMER_INVALID_PARAM);
+    RcsTimerNodeInit(&node, SessionTimeout, NULL);
+    EXPECT_EQ(RcsTimerStart(NULL, &node, 1), RCS_TIMER_INVALID_PARAM);
+    EXPECT_EQ(RcsTimerStop(wheel, NULL), RCS_TIMER_INVALID_PARAM);
+    EXPECT_EQ(RcsTimerWheelProcess(NULL), 0u);
+}
+
+// 单次定时在准确的节拍到期，停止后不再到期
+TEST_F(RcsTimerWheelTest, StartStop)
+{
+    TestSession_t a, b;
+    initSession(&a);
+    initSession(&b);
+    RcsTimerStart(wheel, &a.node, 5);
+    RcsTimerStart(wheel, &b.node, 5);
+    EXPECT_TRUE(RcsTimerIsActive(&a.node));
+
+    EXPECT_EQ(runTicks(4), 0u);
+    EXPECT_EQ(RcsTimerStop(wheel, &b.node), RCS_TIMER_OK);
+    EXPECT_FALSE(RcsTimerIsActive(&b.node));
+    EXPECT_EQ(runTicks(1), 1u);
+    EXPECT_EQ(a.firedTick, 5u);
+    EXPECT_FALSE(RcsTimerIsActive(&a.node));
+    EXPECT_EQ(b.fireCount, 0);
+
+    // 重复停止无副作用，重新启动则重新计时
+    EXPECT_EQ(RcsTimerStop(wheel, &a.node), RCS_TIMER_OK);
+    RcsTimerStart(wheel, &a.node, 0);
+    RcsTimerStart(wheel, &a.node, 100);
+    EXPECT_EQ(runTicks(99), 0u);
+    EXPECT_EQ(runTicks(1), 1u);
+    EXPECT_EQ(a.firedTick, 105u);
+}
+
+// 回调中重启实现周期定时
+TEST_F(RcsTimerWheelTest, PeriodicRestart)
+{
+    TestSession_t s;
+    initSession(&s, 7);
+    RcsTimerStart(wheel, &s.node, 7);
+    runTicks(700);
+    EXPECT_EQ(s.fireCount, 100);
+    EXPECT_EQ(s.firedTick, 700u);
+}
+
+// 中断中累积多个节拍，任务一次处理，回调按节拍分批执行
+TEST_F(RcsTimerWheelTest, DeferredTicksFromIsr)
+{
+    TestSession_t sessions[3];
+    for (int i = 0; i < 3; i++) {
+        initSession(&sessions[i]);
+        RcsTimerStart(wheel, &sessions[i].node, 10 + i);
+    }
+
+    std::thread isr([&]() {
+        for (int i = 0; i < 20; i++) {
+            RcsTimerWheelTick(wheel);
+        }
+    });
+    isr.join();
+
+    EXPECT_EQ(RcsTimerWheelGetNow(wheel), 0u);
+    EXPECT_EQ(RcsTimerWheelProcess(wheel), 3u);
+    EXPECT_EQ(RcsTimerWheelGetNow(wheel), 20u);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(sessions[i].firedTick, 10u + i);
+    }
+}
+
+// 跨越各层级联边界以及超出最大直接定时范围的延时
+TEST_F(RcsTimerWheelTest, LongDelays)
+{
+    const uint32_t delays[] = {63, 64, 65, 4095, 4096, 4097, 262143, 262144,
+                               RCS_TIMER_MAX_DELAY, RCS_TIMER_MAX_DELAY + 1, RCS_TIMER_MAX_DELAY + 5000};
+    const size_t count = sizeof(delays) / sizeof(delays[0]);
+    std::vector<TestSession_t> sessions(count);
+
+    // 从非零相位开始，覆盖各层槽下标不为0的情况
+    runTicks(1000);
+    for (size_t i = 0; i < count; i++) {
+        initSession(&sessions[i]);
+        RcsTimerStart(wheel, &sessions[i].node, delays[i]);
+        sessions[i].expectTick = 1000 + delays[i];
+    }
+
+    EXPECT_EQ(runTicks(RCS_TIMER_MAX_DELAY + 6000), count);
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(sessions[i].fireCount, 1) << "delay " << delays[i];
+        EXPECT_EQ(sessions[i].firedTick, sessions[i].expectTick) << "delay " << delays[i];
+    }
+}
+
+// 数千个定时器随机启动、停止，均在准确节拍到期
+TEST_F(RcsTimerWheelTest, ThousandsOfTimers)
+{
+    constexpr size_t count = 5000;
+    std::vector<TestSession_t> sessions(count);
+    std::mt19937 rng(37);
+
+    for (size_t i = 0; i < count; i++) {
+        initSession(&sessions[i]);
+        uint32_t delay = 1 + rng() % 20000;
+        RcsTimerStart(wheel, &sessions[i].node, delay);
+        sessions[i].expectTick = delay;
+    }
+    size_t stopped = 0;
+    for (size_t i = 0; i < count; i += 3) {
+        RcsTimerStop(wheel, &sessions[i].node);
+        stopped++;
+    }
+
+    EXPECT_EQ(runTicks(20000), count - stopped);
+    for (size_t i = 0; i < count; i++) {
+        if (i % 3 == 0) {
+            EXPECT_EQ(sessions[i].fireCount, 0);
+        }
+        else {
+            ASSERT_EQ(sessions[i].firedTick, sessions[i].expectTick);
+        }
+    }
+}
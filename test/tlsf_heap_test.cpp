@@ -0,0 +1,289 @@
+/**
+ * @file tlsf_heap_test.cpp
+ * @brief TLSF实时堆的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "tlsf_heap.h"
+#include "siso_fifo.h"
+
+// FreeRTOS heap_4的模型：按地址排序的空闲链表，首次适配，释放时与相邻空闲块合并
+class Heap4Model {
+public:
+    Heap4Model(uint8_t* mem, size_t size) {
+        uint8_t* begin = (uint8_t*)(((uintptr_t)mem + alignMask) & ~(uintptr_t)alignMask);
+        uint8_t* stop = (uint8_t*)(((uintptr_t)mem + size - headerSize) & ~(uintptr_t)alignMask);
+        end_ = (Block*)stop;
+        end_->size = 0;
+        end_->next = nullptr;
+        Block* first = (Block*)begin;
+        first->size = (size_t)(stop - begin);
+        first->next = end_;
+        start_.size = 0;
+        start_.next = first;
+    }
+
+    void* Malloc(size_t size) {
+        size_t want = (size + headerSize + alignMask) & ~alignMask;
+        Block* prev = &start_;
+        Block* block = start_.next;
+        while (block->size < want && block->next != nullptr) {
+            prev = block;
+            block = block->next;
+        }
+        if (block == end_) {
+            return nullptr;
+        }
+        prev->next = block->next;
+        if (block->size - want > 2 * headerSize) {
+            Block* rest = (Block*)((uint8_t*)block + want);
+            rest->size = block->size - want;
+            block->size = want;
+            Insert(rest);
+        }
+        block->next = nullptr;
+        return (uint8_t*)block + headerSize;
+    }
+
+    void Free(void* ptr) {
+        Insert((Block*)((uint8_t*)ptr - headerSize));
+    }
+
+private:
+    struct Block { Block* next; size_t size; };
+    static constexpr size_t alignMask = 7;
+    static constexpr size_t headerSize = (sizeof(Block) + alignMask) & ~alignMask;
+
+    void Insert(Block* block) {
+        Block* it = &start_;
+        while (it->next < block) {
+            it = it->next;
+        }
+        if (it != &start_ && (uint8_t*)it + it->size == (uint8_t*)block) {
+            it->size += block->size;
+            block = it;
+        }
+        if (it->next != end_ && (uint8_t*)block + block->size == (uint8_t*)it->next) {
+            block->size += it->next->size;
+            block->next = it->next->next;
+        }
+        else {
+            block->next = it->next;
+        }
+        if (it != block) {
+            it->next = block;
+        }
+    }
+
+    Block start_;
+    Block* end_;
+};
+
+// 测试夹具
+class RcsTlsfTest : public ::testing::Test {
+protected:
+    static constexpr size_t arenaSize = 64 * 1024;
+    RcsTlsfHandle_t handle;
+    alignas(16) uint8_t arena[arenaSize];
+    RcsTlsf_t tlsf;
+
+    void SetUp() override {
+        tlsf = RcsTlsfCreateStatic(&handle, arena, arenaSize);
+    }
+};
+
+// 参数不合适测试
+TEST_F(RcsTlsfTest, InvalidParam)
+{
+    RcsTlsfHandle_t other;
+    uint8_t tiny[8];
+    EXPECT_EQ(RcsTlsfCreateStatic(NULL, arena, arenaSize), nullptr);
+    EXPECT_EQ(RcsTlsfCreateStatic(&other, tiny, sizeof(tiny)), nullptr);
+    EXPECT_EQ(RcsTlsfMalloc(tlsf, 0), nullptr);
+    EXPECT_EQ(RcsTlsfMalloc(tlsf, arenaSize), nullptr);
+    EXPECT_EQ(RcsTlsfFree(tlsf, NULL), RCS_TLSF_INVALID_PARAM);
+    EXPECT_EQ(RcsTlsfFree(tlsf, tiny), RCS_TLSF_INVALID_PARAM);
+}
+
+// 重复释放被拒绝
+TEST_F(RcsTlsfTest, DoubleFree)
+{
+    ASSERT_NE(tlsf, nullptr);
+    void* a = RcsTlsfMalloc(tlsf, 100);
+    void* b = RcsTlsfMalloc(tlsf, 100);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(RcsTlsfFree(tlsf, a), RCS_TLSF_OK);
+    EXPECT_EQ(RcsTlsfFree(tlsf, a), RCS_TLSF_INVALID_PARAM);
+    EXPECT_EQ(RcsTlsfFree(tlsf, b), RCS_TLSF_OK);
+}
+
+// 释放后相邻块合并，整个堆恢复为一个空闲块
+TEST_F(RcsTlsfTest, CoalesceToSingleBlock)
+{
+    size_t initial = RcsTlsfGetFree(tlsf);
+    std::vector<void*> ptrs;
+    for (int i = 0; i < 50; i++) {
+        void* p = RcsTlsfMalloc(tlsf, 200);
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ((uintptr_t)p % sizeof(void*), 0u);
+        ptrs.push_back(p);
+    }
+    // 先释放奇数位置，再释放偶数位置，考察向前和向后合并
+    for (size_t i = 1; i < ptrs.size(); i += 2) {
+        RcsTlsfFree(tlsf, ptrs[i]);
+    }
+    for (size_t i = 0; i < ptrs.size(); i += 2) {
+        RcsTlsfFree(tlsf, ptrs[i]);
+    }
+    EXPECT_EQ(RcsTlsfGetFree(tlsf), initial);
+
+    // 若未完全合并，无法申请接近整个堆的大块
+    void* big = RcsTlsfMalloc(tlsf, arenaSize / 2);
+    EXPECT_NE(big, nullptr);
+    RcsTlsfFree(tlsf, big);
+}
+
+// 随机申请释放，数据互不覆盖
+TEST_F(RcsTlsfTest, RandomStress)
+{
+    std::mt19937 rng(12345);
+    struct Alloc { uint8_t* ptr; size_t size; uint8_t tag; };
+    std::vector<Alloc> live;
+    size_t initial = RcsTlsfGetFree(tlsf);
+
+    for (int iter = 0; iter < 20000; iter++) {
+        if (live.empty() || rng() % 3 != 0) {
+            size_t size = 1 + rng() % ((rng() % 8 == 0) ? 4000 : 64);
+            uint8_t* p = (uint8_t*)RcsTlsfMalloc(tlsf, size);
+            if (p == nullptr) {
+                continue;
+            }
+            uint8_t tag = (uint8_t)rng();
+            memset(p, tag, size);
+            live.push_back({p, size, tag});
+        }
+        else {
+            size_t idx = rng() % live.size();
+            Alloc a = live[idx];
+            for (size_t i = 0; i < a.size; i++) {
+                ASSERT_EQ(a.ptr[i], a.tag);
+            }
+            ASSERT_EQ(RcsTlsfFree(tlsf, a.ptr), RCS_TLSF_OK);
+            live[idx] = live.back();
+            live.pop_back();
+        }
+    }
+    for (auto& a : live) {
+        ASSERT_EQ(RcsTlsfFree(tlsf, a.ptr), RCS_TLSF_OK);
+    }
+    EXPECT_EQ(RcsTlsfGetFree(tlsf), initial);
+}
+
+// 按实例作为FIFO的分配器
+TEST_F(RcsTlsfTest, FifoAllocator)
+{
+    RcsTlsf_t dynamic = RcsTlsfCreate(4096);
+    ASSERT_NE(dynamic, nullptr);
+    RcsAllocator_t allocator;
+    ASSERT_EQ(RcsTlsfGetAllocator(dynamic, &allocator), RCS_TLSF_OK);
+
+    size_t initial = RcsTlsfGetFree(dynamic);
+    RcsFifo_t small = RcsFifoCreateWithAllocator(32, &allocator);
+    RcsFifo_t large = RcsFifoCreateWithAllocator(1000, &allocator);
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large, nullptr);
+    EXPECT_LT(RcsTlsfGetFree(dynamic), initial);
+
+    void* memAcquired[2] = {nullptr};
+    ASSERT_EQ(RcsFifoSendAcquire(large, 999, memAcquired), 999);
+    memset(memAcquired[0], 0x5A, 999);
+    RcsFifoSendComplete(large, (const void**)memAcquired);
+
+    RcsFifoDestroy(small);
+    RcsFifoDestroy(large);
+    EXPECT_EQ(RcsTlsfGetFree(dynamic), initial);
+    RcsTlsfDestroy(dynamic);
+}
+
+// 碎片化负载下单次申请/释放的延迟：TLSF、glibc malloc与heap_4模型
+// 同一负载重复5次，每个操作取最短耗时以滤除中断与调度的干扰，再统计均值与最坏情况
+TEST_F(RcsTlsfTest, DISABLED_LatencyComparison)
+{
+    constexpr size_t poolSize = 1 << 20;
+    constexpr int repeat = 5;
+    constexpr int ops = 20000;
+    std::vector<uint8_t> tlsfMem(poolSize), heap4Mem(poolSize);
+    RcsTlsfHandle_t tlsfHandle;
+    RcsTlsf_t big = nullptr;
+    Heap4Model* heap4 = nullptr;
+
+    auto measure = [&](const char* name, std::function<void()> reset, std::function<void*(size_t)> alloc,
+                       std::function<void(void*)> release) {
+        std::vector<double> best(ops, 1e12);
+        for (int round = 0; round < repeat; round++) {
+            reset();
+            std::mt19937 rng(32);
+            std::vector<void*> live;
+            // 先交替释放制造大量小空洞，首次适配需要沿空闲链表逐个跳过
+            for (int i = 0; i < 4000; i++) {
+                live.push_back(alloc(16 + rng() % 48));
+            }
+            for (size_t i = 0; i < live.size(); i += 2) {
+                release(live[i]);
+                live[i] = nullptr;
+            }
+
+            for (int iter = 0; iter < ops; iter++) {
+                size_t idx = rng() % live.size();
+                size_t size = (rng() % 8 == 0) ? 512 + rng() % 2048 : 16 + rng() % 96;
+                auto start = std::chrono::steady_clock::now();
+                if (live[idx] == nullptr) {
+                    live[idx] = alloc(size);
+                }
+                else {
+                    release(live[idx]);
+                    live[idx] = nullptr;
+                }
+                double ns = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9;
+                best[iter] = std::min(best[iter], ns);
+            }
+            for (void* ptr : live) {
+                if (ptr != nullptr) {
+                    release(ptr);
+                }
+            }
+        }
+        double mean = 0;
+        for (double sample : best) {
+            mean += sample;
+        }
+        std::sort(best.begin(), best.end());
+        printf("%s: mean %.0f ns, p99.9 %.0f ns, max %.0f ns\n", name, mean / ops,
+               best[ops * 999 / 1000], best.back());
+    };
+
+    measure("tlsf",
+            [&]() { big = RcsTlsfCreateStatic(&tlsfHandle, tlsfMem.data(), poolSize); },
+            [&](size_t size) { return RcsTlsfMalloc(big, size); },
+            [&](void* ptr) { RcsTlsfFree(big, ptr); });
+    // 全部释放后合并回初始状态
+    size_t after = RcsTlsfGetFree(big);
+    big = RcsTlsfCreateStatic(&tlsfHandle, tlsfMem.data(), poolSize);
+    EXPECT_EQ(after, RcsTlsfGetFree(big));
+    measure("glibc malloc", []() {}, [](size_t size) { return malloc(size); }, [](void* ptr) { free(ptr); });
+    measure("heap_4 model",
+            [&]() { delete heap4; heap4 = new Heap4Model(heap4Mem.data(), poolSize); },
+            [&](size_t size) { return heap4->Malloc(size); },
+            [&](void* ptr) { heap4->Free(ptr); });
+    delete heap4;
+}
@@ -0,0 +1,210 @@
+/**
+ * @file view_cursor_test.cpp
+ * @brief 两段区域游标的测试用例
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "view_cursor.h"
+
+// 测试夹具
+class RcsCursorTest : public ::testing::Test {
+protected:
+    uint8_t buf[64];
+    std::mt19937 rng{49};
+
+    // 第一段位于buf后半部分，第二段从buf起点开始，模拟回绕
+    void Segments(void *mem[2]) {
+        mem[0] = buf + 32;
+        mem[1] = buf;
+    }
+
+    // 把线性数据按split拆入两段
+    void Scatter(const uint8_t *src, size_t split, size_t size) {
+        memcpy(buf + 32, src, split);
+        memcpy(buf, src + split, size - split);
+    }
+
+    void Gather(uint8_t *dst, size_t split, size_t size) {
+        memcpy(dst, buf + 32, split);
+        memcpy(dst + split, buf, size - split);
+    }
+};
+
+// 固定的字节序
+TEST_F(RcsCursorTest, Endianness)
+{
+    const uint8_t raw[] = {0xAB, 0x34, 0x12, 0x12, 0x34, 0x78, 0x56, 0x34, 0x12, 0x12, 0x34, 0x56, 0x78,
+                           0x00, 0x00, 0xC0, 0x3F, 0x3F, 0xC0, 0x00, 0x00};
+    void *mem[2] = {(void *)raw, nullptr};
+    RcsCursor_t cursor;
+    ASSERT_EQ(RcsCursorInit(&cursor, mem, sizeof(raw), sizeof(raw)), RCS_CURSOR_OK);
+
+    EXPECT_EQ(RcsCursorGetU8(&cursor), 0xAB);
+    EXPECT_EQ(RcsCursorGetU16Le(&cursor), 0x1234);
+    EXPECT_EQ(RcsCursorGetU16Be(&cursor), 0x1234);
+    EXPECT_EQ(RcsCursorGetU32Le(&cursor), 0x12345678u);
+    EXPECT_EQ(RcsCursorGetU32Be(&cursor), 0x12345678u);
+    EXPECT_EQ(RcsCursorGetF32Le(&cursor), 1.5f);
+    EXPECT_EQ(RcsCursorGetF32Be(&cursor), 1.5f);
+    EXPECT_EQ(RcsCursorGetRemain(&cursor), 0u);
+    EXPECT_EQ(RcsCursorGetError(&cursor), RCS_CURSOR_OK);
+}
+
+// 每种字段放在每个切分位置，写入后按线性字节检查，再读回
+TEST_F(RcsCursorTest, FieldsAcrossEverySplit)
+{
+    const size_t size = 21;
+    for (size_t split = 0; split <= size; split++) {
+        void *mem[2];
+        Segments(mem);
+        RcsCursor_t cursor;
+        ASSERT_EQ(RcsCursorInit(&cursor, mem, split, size), RCS_CURSOR_OK);
+
+        RcsCursorPutU8(&cursor, 0xAB);
+        RcsCursorPutU16Le(&cursor, 0x1234);
+        RcsCursorPutU16Be(&cursor, 0x1234);
+        RcsCursorPutU32Le(&cursor, 0x12345678);
+        RcsCursorPutU32Be(&cursor, 0x12345678);
+        RcsCursorPutF32Le(&cursor, 1.5f);
+        RcsCursorPutF32Be(&cursor, 1.5f);
+        ASSERT_EQ(RcsCursorGetError(&cursor), RCS_CURSOR_OK);
+        ASSERT_EQ(RcsCursorGetPos(&cursor), size);
+
+        const uint8_t expect[] = {0xAB, 0x34, 0x12, 0x12, 0x34, 0x78, 0x56, 0x34, 0x12, 0x12, 0x34, 0x56, 0x78,
+                                  0x00, 0x00, 0xC0, 0x3F, 0x3F, 0xC0, 0x00, 0x00};
+        uint8_t linear[size];
+        Gather(linear, split, size);
+        ASSERT_EQ(memcmp(linear, expect, size), 0) << "split " << split;
+
+        RcsFifoView_t view;
+        RcsFifoViewInit(&view, mem, split, size);
+        ASSERT_EQ(RcsCursorInitView(&cursor, &view), RCS_CURSOR_OK);
+        ASSERT_EQ(RcsCursorGetU8(&cursor), 0xAB);
+        ASSERT_EQ(RcsCursorGetU16Le(&cursor), 0x1234);
+        ASSERT_EQ(RcsCursorGetU16Be(&cursor), 0x1234);
+        ASSERT_EQ(RcsCursorGetU32Le(&cursor), 0x12345678u);
+        ASSERT_EQ(RcsCursorGetU32Be(&cursor), 0x12345678u);
+        ASSERT_EQ(RcsCursorGetF32Le(&cursor), 1.5f);
+        ASSERT_EQ(RcsCursorGetF32Be(&cursor), 1.5f);
+        ASSERT_EQ(RcsCursorGetError(&cursor), RCS_CURSOR_OK);
+    }
+}
+
+// 跳过与批量读取
+TEST_F(RcsCursorTest, SkipAndRead)
+{
+    uint8_t src[30];
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (uint8_t)i;
+    }
+    for (size_t split = 0; split <= sizeof(src); split++) {
+        Scatter(src, split, sizeof(src));
+        void *mem[2];
+        Segments(mem);
+        RcsCursor_t cursor;
+        RcsCursorInit(&cursor, mem, split, sizeof(src));
+
+        size_t skip = rng() % 20;
+        ASSERT_EQ(RcsCursorSkip(&cursor, skip), RCS_CURSOR_OK);
+        ASSERT_EQ(RcsCursorGetPos(&cursor), skip);
+        uint8_t out[10];
+        RcsCursorRead(&cursor, out, sizeof(out));
+        ASSERT_EQ(memcmp(out, src + skip, sizeof(out)), 0);
+        ASSERT_EQ(RcsCursorGetRemain(&cursor), sizeof(src) - skip - sizeof(out));
+    }
+}
+
+// 越界时置位错误、位置不变，读取返回0、写入不改变内存
+TEST_F(RcsCursorTest, Overflow)
+{
+    memset(buf, 0x55, sizeof(buf));
+    void *mem[2];
+    Segments(mem);
+    RcsCursor_t cursor;
+    ASSERT_EQ(RcsCursorInit(&cursor, mem, 2, 3), RCS_CURSOR_OK);
+
+    EXPECT_EQ(RcsCursorGetU16Le(&cursor), 0x5555);
+    EXPECT_EQ(RcsCursorGetU32Le(&cursor), 0u);
+    EXPECT_EQ(RcsCursorGetError(&cursor), RCS_CURSOR_OVERFLOW);
+    EXPECT_EQ(RcsCursorGetPos(&cursor), 2u);
+    EXPECT_EQ(RcsCursorGetU8(&cursor), 0x55);
+    EXPECT_EQ(RcsCursorGetError(&cursor), RCS_CURSOR_OVERFLOW);
+
+    RcsCursorInit(&cursor, mem, 2, 3);
+    RcsCursorPutU8(&cursor, 0);
+    RcsCursorPutU32Be(&cursor, 0);
+    EXPECT_EQ(RcsCursorGetError(&cursor), RCS_CURSOR_OVERFLOW);
+    EXPECT_EQ(buf[33], 0x55);
+    EXPECT_EQ(buf[0], 0x55);
+    EXPECT_EQ(RcsCursorSkip(&cursor, 3), RCS_CURSOR_OVERFLOW);
+
+    EXPECT_EQ(RcsCursorInit(&cursor, mem, 4, 3), RCS_CURSOR_INVALID_PARAM);
+    mem[1] = nullptr;
+    EXPECT_EQ(RcsCursorInit(&cursor, mem, 2, 3), RCS_CURSOR_INVALID_PARAM);
+    EXPECT_EQ(RcsCursorInit(&cursor, mem, 3, 3), RCS_CURSOR_OK);
+}
+
+// 在真实FIFO上写入并读回回绕的记录
+TEST_F(RcsCursorTest, FifoRoundTrip)
+{
+    uint8_t memory[50];
+    RcsFifoHandle_t handle;
+    RcsFifo_t fifo = RcsFifoCreateStatic(sizeof(memory), &handle, memory);
+    const size_t record = 11;
+
+    for (uint32_t i = 0; i < 200; i++) {
+        void *mem[2] = {nullptr, nullptr};
+        RcsCursor_t cursor;
+        int first = RcsFifoSendAcquire(fifo, record, mem);
+        ASSERT_GE(first, 0);
+        RcsCursorInit(&cursor, mem, (size_t)first, record);
+        RcsCursorPutU8(&cursor, (uint8_t)i);
+        RcsCursorPutU16Be(&cursor, (uint16_t)(i * 3));
+        RcsCursorPutU32Le(&cursor, i * 100003u);
+        RcsCursorPutF32Le(&cursor, (float)i * 0.25f);
+        ASSERT_EQ(RcsCursorGetError(&cursor), RCS_CURSOR_OK);
+        RcsFifoSendComplete(fifo, (const void **)mem);
+
+        first = RcsFifoRecvAcquire(fifo, record, mem);
+        ASSERT_GE(first, 0);
+        RcsFifoView_t view;
+        RcsFifoViewInit(&view, mem, (size_t)first, record);
+        RcsCursorInitView(&cursor, &view);
+        ASSERT_EQ(RcsCursorGetU8(&cursor), (uint8_t)i);
+        ASSERT_EQ(RcsCursorGetU16Be(&cursor), (uint16_t)(i * 3));
+        ASSERT_EQ(RcsCursorGetU32Le(&cursor), i * 100003u);
+        ASSERT_EQ(RcsCursorGetF32Le(&cursor), (float)i * 0.25f);
+        RcsFifoRecvComplete(fifo, (const void **)mem);
+    }
+}
+
+// 吞吐量测试，仅在make bench时运行
+TEST_F(RcsCursorTest, DISABLED_Throughput)
+{
+    std::vector<uint8_t> big(1 << 16);
+    for (auto &b : big) {
+        b = (uint8_t)rng();
+    }
+    void *mem[2] = {big.data(), big.data()};
+    const int rounds = 256;
+    uint32_t sum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        RcsCursor_t cursor;
+        RcsCursorInit(&cursor, mem, big.size() / 2 + 3, big.size());
+        while (RcsCursorGetRemain(&cursor) >= 8) {
+            sum += RcsCursorGetU16Le(&cursor);
+            sum += RcsCursorGetU32Be(&cursor);
+            sum += RcsCursorGetU16Be(&cursor);
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("view cursor: %.1f MB/s (sum=%08X)\n", rounds * big.size() / seconds / 1e6, sum);
+}